@@ -5,8 +5,10 @@
 #include "Template.h"
 
 #include <QFileInfo>
+#include <QHash>
 #include <QLoggingCategory>
-#include <QRegularExpression>
+#include <QMutex>
+#include <QMutexLocker>
 
 
 using namespace governikus;
@@ -14,53 +16,124 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(activation)
 
 
+struct Template::Cache
+{
+	QMutex mMutex;
+	QHash<QString, QSharedPointer<const Compiled>> mTemplates;
+};
+
+
+Template::Cache& Template::getCache()
+{
+	static Cache cache;
+	return cache;
+}
+
+
+QSharedPointer<const Template::Compiled> Template::compile(const QString& pTemplate)
+{
+	const auto compiled = QSharedPointer<Compiled>::create();
+	compiled->mTextLength = 0;
+
+	const auto appendText = [&compiled](const QString& pText) {
+			if (!pText.isEmpty())
+			{
+				compiled->mSegments += Segment{pText, false};
+				compiled->mTextLength += pText.size();
+			}
+		};
+
+	// A key is "${" followed by any characters except '$', '{' and '}' and a closing '}'.
+	int textStart = 0;
+	int pos = 0;
+	while ((pos = pTemplate.indexOf(QLatin1String("${"), pos)) != -1)
+	{
+		int end = pos + 2;
+		while (end < pTemplate.size() && pTemplate.at(end) != QLatin1Char('}') && pTemplate.at(end) != QLatin1Char('$') && pTemplate.at(end) != QLatin1Char('{'))
+		{
+			++end;
+		}
+
+		if (end == pTemplate.size() || pTemplate.at(end) != QLatin1Char('}'))
+		{
+			++pos;
+			continue;
+		}
+
+		const QString key = pTemplate.mid(pos + 2, end - pos - 2);
+		appendText(pTemplate.mid(textStart, pos - textStart));
+		compiled->mSegments += Segment{key, true};
+		compiled->mKeys += key;
+
+		pos = end + 1;
+		textStart = pos;
+	}
+	appendText(pTemplate.mid(textStart));
+
+	return compiled;
+}
+
+
+void Template::clearCache()
+{
+	auto& cache = getCache();
+	const QMutexLocker locker(&cache.mMutex);
+	cache.mTemplates.clear();
+}
+
+
 Template Template::fromFile(const QString& pTemplateFileName)
 {
+	auto& cache = getCache();
+	{
+		const QMutexLocker locker(&cache.mMutex);
+		if (const auto compiled = cache.mTemplates.value(pTemplateFileName))
+		{
+			return Template(compiled);
+		}
+	}
+
 	QFile templateFile(pTemplateFileName);
-	QString fileContent;
 	if (!templateFile.exists())
 	{
 		qCCritical(activation) << "Template file not found" << pTemplateFileName;
+		return Template(QString());
 	}
-	else if (!templateFile.open(QFile::OpenModeFlag::ReadOnly))
+	if (!templateFile.open(QFile::OpenModeFlag::ReadOnly))
 	{
 		qCCritical(activation) << "Template file not openable" << pTemplateFileName;
+		return Template(QString());
 	}
-	else
-	{
-		fileContent = QString::fromUtf8(templateFile.readAll());
-	}
-	return Template(fileContent);
+
+	const auto compiled = compile(QString::fromUtf8(templateFile.readAll()));
+	const QMutexLocker locker(&cache.mMutex);
+	cache.mTemplates.insert(pTemplateFileName, compiled);
+	return Template(compiled);
 }
 
 
-Template::Template(const QString& pTemplate)
-	: mTemplate(pTemplate)
-	, mKeys()
+Template::Template(const QSharedPointer<const Compiled>& pCompiled)
+	: mCompiled(pCompiled)
 	, mContext()
 {
-	const QRegularExpression keyRegEx(QStringLiteral("(\\$\\{(?<key>[^\\$\\{\\}]*)\\})"));
-	auto matches = keyRegEx.globalMatch(mTemplate);
-	while (matches.hasNext())
-	{
-		const QString& match = matches.next().captured(QStringLiteral("key"));
-		if (!mKeys.contains(match))
-		{
-			mKeys += match;
-		}
-	}
+}
+
+
+Template::Template(const QString& pTemplate)
+	: Template(compile(pTemplate))
+{
 }
 
 
 const QSet<QString> Template::getContextKeys() const
 {
-	return mKeys;
+	return mCompiled->mKeys;
 }
 
 
 bool Template::setContextParameter(const QString& pKey, const QString& pValue)
 {
-	if (!mKeys.contains(pKey))
+	if (!mCompiled->mKeys.contains(pKey))
 	{
 		qCWarning(activation) << "Ignoring unknown key" << pKey;
 		return false;
@@ -76,15 +149,27 @@ bool Template::setContextParameter(const QString& pKey, const QString& pValue)
 
 QString Template::render() const
 {
-	QString output = mTemplate;
-	for (const auto& key : mKeys)
+	int length = mCompiled->mTextLength;
+	for (const auto& key : qAsConst(mCompiled->mKeys))
 	{
-		const auto& value = mContext.value(key);
-		if (value.isNull())
+		if (mContext.value(key).isNull())
 		{
 			qCWarning(activation) << "No parameter specified, replace with empty string" << key;
 		}
-		output = output.replace(QStringLiteral("${%1}").arg(key), value);
+	}
+	for (const auto& segment : qAsConst(mCompiled->mSegments))
+	{
+		if (segment.mIsKey)
+		{
+			length += mContext.value(segment.mText).size();
+		}
+	}
+
+	QString output;
+	output.reserve(length);
+	for (const auto& segment : qAsConst(mCompiled->mSegments))
+	{
+		output += segment.mIsKey ? mContext.value(segment.mText) : segment.mText;
 	}
 	return output;
 }
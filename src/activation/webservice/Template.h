@@ -10,7 +10,12 @@
 #include <QFile>
 #include <QMap>
 #include <QSet>
+#include <QSharedPointer>
 #include <QString>
+#include <QVector>
+
+
+class test_Template;
 
 
 namespace governikus
@@ -18,13 +23,40 @@ namespace governikus
 
 class Template
 {
-	QString mTemplate;
-	QSet<QString> mKeys;
+	friend class ::test_Template;
+
+	/*!
+	 * A template is compiled once into a list of literal text and placeholder
+	 * segments. The compiled template is immutable and shared by all copies.
+	 */
+	struct Segment
+	{
+		QString mText;
+		bool mIsKey;
+	};
+
+	struct Compiled
+	{
+		QVector<Segment> mSegments;
+		QSet<QString> mKeys;
+		int mTextLength;
+	};
+
+	struct Cache;
+
+	QSharedPointer<const Compiled> mCompiled;
 	QMap<QString, QString> mContext;
 
+	static Cache& getCache();
+	static QSharedPointer<const Compiled> compile(const QString& pTemplate);
+	static void clearCache();
+
+	explicit Template(const QSharedPointer<const Compiled>& pCompiled);
+
 	public:
 		/*!
-		 * \brief Construct a template from file
+		 * \brief Construct a template from file. Every file is only read and compiled
+		 * once, so it must not change while the application is running, e.g. resources.
 		 */
 		static Template fromFile(const QString& pTemplateFileName);
 
@@ -15,6 +15,7 @@
 #include <QCoreApplication>
 #include <QFile>
 #include <QLoggingCategory>
+#include <QResource>
 
 
 using namespace governikus;
@@ -187,6 +188,18 @@ void WebserviceActivationHandler::handleImageRequest(const QSharedPointer<HttpRe
 {
 	HttpResponse response;
 
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
+	// Uncompressed resources are served from the registered resource data without reading a copy.
+	const QResource resource(pImagePath);
+	if (resource.isValid() && !resource.isDir())
+	{
+		response.setStatus(HTTP_STATUS_OK);
+		response.setBody(resource.uncompressedData(), guessImageContentType(pImagePath));
+		pRequest->send(response);
+		return;
+	}
+#endif
+
 	QFile imageFile(pImagePath);
 	if (imageFile.open(QIODevice::ReadOnly))
 	{
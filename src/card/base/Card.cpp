@@ -25,6 +25,13 @@ void Card::setProgressMessage(const QString& pMessage, int pProgress)
 }
 
 
+QVector<ResponseApduResult> Card::transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos)
+{
+	Q_UNUSED(pInputApduInfos)
+	return QVector<ResponseApduResult>();
+}
+
+
 EstablishPaceChannelOutput Card::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription, quint8 pTimeoutSeconds)
 {
 	Q_UNUSED(pPasswordId)
@@ -9,11 +9,13 @@
 #include "CardReturnCode.h"
 #include "CommandApdu.h"
 #include "EstablishPaceChannelOutput.h"
+#include "InputAPDUInfo.h"
 #include "ResponseApdu.h"
 #include "SmartCardDefinitions.h"
 
 #include <QObject>
 #include <QPointer>
+#include <QVector>
 
 
 namespace governikus
@@ -56,6 +58,14 @@ class Card
 		 */
 		virtual ResponseApduResult transmit(const CommandApdu& pCmd) = 0;
 
+		/*!
+		 * Performs a batch of transmits to the smart card in one go. The card stops at the
+		 * first response whose status code is not acceptable.
+		 * An empty result means that the card does not support batches, so the caller needs
+		 * to transmit the command APDUs one by one.
+		 */
+		virtual QVector<ResponseApduResult> transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos);
+
 		/*!
 		 * Establishes a PACE channel, i.e. the corresponding reader is no basic reader.
 		 */
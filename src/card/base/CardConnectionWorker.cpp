@@ -17,14 +17,26 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 Q_DECLARE_LOGGING_CATEGORY(support)
 
+
+const int SHORT_READ_BINARY_LENGTH = 0xff;
+const int EXTENDED_READ_BINARY_LENGTH = 0x0400;
+
+// Secure messaging adds DO'87' (with padding), DO'99' and DO'8E' to the response data
+const int SECURE_MESSAGING_RESPONSE_OVERHEAD = 0x40;
+
+
 CardConnectionWorker::CardConnectionWorker(Reader* pReader)
 	: QObject()
 	, QEnableSharedFromThis()
 	, mReader(pReader)
 	, mSecureMessaging()
+	, mFileCache()
 {
 	connect(mReader.data(), &Reader::fireCardInserted, this, &CardConnectionWorker::fireReaderInfoChanged);
 	connect(mReader.data(), &Reader::fireCardRemoved, this, &CardConnectionWorker::fireReaderInfoChanged);
+	connect(mReader.data(), &Reader::fireCardRemoved, this, [this] {
+			mFileCache.clear();
+		});
 	connect(mReader.data(), &Reader::fireCardRetryCounterChanged, this, &CardConnectionWorker::fireReaderInfoChanged);
 }
 
@@ -95,6 +107,36 @@ ResponseApduResult CardConnectionWorker::transmit(const CommandApdu& pCommandApd
 }
 
 
+QVector<ResponseApduResult> CardConnectionWorker::transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos)
+{
+	const auto card = mReader ? mReader->getCard() : nullptr;
+	if (!card || mSecureMessaging)
+	{
+		return QVector<ResponseApduResult>();
+	}
+
+	return card->transmitBatch(pInputApduInfos);
+}
+
+
+int CardConnectionWorker::getReadBinaryLength() const
+{
+	const auto& readerInfo = getReaderInfo();
+	if (!readerInfo.hasEidCard() || !readerInfo.isMaxApduLengthReported())
+	{
+		return SHORT_READ_BINARY_LENGTH;
+	}
+
+	const int maxApduLength = readerInfo.getMaxApduLength();
+	if (maxApduLength == -1)
+	{
+		return EXTENDED_READ_BINARY_LENGTH;
+	}
+
+	return qBound(SHORT_READ_BINARY_LENGTH, maxApduLength - SECURE_MESSAGING_RESPONSE_OVERHEAD, EXTENDED_READ_BINARY_LENGTH);
+}
+
+
 CardReturnCode CardConnectionWorker::readFile(const FileRef& pFileRef, QByteArray& pFileContent)
 {
 	if (!mReader || !mReader->getCard())
@@ -102,6 +144,14 @@ CardReturnCode CardConnectionWorker::readFile(const FileRef& pFileRef, QByteArra
 		return CardReturnCode::CARD_NOT_FOUND;
 	}
 
+	const auto cachedContent = mFileCache.constFind(pFileRef.path);
+	if (cachedContent != mFileCache.constEnd())
+	{
+		qCDebug(::card) << "Using cached content of file" << pFileRef.path.toHex() << "|" << cachedContent->size() << "bytes";
+		pFileContent += *cachedContent;
+		return CardReturnCode::OK;
+	}
+
 	CommandApdu select = SelectBuilder(pFileRef).build();
 	auto [selectReturnCode, selectRes] = transmit(select);
 	if (selectReturnCode != CardReturnCode::OK || selectRes.getReturnCode() != StatusCode::SUCCESS)
@@ -109,19 +159,33 @@ CardReturnCode CardConnectionWorker::readFile(const FileRef& pFileRef, QByteArra
 		return CardReturnCode::COMMAND_FAILED;
 	}
 
+	QByteArray fileContent;
+	int readBinaryLength = getReadBinaryLength();
+	int roundTrips = 0;
 	while (true)
 	{
-		ReadBinaryBuilder rb(static_cast<uint>(pFileContent.count()), 0xff);
+		ReadBinaryBuilder rb(static_cast<uint>(fileContent.size()), readBinaryLength);
 		auto [returnCode, res] = transmit(rb.build());
+		++roundTrips;
 		if (returnCode != CardReturnCode::OK)
 		{
 			break;
 		}
 
-		pFileContent += res.getData();
 		const StatusCode statusCode = res.getReturnCode();
+		if (statusCode == StatusCode::WRONG_LENGTH && readBinaryLength > SHORT_READ_BINARY_LENGTH)
+		{
+			qCDebug(::card) << "Card rejected READ BINARY with Le" << readBinaryLength << "| Falling back to" << SHORT_READ_BINARY_LENGTH;
+			readBinaryLength = SHORT_READ_BINARY_LENGTH;
+			continue;
+		}
+
+		fileContent += res.getData();
 		if (statusCode == StatusCode::END_OF_FILE)
 		{
+			qCDebug(::card) << "Read file" << pFileRef.path.toHex() << "|" << fileContent.size() << "bytes in" << roundTrips << "round trips";
+			mFileCache.insert(pFileRef.path, fileContent);
+			pFileContent += fileContent;
 			return CardReturnCode::OK;
 		}
 		if (statusCode != StatusCode::SUCCESS)
@@ -130,6 +194,7 @@ CardReturnCode CardConnectionWorker::readFile(const FileRef& pFileRef, QByteArra
 		}
 	}
 
+	qCDebug(::card) << "Reading file" << pFileRef.path.toHex() << "failed after" << roundTrips << "round trips";
 	return CardReturnCode::COMMAND_FAILED;
 }
 
@@ -152,6 +217,7 @@ bool CardConnectionWorker::stopSecureMessaging()
 	}
 
 	mSecureMessaging.reset();
+	mFileCache.clear();
 	return true;
 }
 
@@ -174,6 +240,9 @@ EstablishPaceChannelOutput CardConnectionWorker::establishPaceChannel(PacePasswo
 		return EstablishPaceChannelOutput(CardReturnCode::CARD_NOT_FOUND);
 	}
 
+	// Files read before are not protected by the new channel
+	mFileCache.clear();
+
 	EstablishPaceChannelOutput output;
 
 	qCInfo(support) << "Starting PACE for" << pPasswordId;
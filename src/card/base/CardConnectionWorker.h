@@ -11,12 +11,14 @@
 #include "CommandApdu.h"
 #include "EstablishPaceChannel.h"
 #include "FileRef.h"
+#include "InputAPDUInfo.h"
 #include "pace/SecureMessaging.h"
 #include "Reader.h"
 #include "ResponseApdu.h"
 #include "SmartCardDefinitions.h"
 
 #include <QByteArray>
+#include <QHash>
 
 namespace governikus
 {
@@ -41,8 +43,22 @@ class CardConnectionWorker
 		 */
 		QScopedPointer<SecureMessaging> mSecureMessaging;
 
+		/*!
+		 * Content of all files read successfully on this connection, keyed by path.
+		 * It is dropped if a PACE channel is established or secure messaging stops,
+		 * so a file is never returned over a different channel than it was read.
+		 */
+		QHash<QByteArray, QByteArray> mFileCache;
+
 		inline QSharedPointer<const EFCardAccess> getEfCardAccess() const;
 
+		/*!
+		 * Determines the expected length of a READ BINARY command. Extended length is used if the
+		 * card is an eID card and the reader reports a maximum APDU length that exceeds short APDUs.
+		 * The assumed length of readers that cannot report it is not sufficient.
+		 */
+		[[nodiscard]] int getReadBinaryLength() const;
+
 	protected:
 		/*!
 		 * The Card hold by the Reader is expected to be connected.
@@ -64,10 +80,21 @@ class CardConnectionWorker
 
 		virtual CardReturnCode updateRetryCounter();
 
+		/*!
+		 * Reads the complete file. The content is cached for the lifetime of the connection,
+		 * so subsequent calls for the same file do not access the card again.
+		 */
 		virtual CardReturnCode readFile(const FileRef& pFileRef, QByteArray& pFileContent);
 
 		virtual ResponseApduResult transmit(const CommandApdu& pCommandApdu);
 
+		/*!
+		 * Transmits a batch of command APDUs in one go, see \ref Card::transmitBatch.
+		 * An empty result is returned if the card does not support batches or secure messaging is
+		 * active, because every command APDU needs to be secured on its own in that case.
+		 */
+		virtual QVector<ResponseApduResult> transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos);
+
 		/*!
 		 * Performs PACE and establishes a PACE channel.
 		 * If the Reader is a basic reader and the PACE channel is successfully established, the subsequent transmits will be secured using, secure messaging.
@@ -9,6 +9,7 @@
 #include "asn1/PaceInfo.h"
 #include "asn1/SecurityInfos.h"
 #include "CardConnectionWorker.h"
+#include "SecurityInfosCache.h"
 #include "SelectBuilder.h"
 
 #include <QDebug>
@@ -242,7 +243,7 @@ QSharedPointer<EFCardAccess> CardInfoFactory::readEfCardAccess(const QSharedPoin
 		return QSharedPointer<EFCardAccess>();
 	}
 
-	auto efCardAccess = EFCardAccess::decode(efCardAccessBytes);
+	auto efCardAccess = Env::getSingleton<SecurityInfosCache>()->getEfCardAccess(efCardAccessBytes);
 	if (efCardAccess == nullptr)
 	{
 		qCCritical(card) << "Error while reading EF.CardAccess: Cannot parse EFCardAccess";
@@ -91,7 +91,7 @@ class CardInfoFactory
 		static bool detectEid(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker, const FileRef& pRef);
 
 		/*!
-		 * Reads the EF.CardAccess
+		 * Reads the EF.CardAccess. It is only parsed if the same content was not recently seen.
 		 */
 		static QSharedPointer<EFCardAccess> readEfCardAccess(const QSharedPointer<CardConnectionWorker>& pCardConnectionWorker);
 
@@ -25,11 +25,13 @@ ReaderInfo::ReaderInfo(const QString& pName,
 	, mCardInfo(pCardInfo)
 	, mConnected(false)
 	, mMaxApduLength(500)
+	, mMaxApduLengthReported(false)
 {
 #ifdef Q_OS_ANDROID
 	if (pPlugInType == ReaderManagerPlugInType::NFC)
 	{
 		mMaxApduLength = -1;
+		mMaxApduLengthReported = true;
 	}
 #endif
 }
@@ -23,6 +23,7 @@ class ReaderInfo
 	CardInfo mCardInfo;
 	bool mConnected;
 	int mMaxApduLength;
+	bool mMaxApduLengthReported;
 
 	public:
 		explicit ReaderInfo(const QString& pName = QString(),
@@ -137,6 +138,7 @@ class ReaderInfo
 		void setMaxApduLength(int pMaxApduLength)
 		{
 			mMaxApduLength = pMaxApduLength;
+			mMaxApduLengthReported = true;
 		}
 
 
@@ -146,6 +148,16 @@ class ReaderInfo
 		}
 
 
+		/*!
+		 * Returns true if the maximum APDU length was reported by the reader. Otherwise
+		 * it is only the assumption for readers that cannot report it, like PC/SC readers.
+		 */
+		[[nodiscard]] bool isMaxApduLengthReported() const
+		{
+			return mMaxApduLengthReported;
+		}
+
+
 		[[nodiscard]] bool sufficientApduLength() const
 		{
 			return mMaxApduLength == -1 || mMaxApduLength >= 500;
@@ -6,6 +6,8 @@
 
 #include <QLoggingCategory>
 
+#include <atomic>
+
 using namespace governikus;
 
 Q_DECLARE_LOGGING_CATEGORY(card)
@@ -16,6 +18,8 @@ ReaderManager::ReaderManager()
 	, mMutex()
 	, mThread()
 	, mWorker()
+	, mReaderInfoSnapshot(std::make_shared<const ReaderInfoSnapshot>(ReaderInfoSnapshot {0, {}, {}}))
+	, mPlugInInfoCache()
 {
 	mThread.setObjectName(QStringLiteral("ReaderManagerThread"));
 }
@@ -115,7 +119,7 @@ void ReaderManager::shutdown()
 		}
 		mThread.quit();
 		mThread.wait(5000);
-		mReaderInfoCache.clear();
+		publishReaderInfos(QMap<QString, ReaderInfo>());
 		mPlugInInfoCache.clear();
 		qCDebug(card).noquote() << mThread.objectName() << "stopped:" << !mThread.isRunning();
 	}
@@ -217,17 +221,42 @@ QVector<ReaderManagerPlugInInfo> ReaderManager::getPlugInInfos() const
 }
 
 
+std::shared_ptr<const ReaderManager::ReaderInfoSnapshot> ReaderManager::getReaderInfoSnapshot() const
+{
+	return std::atomic_load_explicit(&mReaderInfoSnapshot, std::memory_order_acquire);
+}
+
+
+void ReaderManager::publishReaderInfos(const QMap<QString, ReaderInfo>& pReaderInfos)
+{
+	const auto& current = getReaderInfoSnapshot();
+
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
+	const auto& list = pReaderInfos.values();
+#else
+	const auto& list = pReaderInfos.values().toVector(); // clazy:exclude=container-anti-pattern
+#endif
+
+	std::shared_ptr<const ReaderInfoSnapshot> next = std::make_shared<const ReaderInfoSnapshot>(ReaderInfoSnapshot {current->mVersion + 1, pReaderInfos, list});
+	std::atomic_store_explicit(&mReaderInfoSnapshot, std::move(next), std::memory_order_release);
+}
+
+
 void ReaderManager::doUpdateCacheEntry(const ReaderInfo& pInfo)
 {
 	qCDebug(card) << "Update cache entry:" << pInfo.getName();
-	mReaderInfoCache.insert(pInfo.getName(), pInfo);
+	auto readerInfos = getReaderInfoSnapshot()->mReaderInfos;
+	readerInfos.insert(pInfo.getName(), pInfo);
+	publishReaderInfos(readerInfos);
 }
 
 
 void ReaderManager::doRemoveCacheEntry(const ReaderInfo& pInfo)
 {
 	qCDebug(card) << "Remove cache entry:" << pInfo.getName();
-	mReaderInfoCache.remove(pInfo.getName());
+	auto readerInfos = getReaderInfoSnapshot()->mReaderInfos;
+	readerInfos.remove(pInfo.getName());
+	publishReaderInfos(readerInfos);
 }
 
 
@@ -238,7 +267,7 @@ void ReaderManager::doFullUpdateCache(const ReaderManagerPlugInInfo& pInfo)
 
 	qCDebug(card) << "Start full update of cache...";
 
-	mReaderInfoCache.clear();
+	QMap<QString, ReaderInfo> readerInfos;
 
 	if (mWorker)
 	{
@@ -252,41 +281,40 @@ void ReaderManager::doFullUpdateCache(const ReaderManagerPlugInInfo& pInfo)
 		for (const auto& info : qAsConst(list))
 		{
 			qCDebug(card) << "Update cache entry:" << info.getName();
-			mReaderInfoCache.insert(info.getName(), info);
+			readerInfos.insert(info.getName(), info);
 		}
 	}
 	else
 	{
 		mPlugInInfoCache.clear();
 	}
+
+	publishReaderInfos(readerInfos);
 }
 
 
 QVector<ReaderInfo> ReaderManager::getReaderInfos(const ReaderFilter& pFilter) const
 {
 	Q_ASSERT(mThread.isRunning() || mThread.isFinished());
-	const QMutexLocker mutexLocker(&mMutex);
-
-#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
-	const auto& list = mReaderInfoCache.values();
-#else
-	const auto& list = mReaderInfoCache.values().toVector(); // clazy:exclude=container-anti-pattern
-#endif
-
-	return pFilter.apply(list);
+	return pFilter.apply(getReaderInfoSnapshot()->mReaderInfoList);
 }
 
 
 ReaderInfo ReaderManager::getReaderInfo(const QString& pReaderName) const
 {
 	Q_ASSERT(mThread.isRunning() || mThread.isFinished());
-	const QMutexLocker mutexLocker(&mMutex);
 
-	const ReaderInfo info = mReaderInfoCache.value(pReaderName);
+	const ReaderInfo info = getReaderInfoSnapshot()->mReaderInfos.value(pReaderName);
 	return info.getName().isEmpty() ? ReaderInfo(pReaderName) : info;
 }
 
 
+quint64 ReaderManager::getReaderInfosVersion() const
+{
+	return getReaderInfoSnapshot()->mVersion;
+}
+
+
 void ReaderManager::updateReaderInfo(const QString& pReaderName)
 {
 	Q_ASSERT(mWorker);
@@ -10,10 +10,13 @@
 #include "ReaderFilter.h"
 #include "ReaderManagerWorker.h"
 
+#include <QMap>
 #include <QMutex>
 #include <QPointer>
 #include <QThread>
 
+#include <memory>
+
 
 namespace governikus
 {
@@ -25,12 +28,28 @@ class ReaderManager
 	friend class Env;
 
 	private:
+		/*!
+		 * Immutable state of all readers. A new snapshot is published on every change,
+		 * so readers never see a partial update and do not need a lock.
+		 */
+		struct ReaderInfoSnapshot
+		{
+			quint64 mVersion;
+			QMap<QString, ReaderInfo> mReaderInfos;
+			QVector<ReaderInfo> mReaderInfoList;
+		};
+
 		mutable QMutex mMutex;
 		QThread mThread;
 		QPointer<ReaderManagerWorker> mWorker;
-		QMap<QString, ReaderInfo> mReaderInfoCache;
+		std::shared_ptr<const ReaderInfoSnapshot> mReaderInfoSnapshot;
 		QMap<ReaderManagerPlugInType, ReaderManagerPlugInInfo> mPlugInInfoCache;
 
+		[[nodiscard]] std::shared_ptr<const ReaderInfoSnapshot> getReaderInfoSnapshot() const;
+
+		// Must only be called by the thread of the ReaderManager
+		void publishReaderInfos(const QMap<QString, ReaderInfo>& pReaderInfos);
+
 	protected:
 		ReaderManager();
 		~ReaderManager() override;
@@ -84,6 +103,12 @@ class ReaderManager
 		ReaderInfo getReaderInfo(const QString& pReaderName) const;
 		void updateReaderInfo(const QString& pReaderName);
 
+		/*!
+		 * Returns the version of the reader infos. It is incremented whenever a reader info
+		 * changes, so a caller can skip its update if the version is unchanged.
+		 */
+		[[nodiscard]] quint64 getReaderInfosVersion() const;
+
 		/*!
 		 * Executes a command to create a CardConnection for a specified reader.
 		 * \param pReaderName The name of the reader.
@@ -6,6 +6,7 @@
 
 #include "Initializer.h"
 #include "Reader.h"
+#include "ReaderThread.h"
 
 #include <QLoggingCategory>
 #include <QPluginLoader>
@@ -23,6 +24,7 @@ INIT_FUNCTION([] {
 ReaderManagerWorker::ReaderManagerWorker()
 	: QObject()
 	, mPlugIns()
+	, mReaderInfos()
 {
 }
 
@@ -102,6 +104,14 @@ void ReaderManagerWorker::registerPlugIn(ReaderManagerPlugIn* pPlugIn)
 
 	mPlugIns << pPlugIn;
 
+	// Readers with an own ReaderThread cannot be asked synchronously, so their latest state is cached.
+	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderAdded, this, &ReaderManagerWorker::onReaderInfoChanged);
+	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderRemoved, this, &ReaderManagerWorker::onReaderRemoved);
+	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderPropertiesUpdated, this, &ReaderManagerWorker::onReaderInfoChanged);
+	connect(pPlugIn, &ReaderManagerPlugIn::fireCardInserted, this, &ReaderManagerWorker::onReaderInfoChanged);
+	connect(pPlugIn, &ReaderManagerPlugIn::fireCardRemoved, this, &ReaderManagerWorker::onReaderInfoChanged);
+	connect(pPlugIn, &ReaderManagerPlugIn::fireCardRetryCounterChanged, this, &ReaderManagerWorker::onReaderInfoChanged);
+
 	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderAdded, this, &ReaderManagerWorker::fireReaderAdded);
 	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderRemoved, this, &ReaderManagerWorker::fireReaderRemoved);
 	connect(pPlugIn, &ReaderManagerPlugIn::fireReaderPropertiesUpdated, this, &ReaderManagerWorker::fireReaderPropertiesUpdated);
@@ -187,6 +197,18 @@ bool ReaderManagerWorker::isScanRunning(ReaderManagerPlugInType pType) const
 }
 
 
+void ReaderManagerWorker::onReaderInfoChanged(const ReaderInfo& pInfo)
+{
+	mReaderInfos.insert(pInfo.getName(), pInfo);
+}
+
+
+void ReaderManagerWorker::onReaderRemoved(const ReaderInfo& pInfo)
+{
+	mReaderInfos.remove(pInfo.getName());
+}
+
+
 QVector<ReaderInfo> ReaderManagerWorker::getReaderInfos() const
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
@@ -197,7 +219,14 @@ QVector<ReaderInfo> ReaderManagerWorker::getReaderInfos() const
 		const auto& readerList = plugIn->getReaders();
 		for (const Reader* const reader : readerList)
 		{
-			list += reader->getReaderInfo();
+			if (reader->thread() == QThread::currentThread())
+			{
+				list += reader->getReaderInfo();
+			}
+			else if (mReaderInfos.contains(reader->getName()))
+			{
+				list += mReaderInfos.value(reader->getName());
+			}
 		}
 	}
 	return list;
@@ -214,7 +243,16 @@ void ReaderManagerWorker::updateReaderInfo(const QString& pReaderName)
 		qCWarning(card) << "Requested reader does not exist:" << pReaderName;
 		return;
 	}
-	reader->update();
+
+	ReaderThread::call(reader, [reader] {
+			reader->update();
+			return reader->getReaderInfo();
+		}, this, [this](const ReaderInfo& pInfo) {
+			if (mReaderInfos.contains(pInfo.getName()))
+			{
+				onReaderInfoChanged(pInfo);
+			}
+		});
 }
 
 
@@ -243,12 +281,23 @@ void ReaderManagerWorker::createCardConnectionWorker(const QString& pReaderName)
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
 
-	QSharedPointer<CardConnectionWorker> worker;
-	if (auto reader = getReader(pReaderName))
+	auto reader = getReader(pReaderName);
+	if (reader == nullptr)
 	{
-		worker = reader->createCardConnectionWorker();
+		Q_EMIT fireCardConnectionWorkerCreated(QSharedPointer<CardConnectionWorker>());
+		return;
 	}
-	Q_EMIT fireCardConnectionWorkerCreated(worker);
+
+	ReaderThread::call(reader, [reader] {
+			const auto worker = reader->createCardConnectionWorker();
+			if (auto* readerThread = qobject_cast<ReaderThread*>(reader->thread()); readerThread && worker)
+			{
+				readerThread->retain(worker.data());
+			}
+			return worker;
+		}, this, [this](const QSharedPointer<CardConnectionWorker>& pWorker) {
+			Q_EMIT fireCardConnectionWorkerCreated(pWorker);
+		});
 }
 
 
@@ -256,17 +305,23 @@ void ReaderManagerWorker::updateRetryCounters()
 {
 	Q_ASSERT(QObject::thread() == QThread::currentThread());
 
-	const auto& readerInfos = getReaderInfos();
-	for (const auto& readerInfo : readerInfos)
+	for (const auto& plugIn : qAsConst(mPlugIns))
 	{
-		QSharedPointer<CardConnectionWorker> worker;
-		if (const auto& reader = getReader(readerInfo.getName()))
+		const auto& readerList = plugIn->getReaders();
+		for (Reader* const reader : readerList)
 		{
-			worker = reader->createCardConnectionWorker();
-			if (worker)
-			{
-				worker->updateRetryCounter();
-			}
+			ReaderThread::call(reader, [reader] {
+					if (const auto worker = reader->createCardConnectionWorker())
+					{
+						worker->updateRetryCounter();
+					}
+					return reader->getReaderInfo();
+				}, this, [this](const ReaderInfo& pInfo) {
+					if (mReaderInfos.contains(pInfo.getName()))
+					{
+						onReaderInfoChanged(pInfo);
+					}
+				});
 		}
 	}
 }
@@ -11,6 +11,7 @@
 #include "ReaderManagerPlugIn.h"
 #include "ReaderManagerPlugInInfo.h"
 
+#include <QMap>
 #include <QObject>
 
 namespace governikus
@@ -22,11 +23,14 @@ class ReaderManagerWorker
 
 	private:
 		QVector<ReaderManagerPlugIn*> mPlugIns;
+		QMap<QString, ReaderInfo> mReaderInfos;
 
 		void registerPlugIns();
 		[[nodiscard]] bool isPlugIn(const QJsonObject& pJson) const;
 		void registerPlugIn(ReaderManagerPlugIn* pPlugIn);
 		[[nodiscard]] Reader* getReader(const QString& pReaderName) const;
+		void onReaderInfoChanged(const ReaderInfo& pInfo);
+		void onReaderRemoved(const ReaderInfo& pInfo);
 
 	public:
 		ReaderManagerWorker();
@@ -0,0 +1,83 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReaderThread.h"
+
+#include <QLoggingCategory>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+ReaderThread::ReaderThread(const QString& pReaderName)
+	: QThread()
+	, mContext(new QObject())
+	, mUsers(0)
+{
+	setObjectName(QStringLiteral("ReaderThread: %1").arg(pReaderName));
+	mContext->moveToThread(this);
+	start();
+}
+
+
+ReaderThread::~ReaderThread()
+{
+	quit();
+	wait();
+	delete mContext;
+	qCDebug(card).noquote() << objectName() << "stopped";
+}
+
+
+void ReaderThread::release()
+{
+	if (!mUsers.deref())
+	{
+		deleteLater();
+	}
+}
+
+
+void ReaderThread::take(Reader* pReader)
+{
+	Q_ASSERT(pReader);
+	Q_ASSERT(pReader->thread() == QThread::currentThread());
+	Q_ASSERT(pReader->parent() == nullptr);
+
+	mUsers.ref();
+	if (auto* card = pReader->getCard())
+	{
+		card->moveToThread(this);
+	}
+	pReader->moveToThread(this);
+}
+
+
+void ReaderThread::retain(QObject* pObject)
+{
+	Q_ASSERT(pObject);
+	Q_ASSERT(pObject->thread() == this);
+
+	mUsers.ref();
+	connect(pObject, &QObject::destroyed, mContext, [this] {
+			release();
+		}, Qt::DirectConnection);
+}
+
+
+void ReaderThread::destroy(Reader* pReader)
+{
+	Q_ASSERT(pReader);
+	Q_ASSERT(pReader->thread() == this);
+
+	QMetaObject::invokeMethod(mContext, [this, pReader] {
+			const auto info = pReader->getReaderInfo();
+			delete pReader;
+			Q_EMIT fireReaderDestroyed(info);
+			release();
+		}, Qt::QueuedConnection);
+}
@@ -0,0 +1,85 @@
+/*!
+ * \brief Dedicated thread for the card I/O of a single reader.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "Reader.h"
+
+#include <QAtomicInt>
+#include <QThread>
+
+
+namespace governikus
+{
+
+/*!
+ * A reader that is moved to its own ReaderThread runs its status updates and all
+ * CardConnectionWorker created by it on that thread. As CardConnection moves every
+ * BaseCardCommand to the thread of its CardConnectionWorker, a slow transmit on one
+ * reader does not block the other readers or the ReaderManagerWorker.
+ *
+ * The thread deletes itself as soon as its reader is destroyed and all objects
+ * registered with retain() are gone.
+ */
+class ReaderThread
+	: public QThread
+{
+	Q_OBJECT
+
+	private:
+		QObject* mContext;
+		QAtomicInt mUsers;
+
+		void release();
+
+	public:
+		explicit ReaderThread(const QString& pReaderName);
+		~ReaderThread() override;
+
+		/*!
+		 * Moves the reader and its current card to this thread. Must be called in
+		 * the thread of the reader.
+		 */
+		void take(Reader* pReader);
+
+		/*!
+		 * Keeps this thread running until the object is destroyed. Must be called
+		 * in this thread for objects that live in this thread.
+		 */
+		void retain(QObject* pObject);
+
+		/*!
+		 * Deletes the reader in this thread without waiting for a running card
+		 * command. The last ReaderInfo is passed with fireReaderDestroyed.
+		 */
+		void destroy(Reader* pReader);
+
+		/*!
+		 * Calls the function in the thread of the reader without waiting for it.
+		 * The result is passed to the callback in the thread of the context.
+		 */
+		template<typename Func, typename Callback>
+		static void call(Reader* pReader, Func pFunc, QObject* pContext, Callback pCallback)
+		{
+			if (pReader->thread() == QThread::currentThread() && pContext->thread() == QThread::currentThread())
+			{
+				pCallback(pFunc());
+				return;
+			}
+
+			QMetaObject::invokeMethod(pReader, [pFunc, pContext, pCallback] {
+					auto result = pFunc();
+					QMetaObject::invokeMethod(pContext, [pCallback, result] {
+							pCallback(result);
+						}, Qt::QueuedConnection);
+				}, Qt::QueuedConnection);
+		}
+
+	Q_SIGNALS:
+		void fireReaderDestroyed(const ReaderInfo& pInfo);
+};
+
+} // namespace governikus
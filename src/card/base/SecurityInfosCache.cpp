@@ -0,0 +1,121 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SecurityInfosCache.h"
+
+#include "SingletonHelper.h"
+
+#include <QCryptographicHash>
+#include <QLoggingCategory>
+#include <QMutexLocker>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+defineSingleton(SecurityInfosCache)
+
+
+const int SecurityInfosCache::MAX_ENTRIES = 8;
+
+
+SecurityInfosCache::SecurityInfosCache()
+	: mMutex()
+	, mEfCardAccessEntries()
+	, mEfCardSecurityEntries()
+	, mHitCount(0)
+	, mMissCount(0)
+{
+}
+
+
+template<typename T, typename Decoder>
+QSharedPointer<T> SecurityInfosCache::lookup(QList<Entry<T> >& pEntries, const QByteArray& pBytes, Decoder pDecoder)
+{
+	const auto& bytesHash = QCryptographicHash::hash(pBytes, QCryptographicHash::Sha256);
+
+	const QMutexLocker locker(&mMutex);
+
+	for (int i = 0; i < pEntries.size(); ++i)
+	{
+		if (pEntries.at(i).mHash == bytesHash)
+		{
+			countLookup(true);
+			pEntries.move(i, 0);
+			return pEntries.first().mValue;
+		}
+	}
+
+	countLookup(false);
+	QSharedPointer<T> value = pDecoder(pBytes);
+	if (value == nullptr)
+	{
+		return value;
+	}
+
+	pEntries.prepend({bytesHash, value});
+	while (pEntries.size() > MAX_ENTRIES)
+	{
+		pEntries.removeLast();
+	}
+
+	return value;
+}
+
+
+void SecurityInfosCache::countLookup(bool pHit)
+{
+	if (pHit)
+	{
+		++mHitCount;
+	}
+	else
+	{
+		++mMissCount;
+	}
+
+	const int lookups = mHitCount + mMissCount;
+	qCDebug(card) << "SecurityInfos cache" << (pHit ? "hit" : "miss") << "| hit rate:" << mHitCount << '/' << lookups;
+}
+
+
+QSharedPointer<EFCardAccess> SecurityInfosCache::getEfCardAccess(const QByteArray& pEfCardAccessBytes)
+{
+	return lookup(mEfCardAccessEntries, pEfCardAccessBytes, [](const QByteArray& pBytes){
+			return EFCardAccess::decode(pBytes);
+		});
+}
+
+
+QSharedPointer<const EFCardSecurity> SecurityInfosCache::getEfCardSecurity(const QByteArray& pEfCardSecurityBytes)
+{
+	return lookup(mEfCardSecurityEntries, pEfCardSecurityBytes, [](const QByteArray& pBytes){
+			return QSharedPointer<const EFCardSecurity>(EFCardSecurity::decode(pBytes));
+		});
+}
+
+
+void SecurityInfosCache::clear()
+{
+	const QMutexLocker locker(&mMutex);
+	mEfCardAccessEntries.clear();
+	mEfCardSecurityEntries.clear();
+}
+
+
+int SecurityInfosCache::getHitCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mHitCount;
+}
+
+
+int SecurityInfosCache::getMissCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mMissCount;
+}
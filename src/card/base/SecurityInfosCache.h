@@ -0,0 +1,81 @@
+/*!
+ * \brief Bounded cache of parsed EF.CardAccess and EF.CardSecurity files.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "asn1/EFCardSecurity.h"
+#include "asn1/SecurityInfos.h"
+#include "Env.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QMutex>
+#include <QSharedPointer>
+
+
+class test_SecurityInfosCache;
+
+
+namespace governikus
+{
+
+/*!
+ * Caches the decoded content of files that were read from a card, keyed by a
+ * SHA-256 of the bytes. The files are always read from the card, so a different
+ * card never gets the data of another one.
+ */
+class SecurityInfosCache
+{
+	Q_GADGET
+
+	friend class Env;
+	friend class ::test_SecurityInfosCache;
+
+	private:
+		template<typename T>
+		struct Entry
+		{
+			QByteArray mHash;
+			QSharedPointer<T> mValue;
+		};
+
+		mutable QMutex mMutex;
+		QList<Entry<EFCardAccess> > mEfCardAccessEntries;
+		QList<Entry<const EFCardSecurity> > mEfCardSecurityEntries;
+		int mHitCount;
+		int mMissCount;
+
+		template<typename T, typename Decoder>
+		QSharedPointer<T> lookup(QList<Entry<T> >& pEntries, const QByteArray& pBytes, Decoder pDecoder);
+		void countLookup(bool pHit);
+
+	protected:
+		SecurityInfosCache();
+		~SecurityInfosCache() = default;
+		static SecurityInfosCache& getInstance();
+
+	public:
+		static const int MAX_ENTRIES;
+
+		/*!
+		 * Returns the parsed EF.CardAccess. The bytes are only decoded if they were not seen before.
+		 * \return the EF.CardAccess or nullptr if the bytes cannot be parsed.
+		 */
+		QSharedPointer<EFCardAccess> getEfCardAccess(const QByteArray& pEfCardAccessBytes);
+
+		/*!
+		 * Returns the parsed EF.CardSecurity. The bytes are only decoded if they were not seen before.
+		 * \return the EF.CardSecurity or nullptr if the bytes cannot be parsed.
+		 */
+		QSharedPointer<const EFCardSecurity> getEfCardSecurity(const QByteArray& pEfCardSecurityBytes);
+
+		void clear();
+
+		[[nodiscard]] int getHitCount() const;
+		[[nodiscard]] int getMissCount() const;
+};
+
+} // namespace governikus
@@ -6,6 +6,7 @@
 
 #include "ASN1TemplateUtil.h"
 #include "ASN1Util.h"
+#include "CVCertificatePool.h"
 #include "pace/ec/EcUtil.h"
 
 #include <QLoggingCategory>
@@ -85,12 +86,12 @@ int CVCertificate::decodeCallback(int pOperation, ASN1_VALUE** pVal, const ASN1_
 }
 
 
-QVector<QSharedPointer<const CVCertificate> > CVCertificate::fromHex(const QByteArrayList& pHexByteList)
+QVector<QSharedPointer<const CVCertificate> > CVCertificate::fromHex(const QByteArrayList& pHexByteList, bool pKeepAlive)
 {
 	QVector<QSharedPointer<const CVCertificate> > cvcs;
 	for (const QByteArray& hexBytes : pHexByteList)
 	{
-		if (auto cvc = CVCertificate::fromHex(hexBytes))
+		if (auto cvc = CVCertificate::fromHex(hexBytes, pKeepAlive))
 		{
 			cvcs += cvc;
 		}
@@ -99,9 +100,9 @@ QVector<QSharedPointer<const CVCertificate> > CVCertificate::fromHex(const QByte
 }
 
 
-QSharedPointer<const CVCertificate> CVCertificate::fromHex(const QByteArray& pHexBytes)
+QSharedPointer<const CVCertificate> CVCertificate::fromHex(const QByteArray& pHexBytes, bool pKeepAlive)
 {
-	return decodeObject<CVCertificate>(QByteArray::fromHex(pHexBytes));
+	return Env::getSingleton<CVCertificatePool>()->get(QByteArray::fromHex(pHexBytes), pKeepAlive);
 }
 
 
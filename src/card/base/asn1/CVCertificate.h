@@ -48,8 +48,12 @@ using CVCertificate = struct cvcertificate_st
 	SIGNATURE* mSignature;
 	ECDSA_SIG* mEcdsaSignature;
 
-	static QVector<QSharedPointer<const cvcertificate_st>> fromHex(const QByteArrayList& pHexByteList);
-	static QSharedPointer<const cvcertificate_st> fromHex(const QByteArray& pHexBytes);
+	/*!
+	 * Identical certificates are decoded once and shared, see CVCertificatePool.
+	 * \param pKeepAlive keeps the certificates decoded until the process ends, e.g. trusted roots.
+	 */
+	static QVector<QSharedPointer<const cvcertificate_st>> fromHex(const QByteArrayList& pHexByteList, bool pKeepAlive = false);
+	static QSharedPointer<const cvcertificate_st> fromHex(const QByteArray& pHexBytes, bool pKeepAlive = false);
 	[[nodiscard]] QByteArray encode() const;
 
 	[[nodiscard]] const CVCertificateBody& getBody() const;
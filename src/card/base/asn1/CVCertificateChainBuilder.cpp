@@ -4,7 +4,14 @@
 
 #include "CVCertificateChainBuilder.h"
 
+#include <QCryptographicHash>
+#include <QGlobalStatic>
 #include <QLoggingCategory>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+#include <algorithm>
 
 using namespace governikus;
 
@@ -12,10 +19,72 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 
 
-bool CVCertificateChainBuilder::isChild(const QSharedPointer<const CVCertificate>& pChild, const QSharedPointer<const CVCertificate>& pParent)
+namespace
 {
-	// self signed CVCs are the root of a chain, no other parent possible.
-	return !pChild->isIssuedBy(*pChild) && pChild->isIssuedBy(*pParent);
+struct VerifiedPath
+{
+	bool mProductive;
+	QByteArray mTrustAnchorsKey;
+	QVector<QSharedPointer<const CVCertificate>> mCvcas;
+
+	[[nodiscard]] bool isEqual(const VerifiedPath& pOther) const
+	{
+		const auto& isEqualCvc = [](const QSharedPointer<const CVCertificate>& pLeft, const QSharedPointer<const CVCertificate>& pRight){
+					return *pLeft == *pRight;
+				};
+
+		return mProductive == pOther.mProductive
+			   && mTrustAnchorsKey == pOther.mTrustAnchorsKey
+			   && std::equal(mCvcas.constBegin(), mCvcas.constEnd(), pOther.mCvcas.constBegin(), pOther.mCvcas.constEnd(), isEqualCvc);
+	}
+
+
+};
+
+struct VerifiedPaths
+{
+	QMutex mMutex;
+	QVector<VerifiedPath> mPaths;
+};
+
+
+QByteArray getTrustAnchorsKey(const QVector<QSharedPointer<const CVCertificate>>& pTrustAnchors)
+{
+	QByteArrayList encodedAnchors;
+	for (const auto& anchor : pTrustAnchors)
+	{
+		encodedAnchors += anchor->encode();
+	}
+
+	// The order of the trust anchors does not matter.
+	std::sort(encodedAnchors.begin(), encodedAnchors.end());
+	QCryptographicHash hash(QCryptographicHash::Sha256);
+	for (const auto& encodedAnchor : qAsConst(encodedAnchors))
+	{
+		hash.addData(encodedAnchor);
+	}
+	return hash.result();
+}
+
+} // namespace
+
+
+Q_GLOBAL_STATIC(VerifiedPaths, verifiedPaths)
+
+
+const int CVCertificateChainBuilder::MAX_VERIFIED_PATHS = 8;
+
+
+bool CVCertificateChainBuilder::isSelfSigned(const CVCertificate& pCvc)
+{
+	return pCvc.isIssuedBy(pCvc);
+}
+
+
+bool CVCertificateChainBuilder::isDocumentVerifier(const CVCertificate& pCvc)
+{
+	const auto role = pCvc.getBody().getCHAT().getAccessRole();
+	return role == AccessRole::DV_od || role == AccessRole::DV_no_f;
 }
 
 
@@ -26,40 +95,196 @@ CVCertificateChainBuilder::CVCertificateChainBuilder(bool pProductive)
 
 
 CVCertificateChainBuilder::CVCertificateChainBuilder(const QVector<QSharedPointer<const CVCertificate> >& pCvcPool, bool pProductive)
-	: ChainBuilder(pCvcPool, &CVCertificateChainBuilder::isChild)
-	, mProductive(pProductive)
+	: mProductive(pProductive)
+	, mCertificatesByChr()
+	, mCertificatesByCar()
 {
-	removeInvalidChains();
-
 	for (const auto& cvc : pCvcPool)
 	{
 		qCDebug(card) << "CVC in pool" << cvc;
+		add(cvc);
+	}
+}
+
+
+void CVCertificateChainBuilder::add(const QSharedPointer<const CVCertificate>& pCvc)
+{
+	if (contains(*pCvc))
+	{
+		return;
 	}
 
-	if (getChains().isEmpty())
+	mCertificatesByChr.insert(pCvc->getBody().getCertificateHolderReference(), pCvc);
+
+	// self signed CVCs are the root of a chain, no other parent possible.
+	if (!isSelfSigned(*pCvc))
 	{
-		qCWarning(card) << "No valid chains could be built";
+		mCertificatesByCar.insert(pCvc->getBody().getCertificationAuthorityReference(), pCvc);
 	}
-	else
+}
+
+
+bool CVCertificateChainBuilder::contains(const CVCertificate& pCvc) const
+{
+	const auto& chr = pCvc.getBody().getCertificateHolderReference();
+	for (auto iter = mCertificatesByChr.constFind(chr); iter != mCertificatesByChr.constEnd() && iter.key() == chr; ++iter)
 	{
-		for (const auto& chain : getChains())
+		if (*iter.value() == pCvc)
 		{
-			qCDebug(card) << "Found valid chain" << chain;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+QVector<QSharedPointer<const CVCertificate> > CVCertificateChainBuilder::getChildren(const CVCertificate& pParent) const
+{
+	QVector<QSharedPointer<const CVCertificate> > children;
+	const auto& chr = pParent.getBody().getCertificateHolderReference();
+	for (auto iter = mCertificatesByCar.constFind(chr); iter != mCertificatesByCar.constEnd() && iter.key() == chr; ++iter)
+	{
+		children += iter.value();
+	}
+	return children;
+}
+
+
+CVCertificateChain CVCertificateChainBuilder::getTerminalPath(const QVector<QSharedPointer<const CVCertificate> >& pPath) const
+{
+	const auto& children = getChildren(*pPath.last());
+	for (const auto& child : children)
+	{
+		auto path = pPath;
+		path += child;
+		CVCertificateChain chain(path, mProductive);
+		if (chain.isValid())
+		{
+			return chain;
+		}
+	}
+
+	return CVCertificateChain(mProductive);
+}
+
+
+CVCertificateChain CVCertificateChainBuilder::buildChain(const QSharedPointer<const CVCertificate>& pChainRoot) const
+{
+	// Breadth-first search, every CHR is visited once as all CVCs of a CHR have the same children.
+	QVector<QVector<QSharedPointer<const CVCertificate> > > paths;
+	paths += QVector<QSharedPointer<const CVCertificate> >({pChainRoot});
+	QSet<QByteArray> visited({pChainRoot->getBody().getCertificateHolderReference()});
+
+	for (int i = 0; i < paths.size(); ++i)
+	{
+		const auto path = paths.at(i);
+		if (isDocumentVerifier(*path.last()))
+		{
+			if (const auto& chain = getTerminalPath(path); chain.isValid())
+			{
+				return chain;
+			}
+			continue;
+		}
+
+		const auto& children = getChildren(*path.last());
+		for (const auto& child : children)
+		{
+			const auto& chr = child->getBody().getCertificateHolderReference();
+			if (!visited.contains(chr))
+			{
+				visited.insert(chr);
+				auto extendedPath = path;
+				extendedPath += child;
+				paths += extendedPath;
+			}
 		}
 	}
+
+	return CVCertificateChain(mProductive);
 }
 
 
-void CVCertificateChainBuilder::removeInvalidChains()
+CVCertificateChain CVCertificateChainBuilder::getVerifiedChain(const CVCertificate& pChainRoot, const QByteArray& pTrustAnchorsKey) const
 {
-	QMutableVectorIterator<QVector<QSharedPointer<const CVCertificate> > > chainIter(mChains);
-	while (chainIter.hasNext())
+	QVector<VerifiedPath> paths;
 	{
-		if (!CVCertificateChain(chainIter.next(), mProductive).isValid())
+		const QMutexLocker locker(&verifiedPaths->mMutex);
+		paths = verifiedPaths->mPaths;
+	}
+
+	for (const auto& path : qAsConst(paths))
+	{
+		if (path.mProductive != mProductive || path.mTrustAnchorsKey != pTrustAnchorsKey || *path.mCvcas.first() != pChainRoot)
+		{
+			continue;
+		}
+
+		const auto& children = getChildren(*path.mCvcas.last());
+		for (const auto& child : children)
 		{
-			chainIter.remove();
+			if (!isDocumentVerifier(*child))
+			{
+				continue;
+			}
+
+			auto extendedPath = path.mCvcas;
+			extendedPath += child;
+			if (const auto& chain = getTerminalPath(extendedPath); chain.isValid())
+			{
+				return chain;
+			}
 		}
 	}
+
+	return CVCertificateChain(mProductive);
+}
+
+
+void CVCertificateChainBuilder::addVerifiedChain(const CVCertificateChain& pChain, const QVector<QSharedPointer<const CVCertificate> >& pTrustAnchors)
+{
+	if (pTrustAnchors.isEmpty())
+	{
+		return;
+	}
+
+	VerifiedPath verifiedPath {pChain.isProductive(), getTrustAnchorsKey(pTrustAnchors), {}};
+	for (const auto& cvc : pChain)
+	{
+		if (cvc->getBody().getCHAT().getAccessRole() != AccessRole::CVCA)
+		{
+			break;
+		}
+		verifiedPath.mCvcas += cvc;
+	}
+
+	if (verifiedPath.mCvcas.isEmpty())
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&verifiedPaths->mMutex);
+	auto& paths = verifiedPaths->mPaths;
+	const auto known = std::find_if(paths.begin(), paths.end(), [&verifiedPath](const VerifiedPath& pPath){
+			return pPath.isEqual(verifiedPath);
+		});
+	if (known != paths.end())
+	{
+		paths.erase(known);
+	}
+
+	paths.prepend(verifiedPath);
+	if (paths.size() > MAX_VERIFIED_PATHS)
+	{
+		paths.removeLast();
+	}
+}
+
+
+void CVCertificateChainBuilder::clearVerifiedChains()
+{
+	const QMutexLocker locker(&verifiedPaths->mMutex);
+	verifiedPaths->mPaths.clear();
 }
 
 
@@ -82,20 +307,13 @@ CVCertificateChain CVCertificateChainBuilder::getChainForCertificationAuthority(
 CVCertificateChain CVCertificateChainBuilder::getChainForCertificationAuthority(const QByteArray& pCar) const
 {
 	qCDebug(card) << "Get chain for authority" << pCar;
-	for (const auto& chain : getChains())
+	for (auto iter = mCertificatesByCar.constFind(pCar); iter != mCertificatesByCar.constEnd() && iter.key() == pCar; ++iter)
 	{
-		for (int i = 0; i < chain.length(); ++i)
+		const auto& chain = buildChain(iter.value());
+		if (chain.isValid())
 		{
-			auto cert = chain.at(i);
-			if (cert->getBody().getCertificationAuthorityReference() == pCar && !cert->isIssuedBy(*cert))
-			{
-				CVCertificateChain subChain(chain.mid(i), mProductive);
-				if (subChain.isValid())
-				{
-					qCDebug(card) << "Found valid chain" << subChain;
-					return subChain;
-				}
-			}
+			qCDebug(card) << "Found valid chain" << chain;
+			return chain;
 		}
 	}
 	qCWarning(card) << "Cannot find a valid chain for authority" << pCar;
@@ -103,24 +321,31 @@ CVCertificateChain CVCertificateChainBuilder::getChainForCertificationAuthority(
 }
 
 
-CVCertificateChain CVCertificateChainBuilder::getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot) const
+CVCertificateChain CVCertificateChainBuilder::getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot, const QVector<QSharedPointer<const CVCertificate> >& pTrustAnchors) const
 {
 	qCDebug(card) << "Get chain for root" << pChainRoot;
-	for (const auto& chain : getChains())
+
+	CVCertificateChain chain(mProductive);
+	if (!pTrustAnchors.isEmpty())
 	{
-		for (int i = 0; i < chain.length(); ++i)
+		chain = getVerifiedChain(*pChainRoot, getTrustAnchorsKey(pTrustAnchors));
+		if (chain.isValid())
 		{
-			if (*chain.at(i) == *pChainRoot)
-			{
-				CVCertificateChain subChain(chain.mid(i), mProductive);
-				if (subChain.isValid())
-				{
-					qCDebug(card) << "Found valid chain" << subChain;
-					return subChain;
-				}
-			}
+			qCDebug(card) << "Found verified chain" << chain;
+			return chain;
+		}
+	}
+
+	if (contains(*pChainRoot))
+	{
+		chain = buildChain(pChainRoot);
+		if (chain.isValid())
+		{
+			qCDebug(card) << "Found valid chain" << chain;
+			return chain;
 		}
 	}
+
 	qCWarning(card) << "Cannot find a valid chain for root" << pChainRoot;
 	return CVCertificateChain(mProductive);
 }
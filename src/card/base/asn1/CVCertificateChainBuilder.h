@@ -6,27 +6,58 @@
 
 #pragma once
 
-#include "ChainBuilder.h"
 #include "CVCertificate.h"
 #include "CVCertificateChain.h"
 #include "EstablishPaceChannelOutput.h"
 
+#include <QByteArray>
+#include <QMultiHash>
+#include <QSharedPointer>
+#include <QVector>
+
+class test_CVCertificateChainBuilder;
+class test_StatePreVerification;
 
 namespace governikus
 {
 
+/*!
+ * The CVCs of the pool are indexed by their Certificate Holder Reference (CHR) and
+ * their Certification Authority Reference (CAR). A chain is only searched when it is
+ * requested, starting at the requested certificate and following the CAR/CHR relation
+ * down to a terminal CVC.
+ *
+ * The CVCA part of chains that passed the pre-verification is kept for the whole
+ * process, so later authentications of the same terminal find their chain even
+ * without parsing the link certificates again. It is only used if the chain is
+ * requested with the same trust anchors that were used for the verification.
+ */
 class CVCertificateChainBuilder
-	: private ChainBuilder<QSharedPointer<const CVCertificate>>
 {
+	friend class ::test_CVCertificateChainBuilder;
+	friend class ::test_StatePreVerification;
+
 	private:
+		static const int MAX_VERIFIED_PATHS;
+
 		bool mProductive;
+		QMultiHash<QByteArray, QSharedPointer<const CVCertificate>> mCertificatesByChr;
+		QMultiHash<QByteArray, QSharedPointer<const CVCertificate>> mCertificatesByCar;
 
-		static bool isChild(const QSharedPointer<const CVCertificate>& pChild, const QSharedPointer<const CVCertificate>& pParent);
+		static bool isSelfSigned(const CVCertificate& pCvc);
+		static bool isDocumentVerifier(const CVCertificate& pCvc);
 
-		void removeInvalidChains();
+		void add(const QSharedPointer<const CVCertificate>& pCvc);
+		[[nodiscard]] bool contains(const CVCertificate& pCvc) const;
+		[[nodiscard]] QVector<QSharedPointer<const CVCertificate>> getChildren(const CVCertificate& pParent) const;
+		[[nodiscard]] CVCertificateChain getTerminalPath(const QVector<QSharedPointer<const CVCertificate>>& pPath) const;
+		[[nodiscard]] CVCertificateChain buildChain(const QSharedPointer<const CVCertificate>& pChainRoot) const;
+		[[nodiscard]] CVCertificateChain getVerifiedChain(const CVCertificate& pChainRoot, const QByteArray& pTrustAnchorsKey) const;
 
 		[[nodiscard]] CVCertificateChain getChainForCertificationAuthority(const QByteArray& pCar) const;
 
+		static void clearVerifiedChains();
+
 	public:
 		explicit CVCertificateChainBuilder(bool pProductive = true);
 
@@ -44,8 +75,11 @@ class CVCertificateChainBuilder
 		 * If no chain starting with the given root CVC could be found or any other error
 		 * occurred ( e.g. the last element in the list is no terminal CVC), an invalid chain
 		 * is returned (see CVCertificateChain::isValid()).
+		 *
+		 * Verified chains are only taken into account for the given trust anchors.
 		 */
-		[[nodiscard]] CVCertificateChain getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot) const;
+		[[nodiscard]] CVCertificateChain getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot,
+				const QVector<QSharedPointer<const CVCertificate>>& pTrustAnchors = QVector<QSharedPointer<const CVCertificate>>()) const;
 
 
 		/*!
@@ -60,6 +94,14 @@ class CVCertificateChainBuilder
 		 * returned (see CVCertificateChain::isValid()).
 		 */
 		[[nodiscard]] CVCertificateChain getChainForCertificationAuthority(const EstablishPaceChannelOutput& pPaceOutput) const;
+
+
+		/*!
+		 * Remembers the CVCA part of a chain whose signatures were verified against the
+		 * trust anchors. Later calls of getChainStartingWith() with the same root and
+		 * the same trust anchors use it, even if the link certificates are not part of the pool.
+		 */
+		static void addVerifiedChain(const CVCertificateChain& pChain, const QVector<QSharedPointer<const CVCertificate>>& pTrustAnchors);
 };
 
 } // namespace governikus
@@ -0,0 +1,157 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "CVCertificatePool.h"
+
+#include "ASN1TemplateUtil.h"
+#include "SingletonHelper.h"
+
+#include <QCryptographicHash>
+#include <QLoggingCategory>
+#include <QMutexLocker>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+defineSingleton(CVCertificatePool)
+
+
+const int CVCertificatePool::PRUNE_SIZE = 64;
+
+
+CVCertificatePool::CVCertificatePool()
+	: mMutex()
+	, mCertificates()
+	, mKeptAlive()
+	, mHitCount(0)
+	, mMissCount(0)
+{
+}
+
+
+void CVCertificatePool::countLookup(bool pHit)
+{
+	if (pHit)
+	{
+		++mHitCount;
+	}
+	else
+	{
+		++mMissCount;
+	}
+
+	const int lookups = mHitCount + mMissCount;
+	qCDebug(card) << "CVCertificate pool" << (pHit ? "hit" : "miss") << "| hit rate:" << mHitCount << '/' << lookups;
+}
+
+
+void CVCertificatePool::keepAlive(const QSharedPointer<const CVCertificate>& pCvc)
+{
+	if (!mKeptAlive.contains(pCvc))
+	{
+		mKeptAlive += pCvc;
+	}
+}
+
+
+void CVCertificatePool::removeExpired()
+{
+	for (auto iter = mCertificates.begin(); iter != mCertificates.end();)
+	{
+		if (iter.value().isNull())
+		{
+			iter = mCertificates.erase(iter);
+			continue;
+		}
+		++iter;
+	}
+}
+
+
+QSharedPointer<const CVCertificate> CVCertificatePool::get(const QByteArray& pDer, bool pKeepAlive)
+{
+	const QByteArray key = QCryptographicHash::hash(pDer, QCryptographicHash::Sha256);
+
+	{
+		const QMutexLocker locker(&mMutex);
+		if (const auto cvc = mCertificates.value(key).toStrongRef())
+		{
+			countLookup(true);
+			if (pKeepAlive)
+			{
+				keepAlive(cvc);
+			}
+			return cvc;
+		}
+		countLookup(false);
+	}
+
+	// Decode without holding the lock, the decoding is the expensive part.
+	QSharedPointer<const CVCertificate> cvc = decodeObject<CVCertificate>(pDer);
+	if (cvc.isNull())
+	{
+		return cvc;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	if (const auto concurrent = mCertificates.value(key).toStrongRef())
+	{
+		cvc = concurrent;
+	}
+	else
+	{
+		if (mCertificates.size() >= PRUNE_SIZE)
+		{
+			removeExpired();
+		}
+		mCertificates.insert(key, cvc);
+	}
+
+	if (pKeepAlive)
+	{
+		keepAlive(cvc);
+	}
+	return cvc;
+}
+
+
+void CVCertificatePool::clear()
+{
+	const QMutexLocker locker(&mMutex);
+	mCertificates.clear();
+	mKeptAlive.clear();
+}
+
+
+int CVCertificatePool::size() const
+{
+	const QMutexLocker locker(&mMutex);
+	int count = 0;
+	for (const auto& cvc : mCertificates)
+	{
+		if (!cvc.isNull())
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+
+int CVCertificatePool::getHitCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mHitCount;
+}
+
+
+int CVCertificatePool::getMissCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mMissCount;
+}
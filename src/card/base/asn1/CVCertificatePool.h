@@ -0,0 +1,74 @@
+/*!
+ * \brief Process wide pool of decoded card verifiable certificates.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "asn1/CVCertificate.h"
+#include "Env.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QVector>
+#include <QWeakPointer>
+
+
+class test_CVCertificatePool;
+
+
+namespace governikus
+{
+
+/*!
+ * The CVCA and DV certificates of every authentication are the same ones, so
+ * each distinct certificate is decoded once and shared by all users. The pool
+ * is keyed by the SHA-256 hash of the DER encoding and only holds weak
+ * references. Certificates that are kept alive stay in the pool for the whole
+ * process, e.g. the trusted roots of the SecureStorage.
+ *
+ * \note A certificate of the pool is shared between threads and must never be modified.
+ */
+class CVCertificatePool
+{
+	Q_GADGET
+
+	friend class Env;
+	friend class ::test_CVCertificatePool;
+
+	private:
+		mutable QMutex mMutex;
+		QHash<QByteArray, QWeakPointer<const CVCertificate>> mCertificates;
+		QVector<QSharedPointer<const CVCertificate>> mKeptAlive;
+		int mHitCount;
+		int mMissCount;
+
+		void countLookup(bool pHit);
+		void keepAlive(const QSharedPointer<const CVCertificate>& pCvc);
+		void removeExpired();
+
+	protected:
+		CVCertificatePool();
+		~CVCertificatePool() = default;
+		static CVCertificatePool& getInstance();
+
+	public:
+		static const int PRUNE_SIZE;
+
+		/*!
+		 * Returns the certificate with the given DER encoding and decodes it only if
+		 * it is not in the pool. Certificates that cannot be decoded are not stored.
+		 * \param pKeepAlive keeps the certificate in the pool until the process ends.
+		 */
+		QSharedPointer<const CVCertificate> get(const QByteArray& pDer, bool pKeepAlive = false);
+		void clear();
+
+		[[nodiscard]] int size() const;
+		[[nodiscard]] int getHitCount() const;
+		[[nodiscard]] int getMissCount() const;
+};
+
+} // namespace governikus
@@ -0,0 +1,104 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PaceAlgorithm.h"
+
+#include <algorithm>
+#include <iterator>
+
+
+using namespace governikus;
+
+
+namespace
+{
+#define PACE_OID(suffix) "0.4.0.127.0.7.2.2.4." suffix
+
+constexpr PaceAlgorithm PACE_ALGORITHMS[] = {
+	{PACE_OID("1.1"), KeyAgreementType::DH, MappingType::GM, PaceCipher::DES3_CBC_CBC, 16, QCryptographicHash::Sha1},
+	{PACE_OID("1.2"), KeyAgreementType::DH, MappingType::GM, PaceCipher::AES_CBC_CMAC_128, 16, QCryptographicHash::Sha1},
+	{PACE_OID("1.3"), KeyAgreementType::DH, MappingType::GM, PaceCipher::AES_CBC_CMAC_192, 24, QCryptographicHash::Sha256},
+	{PACE_OID("1.4"), KeyAgreementType::DH, MappingType::GM, PaceCipher::AES_CBC_CMAC_256, 32, QCryptographicHash::Sha256},
+	{PACE_OID("2.1"), KeyAgreementType::ECDH, MappingType::GM, PaceCipher::DES3_CBC_CBC, 16, QCryptographicHash::Sha1},
+	{PACE_OID("2.2"), KeyAgreementType::ECDH, MappingType::GM, PaceCipher::AES_CBC_CMAC_128, 16, QCryptographicHash::Sha1},
+	{PACE_OID("2.3"), KeyAgreementType::ECDH, MappingType::GM, PaceCipher::AES_CBC_CMAC_192, 24, QCryptographicHash::Sha256},
+	{PACE_OID("2.4"), KeyAgreementType::ECDH, MappingType::GM, PaceCipher::AES_CBC_CMAC_256, 32, QCryptographicHash::Sha256},
+	{PACE_OID("3.1"), KeyAgreementType::DH, MappingType::IM, PaceCipher::DES3_CBC_CBC, 16, QCryptographicHash::Sha1},
+	{PACE_OID("3.2"), KeyAgreementType::DH, MappingType::IM, PaceCipher::AES_CBC_CMAC_128, 16, QCryptographicHash::Sha1},
+	{PACE_OID("3.3"), KeyAgreementType::DH, MappingType::IM, PaceCipher::AES_CBC_CMAC_192, 24, QCryptographicHash::Sha256},
+	{PACE_OID("3.4"), KeyAgreementType::DH, MappingType::IM, PaceCipher::AES_CBC_CMAC_256, 32, QCryptographicHash::Sha256},
+	{PACE_OID("4.1"), KeyAgreementType::ECDH, MappingType::IM, PaceCipher::DES3_CBC_CBC, 16, QCryptographicHash::Sha1},
+	{PACE_OID("4.2"), KeyAgreementType::ECDH, MappingType::IM, PaceCipher::AES_CBC_CMAC_128, 16, QCryptographicHash::Sha1},
+	{PACE_OID("4.3"), KeyAgreementType::ECDH, MappingType::IM, PaceCipher::AES_CBC_CMAC_192, 24, QCryptographicHash::Sha256},
+	{PACE_OID("4.4"), KeyAgreementType::ECDH, MappingType::IM, PaceCipher::AES_CBC_CMAC_256, 32, QCryptographicHash::Sha256}
+};
+
+#undef PACE_OID
+
+
+constexpr int compareOid(const char* pLeft, const char* pRight)
+{
+	for (; *pLeft != '\0' && *pLeft == *pRight; ++pLeft, ++pRight)
+	{
+	}
+
+	return static_cast<unsigned char>(*pLeft) - static_cast<unsigned char>(*pRight);
+}
+
+
+constexpr bool isSorted()
+{
+	for (size_t i = 1; i < std::size(PACE_ALGORITHMS); ++i)
+	{
+		if (compareOid(PACE_ALGORITHMS[i - 1].mOid, PACE_ALGORITHMS[i].mOid) >= 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+static_assert(isSorted(), "PACE_ALGORITHMS must be sorted by OID for the binary search");
+
+} // namespace
+
+
+const EVP_CIPHER* PaceAlgorithm::getCipher() const
+{
+	switch (mCipher)
+	{
+		case PaceCipher::DES3_CBC_CBC:
+			return nullptr;
+
+		case PaceCipher::AES_CBC_CMAC_128:
+			return EVP_aes_128_cbc();
+
+		case PaceCipher::AES_CBC_CMAC_192:
+			return EVP_aes_192_cbc();
+
+		case PaceCipher::AES_CBC_CMAC_256:
+			return EVP_aes_256_cbc();
+	}
+
+	Q_UNREACHABLE();
+	return nullptr;
+}
+
+
+const PaceAlgorithm* PaceAlgorithm::fromOid(const QByteArray& pOid)
+{
+	const auto* end = std::end(PACE_ALGORITHMS);
+	const auto* algorithm = std::lower_bound(std::begin(PACE_ALGORITHMS), end, pOid, [](const PaceAlgorithm& pAlgorithm, const QByteArray& pValue){
+			return qstrcmp(pAlgorithm.mOid, pValue.constData()) < 0;
+		});
+
+	if (algorithm == end || qstrcmp(algorithm->mOid, pOid.constData()) != 0)
+	{
+		return nullptr;
+	}
+
+	return algorithm;
+}
@@ -0,0 +1,58 @@
+/*!
+ * \brief Registry of the PACE protocol OIDs and the algorithms they select. See TR 03110 Part 3 A.1.1.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "PaceInfo.h"
+
+#include <openssl/evp.h>
+#include <QByteArray>
+#include <QCryptographicHash>
+
+
+namespace governikus
+{
+
+enum class PaceCipher
+{
+	DES3_CBC_CBC,
+	AES_CBC_CMAC_128,
+	AES_CBC_CMAC_192,
+	AES_CBC_CMAC_256
+};
+
+
+struct PaceAlgorithm
+{
+	const char* mOid;
+	KeyAgreementType mKeyAgreementType;
+	MappingType mMappingType;
+	PaceCipher mCipher;
+	int mKeySize;
+	QCryptographicHash::Algorithm mHashAlgorithm;
+
+	/*!
+	 * 3DES is defined by the specification but not supported.
+	 */
+	[[nodiscard]] bool isSupported() const
+	{
+		return mCipher != PaceCipher::DES3_CBC_CBC;
+	}
+
+
+	/*!
+	 * \return the cipher for SM and CMAC or nullptr if not supported.
+	 */
+	[[nodiscard]] const EVP_CIPHER* getCipher() const;
+
+	/*!
+	 * Resolves a PACE protocol OID like "0.4.0.127.0.7.2.2.4.2.2".
+	 * \return the descriptor or nullptr if the OID is not a PACE protocol.
+	 */
+	static const PaceAlgorithm* fromOid(const QByteArray& pOid);
+};
+
+} // namespace governikus
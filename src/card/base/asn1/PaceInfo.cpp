@@ -5,14 +5,13 @@
 
 #include "ASN1TemplateUtil.h"
 #include "ASN1Util.h"
-#include "KnownOIDs.h"
+#include "PaceAlgorithm.h"
 #include "PaceInfo.h"
 
 #include <QLoggingCategory>
 
 
 using namespace governikus;
-using namespace governikus::KnownOIDs;
 
 
 Q_DECLARE_LOGGING_CATEGORY(card)
@@ -51,30 +50,17 @@ void freeAsn1Object<paceinfo_st>(paceinfo_st* pObject)
 
 bool PaceInfo::acceptsProtocol(const ASN1_OBJECT* pObjectIdentifier)
 {
-	const auto protocol = Asn1ObjectUtil::convertTo(pObjectIdentifier);
-	return protocol == id_PACE::DH::GM_3DES_CBC_CBC
-		   || protocol == id_PACE::DH::GM_AES_CBC_CMAC_128
-		   || protocol == id_PACE::DH::GM_AES_CBC_CMAC_192
-		   || protocol == id_PACE::DH::GM_AES_CBC_CMAC_256
-		   || protocol == id_PACE::ECDH::GM_3DES_CBC_CBC
-		   || protocol == id_PACE::ECDH::GM_AES_CBC_CMAC_128
-		   || protocol == id_PACE::ECDH::GM_AES_CBC_CMAC_192
-		   || protocol == id_PACE::ECDH::GM_AES_CBC_CMAC_256
-		   || protocol == id_PACE::DH::IM_3DES_CBC_CBC
-		   || protocol == id_PACE::DH::IM_AES_CBC_CMAC_128
-		   || protocol == id_PACE::DH::IM_AES_CBC_CMAC_192
-		   || protocol == id_PACE::DH::IM_AES_CBC_CMAC_256
-		   || protocol == id_PACE::ECDH::IM_3DES_CBC_CBC
-		   || protocol == id_PACE::ECDH::IM_AES_CBC_CMAC_128
-		   || protocol == id_PACE::ECDH::IM_AES_CBC_CMAC_192
-		   || protocol == id_PACE::ECDH::IM_AES_CBC_CMAC_256;
+	return PaceAlgorithm::fromOid(Asn1ObjectUtil::convertTo(pObjectIdentifier)) != nullptr;
 }
 
 
 PaceInfo::PaceInfo(const QSharedPointer<const paceinfo_st>& pDelegate)
 	: SecurityInfo()
 	, mDelegate(pDelegate)
+	, mPaceAlgorithm(PaceAlgorithm::fromOid(Asn1ObjectUtil::convertTo(pDelegate->mProtocol)))
 {
+	Q_ASSERT(mPaceAlgorithm);
+
 	if (getVersion() != 2)
 	{
 		qCWarning(card) << "Expect version=2, got: " << getVersion();
@@ -107,31 +93,19 @@ int PaceInfo::getVersion() const
 
 KeyAgreementType PaceInfo::getKeyAgreementType() const
 {
-	const auto& protocol = getProtocol();
-	if (protocol.startsWith(toByteArray(KnownOIDs::id_PACE::DH::GM))
-			|| protocol.startsWith(toByteArray(KnownOIDs::id_PACE::DH::IM)))
-	{
-		return KeyAgreementType::DH;
-	}
-	else
-	{
-		return KeyAgreementType::ECDH;
-	}
+	return mPaceAlgorithm->mKeyAgreementType;
 }
 
 
 MappingType PaceInfo::getMappingType() const
 {
-	const auto& protocol = getProtocol();
-	if (protocol.startsWith(toByteArray(KnownOIDs::id_PACE::DH::GM))
-			|| protocol.startsWith(toByteArray(KnownOIDs::id_PACE::ECDH::GM)))
-	{
-		return MappingType::GM;
-	}
-	else
-	{
-		return MappingType::IM;
-	}
+	return mPaceAlgorithm->mMappingType;
+}
+
+
+const PaceAlgorithm& PaceInfo::getPaceAlgorithm() const
+{
+	return *mPaceAlgorithm;
 }
 
 
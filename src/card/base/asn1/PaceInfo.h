@@ -13,6 +13,9 @@
 namespace governikus
 {
 
+struct PaceAlgorithm;
+
+
 /*!
  * Method used for key agreement:
  * * DH, i.e. Diffie-Hellman
@@ -63,6 +66,7 @@ class PaceInfo
 	friend class QSharedPointer<PaceInfo>;
 
 	const QSharedPointer<const paceinfo_st> mDelegate;
+	const PaceAlgorithm* const mPaceAlgorithm;
 
 	explicit PaceInfo(const QSharedPointer<const paceinfo_st>& pDelegate);
 	[[nodiscard]] ASN1_OBJECT* getProtocolObjectIdentifier() const override;
@@ -88,6 +92,11 @@ class PaceInfo
 		[[nodiscard]] KeyAgreementType getKeyAgreementType() const;
 		[[nodiscard]] MappingType getMappingType() const;
 		[[nodiscard]] bool isStandardizedDomainParameters() const;
+
+		/*!
+		 * The descriptor is resolved once from the protocol OID.
+		 */
+		[[nodiscard]] const PaceAlgorithm& getPaceAlgorithm() const;
 };
 
 
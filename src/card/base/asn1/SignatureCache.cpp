@@ -0,0 +1,113 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SignatureCache.h"
+
+#include "SingletonHelper.h"
+
+#include <QCryptographicHash>
+#include <QLoggingCategory>
+#include <QMutexLocker>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card)
+
+
+defineSingleton(SignatureCache)
+
+
+const int SignatureCache::MAX_ENTRIES = 256;
+
+
+SignatureCache::SignatureCache()
+	: mMutex()
+	, mEntries(MAX_ENTRIES)
+	, mHitCount(0)
+	, mMissCount(0)
+{
+}
+
+
+void SignatureCache::countLookup(bool pHit)
+{
+	if (pHit)
+	{
+		++mHitCount;
+	}
+	else
+	{
+		++mMissCount;
+	}
+
+	const int lookups = mHitCount + mMissCount;
+	qCDebug(card) << "Signature cache" << (pHit ? "hit" : "miss") << "| hit rate:" << mHitCount << '/' << lookups;
+}
+
+
+QByteArray SignatureCache::createKey(const QByteArray& pPublicKey, const QByteArray& pTbsHash, const QByteArray& pSignature)
+{
+	// The hashes have a fixed length, so the concatenation is unambiguous.
+	return QCryptographicHash::hash(pPublicKey, QCryptographicHash::Sha256)
+		   + QCryptographicHash::hash(pTbsHash, QCryptographicHash::Sha256)
+		   + pSignature;
+}
+
+
+bool SignatureCache::isVerified(const QByteArray& pKey, const QDateTime& pValidationDate)
+{
+	const QMutexLocker locker(&mMutex);
+
+	const QDateTime* expirationDate = mEntries.object(pKey);
+	if (expirationDate && *expirationDate < pValidationDate)
+	{
+		mEntries.remove(pKey);
+		expirationDate = nullptr;
+	}
+
+	countLookup(expirationDate != nullptr);
+	return expirationDate != nullptr;
+}
+
+
+void SignatureCache::addVerified(const QByteArray& pKey, const QDateTime& pExpirationDate, const QDateTime& pValidationDate)
+{
+	if (!pExpirationDate.isValid() || pExpirationDate < pValidationDate)
+	{
+		return;
+	}
+
+	const QMutexLocker locker(&mMutex);
+	mEntries.insert(pKey, new QDateTime(pExpirationDate));
+}
+
+
+void SignatureCache::clear()
+{
+	const QMutexLocker locker(&mMutex);
+	mEntries.clear();
+}
+
+
+int SignatureCache::size() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mEntries.size();
+}
+
+
+int SignatureCache::getHitCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mHitCount;
+}
+
+
+int SignatureCache::getMissCount() const
+{
+	const QMutexLocker locker(&mMutex);
+	return mMissCount;
+}
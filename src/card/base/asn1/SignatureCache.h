@@ -0,0 +1,75 @@
+/*!
+ * \brief Bounded cache of successfully verified signatures.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "Env.h"
+
+#include <QByteArray>
+#include <QCache>
+#include <QDateTime>
+#include <QMutex>
+
+
+class test_SignatureCache;
+
+
+namespace governikus
+{
+
+/*!
+ * The CVCA, link and DV certificates are the same for every authentication with
+ * the same eService, so their signatures are only verified once. Only successful
+ * verifications are stored. An entry expires with the certificates it belongs to.
+ */
+class SignatureCache
+{
+	Q_GADGET
+
+	friend class Env;
+	friend class ::test_SignatureCache;
+
+	private:
+		mutable QMutex mMutex;
+		QCache<QByteArray, QDateTime> mEntries;
+		int mHitCount;
+		int mMissCount;
+
+		void countLookup(bool pHit);
+
+	protected:
+		SignatureCache();
+		~SignatureCache() = default;
+		static SignatureCache& getInstance();
+
+	public:
+		static const int MAX_ENTRIES;
+
+		/*!
+		 * Creates the key of a signature.
+		 * \param pPublicKey identifies the public key of the issuer including its domain parameters.
+		 * \param pTbsHash the hash of the signed data.
+		 * \param pSignature the signature itself.
+		 */
+		static QByteArray createKey(const QByteArray& pPublicKey, const QByteArray& pTbsHash, const QByteArray& pSignature);
+
+		/*!
+		 * Returns true if the signature was verified before and did not expire on the validation date.
+		 */
+		[[nodiscard]] bool isVerified(const QByteArray& pKey, const QDateTime& pValidationDate = QDateTime::currentDateTime());
+
+		/*!
+		 * Remembers a successfully verified signature until the expiration date.
+		 */
+		void addVerified(const QByteArray& pKey, const QDateTime& pExpirationDate, const QDateTime& pValidationDate = QDateTime::currentDateTime());
+		void clear();
+
+		[[nodiscard]] int size() const;
+		[[nodiscard]] int getHitCount() const;
+		[[nodiscard]] int getMissCount() const;
+};
+
+} // namespace governikus
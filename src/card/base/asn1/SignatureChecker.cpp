@@ -5,8 +5,10 @@
 #include "asn1/SignatureChecker.h"
 
 #include "ASN1TemplateUtil.h"
+#include "asn1/SignatureCache.h"
 #include "pace/ec/EcUtil.h"
 
+#include <openssl/ec.h>
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
@@ -18,8 +20,36 @@ using namespace governikus;
 Q_DECLARE_LOGGING_CATEGORY(card)
 
 
-SignatureChecker::SignatureChecker(const QVector<QSharedPointer<const CVCertificate> >& pCertificateChain)
+namespace
+{
+QByteArray encodeParameters(const EC_GROUP* pGroup)
+{
+	const int size = i2d_ECPKParameters(pGroup, nullptr);
+	if (size <= 0)
+	{
+		return QByteArray();
+	}
+
+	QByteArray parameters(size, Qt::Uninitialized);
+	auto* data = reinterpret_cast<uchar*>(parameters.data());
+	i2d_ECPKParameters(pGroup, &data);
+	return parameters;
+}
+
+
+QDateTime getExpirationDate(const CVCertificate& pCert, const CVCertificate& pSigningCert)
+{
+	const QDate expirationDate = qMin(pCert.getBody().getCertificateExpirationDate(), pSigningCert.getBody().getCertificateExpirationDate());
+	return QDateTime(expirationDate.addDays(1), QTime(0, 0), Qt::UTC);
+}
+
+
+} // namespace
+
+
+SignatureChecker::SignatureChecker(const QVector<QSharedPointer<const CVCertificate> >& pCertificateChain, const QDateTime& pValidationDate)
 	: mCertificateChain(pCertificateChain)
+	, mValidationDate(pValidationDate)
 {
 }
 
@@ -60,15 +90,43 @@ bool SignatureChecker::check() const
 
 
 bool SignatureChecker::checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const EC_KEY* pKey) const
+{
+	const QByteArray uncompPublicPoint = pSigningCert->getBody().getPublicKey().getUncompressedPublicPoint();
+	const QByteArray hash = QCryptographicHash::hash(pCert->getRawBody(), pSigningCert->getBody().getHashAlgorithm());
+	const QByteArray signature = pCert->getDerSignature();
+
+	const QByteArray parameters = encodeParameters(EC_KEY_get0_group(pKey));
+	if (parameters.isEmpty())
+	{
+		return verifySignature(hash, signature, uncompPublicPoint, pKey);
+	}
+
+	auto* cache = Env::getSingleton<SignatureCache>();
+	const QByteArray cacheKey = SignatureCache::createKey(parameters + uncompPublicPoint, hash, signature);
+	if (cache->isVerified(cacheKey, mValidationDate))
+	{
+		return true;
+	}
+
+	if (!verifySignature(hash, signature, uncompPublicPoint, pKey))
+	{
+		return false;
+	}
+
+	cache->addVerified(cacheKey, getExpirationDate(*pCert, *pSigningCert), mValidationDate);
+	return true;
+}
+
+
+bool SignatureChecker::verifySignature(const QByteArray& pHash, const QByteArray& pSignature, const QByteArray& pUncompPublicPoint, const EC_KEY* pKey) const
 {
 	ERR_clear_error();
 
 	// We duplicate the key because we modify it by setting the public point.
 	const QSharedPointer<EC_KEY> signingKey = EcUtil::create(EC_KEY_dup(pKey));
 
-	const QByteArray uncompPublicPoint = pSigningCert->getBody().getPublicKey().getUncompressedPublicPoint();
-	const auto* const uncompPublicPointData = reinterpret_cast<const unsigned char*>(uncompPublicPoint.constData());
-	const auto uncompPublicPointLen = static_cast<size_t>(uncompPublicPoint.size());
+	const auto* const uncompPublicPointData = reinterpret_cast<const unsigned char*>(pUncompPublicPoint.constData());
+	const auto uncompPublicPointLen = static_cast<size_t>(pUncompPublicPoint.size());
 
 	EC_POINT* publicPoint = EC_POINT_new(EC_KEY_get0_group(signingKey.data()));
 	const auto guard = qScopeGuard([publicPoint] {
@@ -102,13 +160,11 @@ bool SignatureChecker::checkSignature(const QSharedPointer<const CVCertificate>&
 		return false;
 	}
 
-	const QByteArray hash = QCryptographicHash::hash(pCert->getRawBody(), pSigningCert->getBody().getHashAlgorithm());
-	const QByteArray signature = pCert->getDerSignature();
 	const int result = EVP_PKEY_verify(ctx.data(),
-			reinterpret_cast<const uchar*>(signature.data()),
-			static_cast<size_t>(signature.size()),
-			reinterpret_cast<const uchar*>(hash.data()),
-			static_cast<size_t>(hash.size()));
+			reinterpret_cast<const uchar*>(pSignature.data()),
+			static_cast<size_t>(pSignature.size()),
+			reinterpret_cast<const uchar*>(pHash.data()),
+			static_cast<size_t>(pHash.size()));
 
 	if (result == -1)
 	{
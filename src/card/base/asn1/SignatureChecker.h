@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <QDateTime>
 #include <QVector>
 
 #include "asn1/CVCertificate.h"
@@ -16,11 +17,17 @@ class SignatureChecker
 {
 	private:
 		const QVector<QSharedPointer<const CVCertificate>> mCertificateChain;
+		const QDateTime mValidationDate;
 
+		bool verifySignature(const QByteArray& pHash, const QByteArray& pSignature, const QByteArray& pUncompPublicPoint, const EC_KEY* pKey) const;
 		bool checkSignature(const QSharedPointer<const CVCertificate>& pCert, const QSharedPointer<const CVCertificate>& pSigningCert, const EC_KEY* pKey) const;
 
 	public:
-		explicit SignatureChecker(const QVector<QSharedPointer<const CVCertificate>>& pCertificateChain);
+		/*!
+		 * Signatures that were verified before are looked up in the SignatureCache,
+		 * unless the certificates expired on the validation date.
+		 */
+		explicit SignatureChecker(const QVector<QSharedPointer<const CVCertificate>>& pCertificateChain, const QDateTime& pValidationDate = QDateTime::currentDateTime());
 		~SignatureChecker() = default;
 
 		[[nodiscard]] bool check() const;
@@ -13,6 +13,7 @@
 #include "GlobalStatus.h"
 #include "MSEBuilder.h"
 #include "PSOBuilder.h"
+#include "SecurityInfosCache.h"
 
 #include <QLoggingCategory>
 
@@ -83,7 +84,7 @@ void DidAuthenticateEAC2Command::internalExecute()
 		return;
 	}
 	mEfCardSecurityAsHex += efCardSecurityBytes.toHex();
-	QSharedPointer<EFCardSecurity> efCardSecurity = EFCardSecurity::decode(efCardSecurityBytes);
+	const auto& efCardSecurity = Env::getSingleton<SecurityInfosCache>()->getEfCardSecurity(efCardSecurityBytes);
 	if (efCardSecurity == nullptr)
 	{
 		qCCritical(card) << "Cannot parse EF.CardSecurity";
@@ -47,32 +47,64 @@ bool TransmitCommand::isAcceptable(const InputAPDUInfo& pInputApduInfo, const Re
 }
 
 
+bool TransmitCommand::processResponse(const InputAPDUInfo& pInputApduInfo, const ResponseApduResult& pResult)
+{
+	mReturnCode = pResult.mReturnCode;
+	if (mReturnCode != CardReturnCode::OK)
+	{
+		qCWarning(card) << "Transmit unsuccessful. Return code:" << CardReturnCodeUtil::toGlobalStatus(mReturnCode);
+		return false;
+	}
+
+	mOutputApduAsHex += pResult.mResponseApdu.getBuffer().toHex();
+	if (isAcceptable(pInputApduInfo, pResult.mResponseApdu))
+	{
+		return true;
+	}
+
+	qCWarning(card) << "Transmit unsuccessful. StatusCode does not start with acceptable status code" << pInputApduInfo.getAcceptableStatusCodes();
+	mReturnCode = CardReturnCode::UNEXPECTED_TRANSMIT_STATUS;
+	return false;
+}
+
+
 void TransmitCommand::internalExecute()
 {
 	Q_ASSERT(!mInputApduInfos.isEmpty());
 	Q_ASSERT(mOutputApduAsHex.isEmpty());
 
-	for (const auto& inputApduInfo : mInputApduInfos)
+	const auto& batchResults = mInputApduInfos.size() > 1
+			? mCardConnectionWorker->transmitBatch(mInputApduInfos)
+			: QVector<ResponseApduResult>();
+	if (!batchResults.isEmpty())
 	{
-		auto [returnCode, response] = mCardConnectionWorker->transmit(inputApduInfo.getInputApdu());
-		mReturnCode = returnCode;
-		if (mReturnCode != CardReturnCode::OK)
+		qCDebug(card) << "Transmitted" << mInputApduInfos.size() << "command APDUs as batch, got" << batchResults.size() << "responses";
+		for (int i = 0; i < batchResults.size() && i < mInputApduInfos.size(); ++i)
 		{
-			qCWarning(card) << "Transmit unsuccessful. Return code:" << CardReturnCodeUtil::toGlobalStatus(mReturnCode);
+			if (!processResponse(mInputApduInfos.at(i), batchResults.at(i)))
+			{
+				return;
+			}
+		}
 
+		if (batchResults.size() != mInputApduInfos.size())
+		{
+			qCWarning(card) << "Transmit unsuccessful. Batch returned" << batchResults.size() << "responses for" << mInputApduInfos.size() << "command APDUs";
+			mReturnCode = CardReturnCode::COMMAND_FAILED;
 			return;
 		}
-
-		mOutputApduAsHex += response.getBuffer().toHex();
-		if (isAcceptable(inputApduInfo, response))
+	}
+	else
+	{
+		for (const auto& inputApduInfo : mInputApduInfos)
 		{
-			continue;
+			if (!processResponse(inputApduInfo, mCardConnectionWorker->transmit(inputApduInfo.getInputApdu())))
+			{
+				return;
+			}
 		}
-
-		qCWarning(card) << "Transmit unsuccessful. StatusCode does not start with acceptable status code" << inputApduInfo.getAcceptableStatusCodes();
-		mReturnCode = CardReturnCode::UNEXPECTED_TRANSMIT_STATUS;
-		return;
 	}
+
 	qCDebug(card) << "transmit end";
 	mReturnCode = CardReturnCode::OK;
 }
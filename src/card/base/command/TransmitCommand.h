@@ -29,6 +29,7 @@ class TransmitCommand
 		QByteArrayList mOutputApduAsHex;
 
 		static bool isAcceptable(const InputAPDUInfo& pInputApduInfo, const ResponseApdu& pResponse);
+		bool processResponse(const InputAPDUInfo& pInputApduInfo, const ResponseApduResult& pResult);
 
 	protected:
 		void internalExecute() override;
@@ -4,11 +4,15 @@
 
 #include "pace/CipherMac.h"
 
-#include "asn1/KnownOIDs.h"
+#include "asn1/PaceAlgorithm.h"
 #include "ec/EcUtil.h"
 
 #include <QLoggingCategory>
-#include <QVarLengthArray>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	#include <openssl/core_names.h>
+	#include <openssl/params.h>
+#endif
 
 using namespace governikus;
 
@@ -17,46 +21,53 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 CipherMac::CipherMac(const QByteArray& pPaceAlgorithm, const QByteArray& pKeyBytes)
-	: mKey(nullptr)
+	: CipherMac(PaceAlgorithm::fromOid(pPaceAlgorithm), pKeyBytes)
 {
-	using namespace governikus::KnownOIDs;
+}
+
 
-	const EVP_CIPHER* cipher;
-	if (pPaceAlgorithm == id_PACE::DH::GM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::DH::IM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::ECDH::GM_3DES_CBC_CBC
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_3DES_CBC_CBC)
+CipherMac::CipherMac(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pKeyBytes)
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	: mCtx(nullptr)
+#else
+	: mKey(nullptr)
+#endif
+{
+	if (pPaceAlgorithm == nullptr)
 	{
-		qCCritical(card) << "3DES not supported";
+		qCCritical(card) << "Unknown algorithm";
 		return;
 	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_128
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_128)
-	{
-		cipher = EVP_aes_128_cbc();
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_192
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_192)
-	{
-		cipher = EVP_aes_192_cbc();
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_256
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_256)
-	{
-		cipher = EVP_aes_256_cbc();
-	}
-	else
+
+	if (!pPaceAlgorithm->isSupported())
 	{
-		qCCritical(card) << "Unknown algorithm:" << pPaceAlgorithm;
+		qCCritical(card) << "3DES not supported";
 		return;
 	}
 
-
+	const EVP_CIPHER* cipher = pPaceAlgorithm->getCipher();
 	if (pKeyBytes.size() != EVP_CIPHER_key_length(cipher))
 	{
 		qCCritical(card) << "Key has wrong size (expected/got):" << EVP_CIPHER_key_length(cipher) << '/' << pKeyBytes.size();
 		return;
 	}
 
-#if OPENSSL_VERSION_NUMBER < 0x10101000L || defined(LIBRESSL_VERSION_NUMBER)
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	EVP_MAC* mac = EVP_MAC_fetch(nullptr, OSSL_MAC_NAME_CMAC, nullptr);
+	mCtx = mac ? EVP_MAC_CTX_new(mac) : nullptr;
+	EVP_MAC_free(mac);
+
+	const OSSL_PARAM params[] = {
+		OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_CIPHER, const_cast<char*>(EVP_CIPHER_get0_name(cipher)), 0),
+		OSSL_PARAM_construct_end()
+	};
+	if (mCtx == nullptr || !EVP_MAC_init(mCtx, reinterpret_cast<const uchar*>(pKeyBytes.constData()), static_cast<size_t>(pKeyBytes.size()), params))
+	{
+		qCCritical(card) << "Cannot init ctx";
+		EVP_MAC_CTX_free(mCtx);
+		mCtx = nullptr;
+	}
+#elif OPENSSL_VERSION_NUMBER < 0x10101000L || defined(LIBRESSL_VERSION_NUMBER)
 	const auto ctx = EcUtil::create(EVP_PKEY_CTX_new_id(EVP_PKEY_CMAC, nullptr));
 	if (ctx.isNull() || !EVP_PKEY_keygen_init(ctx.data()))
 	{
@@ -88,13 +99,21 @@ CipherMac::CipherMac(const QByteArray& pPaceAlgorithm, const QByteArray& pKeyByt
 
 CipherMac::~CipherMac()
 {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	EVP_MAC_CTX_free(mCtx);
+#else
 	EVP_PKEY_free(mKey);
+#endif
 }
 
 
 bool CipherMac::isInitialized() const
 {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	return mCtx != nullptr;
+#else
 	return mKey != nullptr;
+#endif
 }
 
 
@@ -106,6 +125,29 @@ QByteArray CipherMac::generate(const QByteArray& pMessage)
 		return QByteArray();
 	}
 
+	QByteArray value(EVP_MAX_MD_SIZE, '\0');
+	size_t ret = static_cast<size_t>(value.size());
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	// Restart with the key of the constructor, see EVP_MAC_init(3)
+	if (!EVP_MAC_init(mCtx, nullptr, 0, nullptr))
+	{
+		qCCritical(card) << "Cannot reset ctx";
+		return QByteArray();
+	}
+
+	if (!EVP_MAC_update(mCtx, reinterpret_cast<const uchar*>(pMessage.constData()), static_cast<size_t>(pMessage.size())))
+	{
+		qCCritical(card) << "Cannot update cmac";
+		return QByteArray();
+	}
+
+	if (!EVP_MAC_final(mCtx, reinterpret_cast<uchar*>(value.data()), &ret, ret))
+	{
+		qCCritical(card) << "Cannot finalize cmac";
+		return QByteArray();
+	}
+#else
 	QSharedPointer<EVP_MD_CTX> ctx(EVP_MD_CTX_create(), [](EVP_MD_CTX* pCtx)
 		{
 			EVP_MD_CTX_destroy(pCtx);
@@ -123,13 +165,12 @@ QByteArray CipherMac::generate(const QByteArray& pMessage)
 		return QByteArray();
 	}
 
-	QByteArray value(EVP_MAX_MD_SIZE, '\0');
-	size_t ret = static_cast<size_t>(value.size());
 	if (!EVP_DigestSignFinal(ctx.data(), reinterpret_cast<uchar*>(value.data()), &ret))
 	{
 		qCCritical(card) << "Cannot finalize cmac";
 		return QByteArray();
 	}
+#endif
 
 	// Use only 8 bytes, according to TR 03110 Part 3, A.2.4.2, E.2.2.2
 	value.resize(8);
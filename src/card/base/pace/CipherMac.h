@@ -12,10 +12,21 @@
 namespace governikus
 {
 
+struct PaceAlgorithm;
+
+
 class CipherMac final
 {
 	private:
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		/*!
+		 * The key schedule is set up once in the constructor and the
+		 * context is only reset for every generated MAC.
+		 */
+		EVP_MAC_CTX* mCtx;
+#else
 		EVP_PKEY* mKey;
+#endif
 
 		Q_DISABLE_COPY(CipherMac)
 
@@ -27,6 +38,11 @@ class CipherMac final
 		 * \param pKeyBytes the bytes of the key
 		 */
 		CipherMac(const QByteArray& pPaceAlgorithm, const QByteArray& pKeyBytes);
+
+		/*!
+		 * \brief Creates a new instance with an already resolved PACE algorithm, see PaceAlgorithm::fromOid.
+		 */
+		CipherMac(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pKeyBytes);
 		~CipherMac();
 
 		/*!
@@ -5,6 +5,7 @@
 
 #include "KeyAgreement.h"
 
+#include "asn1/PaceAlgorithm.h"
 #include "asn1/PaceInfo.h"
 #include "GABuilder.h"
 #include "GlobalStatus.h"
@@ -75,7 +76,7 @@ KeyAgreement::KeyAgreement(const QSharedPointer<const PaceInfo>& pPaceInfo, cons
 	, mCarCurr()
 	, mCarPrev()
 	, mPaceInfo(pPaceInfo)
-	, mKeyDerivationFunction(pPaceInfo->getProtocol())
+	, mKeyDerivationFunction(&pPaceInfo->getPaceAlgorithm())
 {
 }
 
@@ -135,7 +136,7 @@ KeyAgreement::CardResult KeyAgreement::determineNonce(const QByteArray& pPin)
 	}
 
 	const auto symmetricKey = mKeyDerivationFunction.pi(pPin);
-	SymmetricCipher nonceDecrypter(mPaceInfo->getProtocol(), symmetricKey);
+	SymmetricCipher nonceDecrypter(&mPaceInfo->getPaceAlgorithm(), symmetricKey);
 
 	return {CardReturnCode::OK, nonceDecrypter.decrypt(result.mData)};
 }
@@ -143,7 +144,7 @@ KeyAgreement::CardResult KeyAgreement::determineNonce(const QByteArray& pPin)
 
 KeyAgreementStatus KeyAgreement::performMutualAuthenticate()
 {
-	CipherMac cmac(mPaceInfo->getProtocol(), mMacKey);
+	CipherMac cmac(&mPaceInfo->getPaceAlgorithm(), mMacKey);
 
 	QByteArray uncompressedCardPublicKey = getUncompressedCardPublicKey();
 	QByteArray mutualAuthenticationCardData = cmac.generate(uncompressedCardPublicKey);
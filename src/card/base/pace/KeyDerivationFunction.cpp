@@ -4,7 +4,7 @@
 
 #include "pace/KeyDerivationFunction.h"
 
-#include "asn1/KnownOIDs.h"
+#include "asn1/PaceAlgorithm.h"
 
 #include <QLoggingCategory>
 #include <QtEndian>
@@ -16,38 +16,29 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 KeyDerivationFunction::KeyDerivationFunction(const QByteArray& pPaceAlgorithm)
+	: KeyDerivationFunction(PaceAlgorithm::fromOid(pPaceAlgorithm))
+{
+}
+
+
+KeyDerivationFunction::KeyDerivationFunction(const PaceAlgorithm* pPaceAlgorithm)
 	: mHashAlgorithm()
 	, mKeySize(0)
 {
-	using namespace KnownOIDs;
-
-	if (pPaceAlgorithm == id_PACE::DH::GM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::DH::IM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::ECDH::GM_3DES_CBC_CBC
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_3DES_CBC_CBC)
-	{
-		qCCritical(card) << "3DES not supported";
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_128
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_128)
+	if (pPaceAlgorithm == nullptr)
 	{
-		mHashAlgorithm = QCryptographicHash::Sha1;
-		mKeySize = 16;
+		qCCritical(card) << "Unknown algorithm";
+		return;
 	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_192
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_192)
-	{
-		mHashAlgorithm = QCryptographicHash::Sha256;
-		mKeySize = 24;
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_256
-			|| pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_256)
-	{
-		mHashAlgorithm = QCryptographicHash::Sha256;
-		mKeySize = 32;
-	}
-	else
+
+	if (!pPaceAlgorithm->isSupported())
 	{
-		qCCritical(card) << "Unknown algorithm:" << pPaceAlgorithm;
+		qCCritical(card) << "3DES not supported";
+		return;
 	}
+
+	mHashAlgorithm = pPaceAlgorithm->mHashAlgorithm;
+	mKeySize = pPaceAlgorithm->mKeySize;
 }
 
 
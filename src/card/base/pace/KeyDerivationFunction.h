@@ -12,6 +12,9 @@
 namespace governikus
 {
 
+struct PaceAlgorithm;
+
+
 class KeyDerivationFunction final
 {
 	private:
@@ -26,6 +29,11 @@ class KeyDerivationFunction final
 		 *        PACE protocol of id_PACE::DH::GM_AES_CBC_CMAC_128 will result in SHA256 to be used internally to derive keys.
 		 */
 		explicit KeyDerivationFunction(const QByteArray& pPaceAlgorithm);
+
+		/*!
+		 * \brief Creates a new instance with an already resolved PACE algorithm, see PaceAlgorithm::fromOid.
+		 */
+		explicit KeyDerivationFunction(const PaceAlgorithm* pPaceAlgorithm);
 		~KeyDerivationFunction() = default;
 
 		/*!
@@ -4,7 +4,7 @@
 
 #include "pace/PaceHandler.h"
 
-#include "asn1/KnownOIDs.h"
+#include "asn1/PaceAlgorithm.h"
 #include "asn1/PaceInfo.h"
 #include "MSEBuilder.h"
 #include "pace/ec/EllipticCurveFactory.h"
@@ -129,11 +129,11 @@ bool PaceHandler::isSupportedProtocol(const QSharedPointer<const PaceInfo>& pPac
 		return false;
 	}
 
-	const auto protocol = pPaceInfo->getProtocol();
+	const auto& algorithm = pPaceInfo->getPaceAlgorithm();
 
-	if ((protocol == KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_128 ||
-			protocol == KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_192 ||
-			protocol == KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256)
+	if (algorithm.mKeyAgreementType == KeyAgreementType::ECDH
+			&& algorithm.mMappingType == MappingType::GM
+			&& algorithm.isSupported()
 			&& pPaceInfo->isStandardizedDomainParameters())
 	{
 		qCDebug(card) << "Use ECDH with standardized domain parameters:" << pPaceInfo->getProtocol();
@@ -3,6 +3,7 @@
  */
 
 #include "asn1/ASN1Util.h"
+#include "asn1/PaceAlgorithm.h"
 #include "pace/SecureMessaging.h"
 #include "SecureMessagingResponse.h"
 
@@ -19,6 +20,14 @@ Q_DECLARE_LOGGING_CATEGORY(secure)
 
 const char ISO_LEADING_PAD_BYTE = char(0x80);
 const char ISO_PAD_BYTE = 0x00;
+const char PADDING_CONTENT_INDICATOR = 0x01;
+
+const char TAG_ENCRYPTED_DATA = char(0x87);
+const char TAG_PROTECTED_LE = char(0x97);
+const char TAG_PROCESSING_STATUS = char(0x99);
+const char TAG_CHECKSUM = char(0x8E);
+
+const int SCRATCH_BUFFER_SIZE = 0x200;
 
 
 namespace governikus
@@ -35,12 +44,28 @@ IMPLEMENT_ASN1_OBJECT(SM_PROTECTED_LE)
 
 
 SecureMessaging::SecureMessaging(const QByteArray& pPaceAlgorithm, const QByteArray& pEncKey, const QByteArray& pMacKey)
+	: SecureMessaging(PaceAlgorithm::fromOid(pPaceAlgorithm), pEncKey, pMacKey)
+{
+}
+
+
+SecureMessaging::SecureMessaging(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pEncKey, const QByteArray& pMacKey)
 	: mCipher(pPaceAlgorithm, pEncKey)
 	, mCipherMac(pPaceAlgorithm, pMacKey)
 	, mSendSequenceCounter(0)
+	, mSendSequenceCounterBlock()
+	, mPlainBuffer()
+	, mMacBuffer()
 {
 	qCDebug(secure) << "Encryption key:" << pEncKey.toHex();
 	qCDebug(secure) << "MAC key:" << pMacKey.toHex();
+
+	if (isInitialized())
+	{
+		mSendSequenceCounterBlock.fill(ISO_PAD_BYTE, mCipher.getBlockSize());
+		mPlainBuffer.reserve(SCRATCH_BUFFER_SIZE);
+		mMacBuffer.reserve(SCRATCH_BUFFER_SIZE);
+	}
 }
 
 
@@ -50,39 +75,62 @@ bool SecureMessaging::isInitialized() const
 }
 
 
-QByteArray SecureMessaging::padToCipherBlockSize(const QByteArray& pData) const
+void SecureMessaging::appendTlv(QByteArray& pBuffer, char pTag, const char* pValue, int pValueSize, bool pPaddingIndicator)
+{
+	const int length = pPaddingIndicator ? pValueSize + 1 : pValueSize;
+
+	// DER encoding of the length, see ISO 7816-4, 5.2.2.2 BER-TLV length fields
+	pBuffer += pTag;
+	if (length > 0xFF)
+	{
+		pBuffer += static_cast<char>(0x82);
+		pBuffer += static_cast<char>(length >> 0x08 & 0xff);
+	}
+	else if (length > 0x7F)
+	{
+		pBuffer += static_cast<char>(0x81);
+	}
+	pBuffer += static_cast<char>(length & 0xff);
+
+	if (pPaddingIndicator)
+	{
+		pBuffer += PADDING_CONTENT_INDICATOR;
+	}
+	pBuffer.append(pValue, pValueSize);
+}
+
+
+void SecureMessaging::padToCipherBlockSize(QByteArray& pData) const
 {
 	Q_ASSERT(!pData.isEmpty());
 
 	const auto remainder = pData.size() % mCipher.getBlockSize();
-	const auto paddingSize = (remainder == 0) ? mCipher.getBlockSize() : mCipher.getBlockSize() - remainder;
+	const auto paddingSize = mCipher.getBlockSize() - remainder;
 
-	QByteArray paddedData;
-	paddedData += pData;
-	paddedData += ISO_LEADING_PAD_BYTE;
-	paddedData += QByteArray(paddingSize - 1, ISO_PAD_BYTE);
-	return paddedData;
+	pData += ISO_LEADING_PAD_BYTE;
+	pData.append(paddingSize - 1, ISO_PAD_BYTE);
 }
 
 
-QByteArray SecureMessaging::unpadFromCipherBlockSize(const QByteArray& pData) const
+bool SecureMessaging::unpadFromCipherBlockSize(QByteArray& pData) const
 {
 	Q_ASSERT(!pData.isEmpty());
 
 	if (pData.size() % mCipher.getBlockSize() != 0)
 	{
 		qCCritical(card) << "Size of data and block size is invalid";
-		return QByteArray();
+		return false;
 	}
 
 	const auto position = pData.lastIndexOf(ISO_LEADING_PAD_BYTE);
 	if (position == -1)
 	{
 		qCCritical(card) << "Cannot find padding delimiter! Message seems to be broken";
-		return QByteArray();
+		return false;
 	}
 
-	return pData.mid(0, position);
+	pData.truncate(position);
+	return true;
 }
 
 
@@ -94,82 +142,58 @@ CommandApdu SecureMessaging::encrypt(const CommandApdu& pCommandApdu)
 		return CommandApdu(QByteArray());
 	}
 
-	++mSendSequenceCounter;
+	incrementSendSequenceCounter();
 
 	qCDebug(secure) << "Plain CommandApdu:" << pCommandApdu.getBuffer().toHex();
 
-	QByteArray formattedEncryptedData;
-	if (!pCommandApdu.getData().isEmpty())
+	const char cla = static_cast<char>((pCommandApdu.getCLA() & 0xF0) | CommandApdu::CLA_SECURE_MESSAGING);
+	const char ins = pCommandApdu.getINS();
+	const char p1 = pCommandApdu.getP1();
+	const char p2 = pCommandApdu.getP2();
+
+	// The MAC is calculated over SSC || pad(header) || DO'87' || DO'97' || padding.
+	// The data objects are written directly behind the padded header, so the
+	// secured data field DO'87' || DO'97' || DO'8E' is a slice of the same buffer.
+	mMacBuffer.resize(0);
+	mMacBuffer += mSendSequenceCounterBlock;
+	mMacBuffer += cla;
+	mMacBuffer += ins;
+	mMacBuffer += p1;
+	mMacBuffer += p2;
+	padToCipherBlockSize(mMacBuffer);
+	const int securedDataBegin = mMacBuffer.size();
+
+	const QByteArray data = pCommandApdu.getData();
+	if (!data.isEmpty())
 	{
-		QByteArray paddedCommandData = padToCipherBlockSize(pCommandApdu.getData());
+		mPlainBuffer.resize(0);
+		mPlainBuffer += data;
+		padToCipherBlockSize(mPlainBuffer);
 		mCipher.setIv(getEncryptedIv());
-		QByteArray encryptedData = mCipher.encrypt(paddedCommandData).prepend(0x01);
-
-		auto encryptedDataObject = newObject<SM_ENCRYPTED_DATA>();
-		Asn1OctetStringUtil::setValue(encryptedData, encryptedDataObject.data());
-		formattedEncryptedData = encodeObject(encryptedDataObject.data());
+		const QByteArray encryptedData = mCipher.encrypt(mPlainBuffer);
+		appendTlv(mMacBuffer, TAG_ENCRYPTED_DATA, encryptedData.constData(), encryptedData.size(), true);
 	}
 
-	QByteArray securedHeader = createSecuredHeader(pCommandApdu);
-	QByteArray securedLe;
-	if (pCommandApdu.getLe() > CommandApdu::NO_LE)
+	const int le = pCommandApdu.getLe();
+	if (le > CommandApdu::NO_LE)
 	{
-		auto protectedLeObject = newObject<SM_PROTECTED_LE>();
-		Asn1OctetStringUtil::setValue(createSecuredLe(pCommandApdu.getLe()), protectedLeObject.data());
-		securedLe = encodeObject(protectedLeObject.data());
+		const char securedLe[] = {static_cast<char>(le >> 0x08 & 0xff), static_cast<char>(le & 0xff)};
+		const bool extendedLe = le > CommandApdu::SHORT_MAX_LE;
+		appendTlv(mMacBuffer, TAG_PROTECTED_LE, extendedLe ? securedLe : securedLe + 1, extendedLe ? 2 : 1);
 	}
-	QByteArray mac = createMac(securedHeader, formattedEncryptedData, securedLe);
-	QByteArray securedData = formattedEncryptedData + securedLe + mac;
-	int newLe = createNewLe(securedData, pCommandApdu.getLe());
 
-	return CommandApdu(securedHeader, securedData, newLe);
-}
-
-
-QByteArray SecureMessaging::createSecuredHeader(const CommandApdu& pCommandApdu) const
-{
-	QByteArray securedHeader;
-	securedHeader += static_cast<char>((pCommandApdu.getCLA() & 0xF0) | CommandApdu::CLA_SECURE_MESSAGING);
-	securedHeader += pCommandApdu.getINS();
-	securedHeader += pCommandApdu.getP1();
-	securedHeader += pCommandApdu.getP2();
-	return securedHeader;
-}
-
-
-QByteArray SecureMessaging::createSecuredLe(int pLe) const
-{
-	QByteArray buffer;
-	if (pLe > CommandApdu::NO_LE)
+	const int securedDataEnd = mMacBuffer.size();
+	if (securedDataEnd > securedDataBegin)
 	{
-		if (pLe > CommandApdu::SHORT_MAX_LE)
-		{
-			buffer += static_cast<char>(pLe >> 0x08 & 0xff);
-		}
-		buffer += static_cast<char>(pLe >> 0x00 & 0xff);
+		padToCipherBlockSize(mMacBuffer);
 	}
-	return buffer;
-}
+	const QByteArray mac = mCipherMac.generate(mMacBuffer);
 
+	mMacBuffer.resize(securedDataEnd);
+	appendTlv(mMacBuffer, TAG_CHECKSUM, mac.constData(), mac.size());
 
-QByteArray SecureMessaging::createMac(const QByteArray& pSecuredHeader,
-		const QByteArray& pFormattedEncryptedData,
-		const QByteArray& pSecuredLe)
-{
-	QByteArray dataToMac(pSecuredHeader);
-	dataToMac = padToCipherBlockSize(dataToMac);
-	dataToMac += pFormattedEncryptedData;
-	dataToMac += pSecuredLe;
-	if (!pFormattedEncryptedData.isNull() || !pSecuredLe.isNull())
-	{
-		dataToMac = padToCipherBlockSize(dataToMac);
-	}
-	dataToMac.prepend(getSendSequenceCounter());
-
-	QByteArray mac = mCipherMac.generate(dataToMac);
-	auto macObject = newObject<SM_CHECKSUM>();
-	Asn1OctetStringUtil::setValue(mac, macObject.data());
-	return encodeObject(macObject.data());
+	const auto securedData = QByteArray::fromRawData(mMacBuffer.constData() + securedDataBegin, mMacBuffer.size() - securedDataBegin);
+	return CommandApdu(cla, ins, p1, p2, securedData, createNewLe(securedData, le));
 }
 
 
@@ -183,19 +207,22 @@ int SecureMessaging::createNewLe(const QByteArray& pSecuredData, int pOldLe) con
 }
 
 
-QByteArray SecureMessaging::getSendSequenceCounter() const
+void SecureMessaging::incrementSendSequenceCounter()
 {
-	static const int COUNTER_SIZE = sizeof(mSendSequenceCounter);
-	char converted[COUNTER_SIZE];
-	qToBigEndian(mSendSequenceCounter, converted);
-	return QByteArray(mCipher.getBlockSize() - COUNTER_SIZE, 0x00) + QByteArray(converted, COUNTER_SIZE);
+	++mSendSequenceCounter;
+
+	if (!mSendSequenceCounterBlock.isEmpty())
+	{
+		const int offset = mSendSequenceCounterBlock.size() - static_cast<int>(sizeof(mSendSequenceCounter));
+		qToBigEndian(mSendSequenceCounter, mSendSequenceCounterBlock.data() + offset);
+	}
 }
 
 
 QByteArray SecureMessaging::getEncryptedIv()
 {
-	mCipher.setIv(QByteArray().fill(0x00, mCipher.getBlockSize()));
-	return mCipher.encrypt(getSendSequenceCounter());
+	mCipher.setIv(QByteArray(mCipher.getBlockSize(), ISO_PAD_BYTE));
+	return mCipher.encrypt(mSendSequenceCounterBlock);
 }
 
 
@@ -207,7 +234,7 @@ ResponseApdu SecureMessaging::decrypt(const ResponseApdu& pEncryptedResponseApdu
 		return ResponseApdu();
 	}
 
-	++mSendSequenceCounter;
+	incrementSendSequenceCounter();
 
 	SecureMessagingResponse secureResponse(pEncryptedResponseApdu.getBuffer());
 	if (secureResponse.isInvalid())
@@ -220,29 +247,36 @@ ResponseApdu SecureMessaging::decrypt(const ResponseApdu& pEncryptedResponseApdu
 		return ResponseApdu();
 	}
 
-	QByteArray dataToMac;
-	if (!secureResponse.getEncryptedData().isEmpty())
+	const QByteArray encryptedData = secureResponse.getEncryptedData();
+	const QByteArray securedStatusCode = secureResponse.getSecuredStatusCodeBytes();
+
+	mMacBuffer.resize(0);
+	mMacBuffer += mSendSequenceCounterBlock;
+	if (!encryptedData.isEmpty())
 	{
-		dataToMac += secureResponse.getEncryptedDataObjectEncoded();
+		appendTlv(mMacBuffer, TAG_ENCRYPTED_DATA, encryptedData.constData(), encryptedData.size(), true);
 	}
-	dataToMac += secureResponse.getSecuredStatusCodeObjectEncoded();
-	dataToMac = padToCipherBlockSize(dataToMac);
-	dataToMac.prepend(getSendSequenceCounter());
-	if (mCipherMac.generate(dataToMac) != secureResponse.getMac())
+	appendTlv(mMacBuffer, TAG_PROCESSING_STATUS, securedStatusCode.constData(), securedStatusCode.size());
+	padToCipherBlockSize(mMacBuffer);
+	if (mCipherMac.generate(mMacBuffer) != secureResponse.getMac())
 	{
 		qCCritical(card) << "MAC on secured ResponseApdu does not match";
 		return ResponseApdu();
 	}
 
 	QByteArray decryptedData;
-	if (!secureResponse.getEncryptedData().isEmpty())
+	if (!encryptedData.isEmpty())
 	{
 		mCipher.setIv(getEncryptedIv());
-		QByteArray paddedDecryptedData = mCipher.decrypt(secureResponse.getEncryptedData());
-		decryptedData = unpadFromCipherBlockSize(paddedDecryptedData);
+		decryptedData = mCipher.decrypt(encryptedData);
+		if (!unpadFromCipherBlockSize(decryptedData))
+		{
+			decryptedData.clear();
+		}
 	}
+	decryptedData += securedStatusCode;
 
-	const ResponseApdu response(decryptedData + secureResponse.getSecuredStatusCodeBytes());
+	const ResponseApdu response(decryptedData);
 	qCDebug(secure) << "Plain ResponseApdu:" << response.getBuffer().toHex();
 	return response;
 }
@@ -34,18 +34,29 @@ class SecureMessaging final
 		CipherMac mCipherMac;
 		quint32 mSendSequenceCounter;
 
-		[[nodiscard]] QByteArray padToCipherBlockSize(const QByteArray& pData) const;
-		[[nodiscard]] QByteArray unpadFromCipherBlockSize(const QByteArray& pData) const;
-		[[nodiscard]] QByteArray createSecuredHeader(const CommandApdu& pCommandApdu) const;
-		QByteArray createMac(const QByteArray& pSecuredHeader, const QByteArray& pFormattedEncryptedData, const QByteArray& pSecuredLe);
+		/*!
+		 * Send sequence counter as a block of cipher block size. Only the
+		 * trailing four bytes are updated on every increment.
+		 */
+		QByteArray mSendSequenceCounterBlock;
+
+		/*!
+		 * Scratch buffers reused for every APDU of this channel to avoid
+		 * temporary allocations while padding and building the data objects.
+		 */
+		QByteArray mPlainBuffer;
+		QByteArray mMacBuffer;
+
+		static void appendTlv(QByteArray& pBuffer, char pTag, const char* pValue, int pValueSize, bool pPaddingIndicator = false);
+		void padToCipherBlockSize(QByteArray& pData) const;
+		[[nodiscard]] bool unpadFromCipherBlockSize(QByteArray& pData) const;
 		[[nodiscard]] int createNewLe(const QByteArray& pSecuredData, int pOldLe) const;
-		[[nodiscard]] QByteArray getSendSequenceCounter() const;
+		void incrementSendSequenceCounter();
 		QByteArray getEncryptedIv();
 
-		[[nodiscard]] QByteArray createSecuredLe(int pLe) const;
-
 	public:
 		SecureMessaging(const QByteArray& pPaceAlgorithm, const QByteArray& pEncKey, const QByteArray& pMacKey);
+		SecureMessaging(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pEncKey, const QByteArray& pMacKey);
 		~SecureMessaging() = default;
 
 		/*!
@@ -4,7 +4,7 @@
 
 #include "pace/SymmetricCipher.h"
 
-#include "asn1/KnownOIDs.h"
+#include "asn1/PaceAlgorithm.h"
 
 #include <openssl/evp.h>
 #include <QLoggingCategory>
@@ -16,72 +16,95 @@ Q_DECLARE_LOGGING_CATEGORY(card)
 
 
 SymmetricCipher::SymmetricCipher(const QByteArray& pPaceAlgorithm, const QByteArray& pKeyBytes)
-	: mCtx(nullptr)
+	: SymmetricCipher(PaceAlgorithm::fromOid(pPaceAlgorithm), pKeyBytes)
+{
+}
+
+
+SymmetricCipher::SymmetricCipher(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pKeyBytes)
+	: mEncryptCtx(nullptr)
+	, mDecryptCtx(nullptr)
 	, mCipher(nullptr)
 	, mIv()
-	, mKeyBytes(pKeyBytes)
 {
-	using namespace governikus::KnownOIDs;
-
-	if (pPaceAlgorithm == id_PACE::DH::GM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::DH::IM_3DES_CBC_CBC
-			|| pPaceAlgorithm == id_PACE::ECDH::GM_3DES_CBC_CBC || pPaceAlgorithm == id_PACE::ECDH::IM_3DES_CBC_CBC)
+	if (pPaceAlgorithm == nullptr)
 	{
-		qCCritical(card) << "3DES not supported";
+		qCCritical(card) << "Unknown algorithm";
 		return;
 	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_128
-			|| pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_128 || pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_128)
-	{
-		mCipher = EVP_aes_128_cbc();
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_192
-			|| pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_192 || pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_192)
-	{
-		mCipher = EVP_aes_192_cbc();
-	}
-	else if (pPaceAlgorithm == id_PACE::DH::GM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::DH::IM_AES_CBC_CMAC_256
-			|| pPaceAlgorithm == id_PACE::ECDH::GM_AES_CBC_CMAC_256 || pPaceAlgorithm == id_PACE::ECDH::IM_AES_CBC_CMAC_256)
-	{
-		mCipher = EVP_aes_256_cbc();
-	}
-	else
+
+	if (!pPaceAlgorithm->isSupported())
 	{
-		qCCritical(card) << "Unknown algorithm:" << pPaceAlgorithm;
+		qCCritical(card) << "3DES not supported";
 		return;
 	}
 
+	mCipher = pPaceAlgorithm->getCipher();
 	mIv.fill(0, EVP_CIPHER_iv_length(mCipher));
 
-	if (mKeyBytes.size() != EVP_CIPHER_key_length(mCipher))
+	if (pKeyBytes.size() != EVP_CIPHER_key_length(mCipher))
 	{
 		qCCritical(card) << "Error cipher key has wrong length";
 		return;
 	}
 
-	mCtx = EVP_CIPHER_CTX_new();
+	mEncryptCtx = createContext(mCipher, pKeyBytes, true);
+	mDecryptCtx = createContext(mCipher, pKeyBytes, false);
+}
+
+
+SymmetricCipher::~SymmetricCipher()
+{
+	freeContext(mEncryptCtx);
+	freeContext(mDecryptCtx);
+}
+
+
+EVP_CIPHER_CTX* SymmetricCipher::createContext(const EVP_CIPHER* pCipher, const QByteArray& pKeyBytes, bool pEncrypt)
+{
+	EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+	if (ctx == nullptr)
+	{
+		qCCritical(card) << "Cannot create cipher ctx";
+		return nullptr;
+	}
+
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
-	EVP_CIPHER_CTX_init(mCtx);
-#else
-	EVP_CIPHER_CTX_reset(mCtx);
+	EVP_CIPHER_CTX_init(ctx);
 #endif
+
+	const auto* key = reinterpret_cast<const uchar*>(pKeyBytes.constData());
+	if (!EVP_CipherInit_ex(ctx, pCipher, nullptr, key, nullptr, pEncrypt ? 1 : 0))
+	{
+		qCCritical(card) << "Error on EVP_CipherInit_ex";
+		freeContext(ctx);
+		return nullptr;
+	}
+
+	return ctx;
 }
 
 
-SymmetricCipher::~SymmetricCipher()
+void SymmetricCipher::freeContext(EVP_CIPHER_CTX* pCtx)
 {
+	if (pCtx == nullptr)
+	{
+		return;
+	}
+
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
-	EVP_CIPHER_CTX_cleanup(mCtx);
+	EVP_CIPHER_CTX_cleanup(pCtx);
 #else
-	EVP_CIPHER_CTX_reset(mCtx);
+	EVP_CIPHER_CTX_reset(pCtx);
 #endif
 
-	EVP_CIPHER_CTX_free(mCtx);
+	EVP_CIPHER_CTX_free(pCtx);
 }
 
 
 bool SymmetricCipher::isInitialized() const
 {
-	return mCtx != nullptr && mCipher != nullptr;
+	return mEncryptCtx != nullptr && mDecryptCtx != nullptr && mCipher != nullptr;
 }
 
 
@@ -93,34 +116,35 @@ QByteArray SymmetricCipher::encrypt(const QByteArray& pPlainData)
 		return QByteArray();
 	}
 
-	if (!EVP_EncryptInit_ex(mCtx, mCipher, nullptr, reinterpret_cast<const uchar*>(mKeyBytes.constData()), reinterpret_cast<const uchar*>(mIv.constData())))
+	// A null cipher and key keeps the key schedule and only sets the IV, see EVP_EncryptInit(3)
+	if (!EVP_EncryptInit_ex(mEncryptCtx, nullptr, nullptr, nullptr, reinterpret_cast<const uchar*>(mIv.constData())))
 	{
 		qCCritical(card) << "Error on EVP_EncryptInit_ex";
 		return QByteArray();
 	}
-	EVP_CIPHER_CTX_set_padding(mCtx, 0);
+	EVP_CIPHER_CTX_set_padding(mEncryptCtx, 0);
 
-	if (pPlainData.size() % EVP_CIPHER_block_size(EVP_CIPHER_CTX_cipher(mCtx)) != 0)
+	if (pPlainData.size() % EVP_CIPHER_block_size(mCipher) != 0)
 	{
 		qCCritical(card) << "Plain data length is not a multiple of the block size";
 		return QByteArray();
 	}
 
-	QVector<uchar> cryptogram(pPlainData.size());
+	QByteArray encryptedData(pPlainData.size(), Qt::Uninitialized);
+	auto* cryptogram = reinterpret_cast<uchar*>(encryptedData.data());
 	int update_len = 0;
-	if (!EVP_EncryptUpdate(mCtx, cryptogram.data(), &update_len, reinterpret_cast<const uchar*>(pPlainData.constData()), pPlainData.size()))
+	if (!EVP_EncryptUpdate(mEncryptCtx, cryptogram, &update_len, reinterpret_cast<const uchar*>(pPlainData.constData()), pPlainData.size()))
 	{
 		qCCritical(card) << "Error on EVP_EncryptUpdate";
 		return QByteArray();
 	}
 	int final_len = 0;
-	if (!EVP_EncryptFinal_ex(mCtx, cryptogram.data() + update_len, &final_len))
+	if (!EVP_EncryptFinal_ex(mEncryptCtx, cryptogram + update_len, &final_len))
 	{
 		qCCritical(card) << "Error on EVP_EncryptFinal_ex";
 		return QByteArray();
 	}
-	QByteArray encryptedData;
-	encryptedData.append(reinterpret_cast<const char*>(cryptogram.data()), update_len + final_len);
+	encryptedData.resize(update_len + final_len);
 
 	return encryptedData;
 }
@@ -155,34 +179,35 @@ QByteArray SymmetricCipher::decrypt(const QByteArray& pEncryptedData)
 		return QByteArray();
 	}
 
-	if (!EVP_DecryptInit_ex(mCtx, mCipher, nullptr, reinterpret_cast<const uchar*>(mKeyBytes.constData()), reinterpret_cast<const uchar*>(mIv.constData())))
+	// A null cipher and key keeps the key schedule and only sets the IV, see EVP_DecryptInit(3)
+	if (!EVP_DecryptInit_ex(mDecryptCtx, nullptr, nullptr, nullptr, reinterpret_cast<const uchar*>(mIv.constData())))
 	{
 		qCCritical(card) << "Error on EVP_DecryptInit_ex";
 		return QByteArray();
 	}
-	EVP_CIPHER_CTX_set_padding(mCtx, 0);
+	EVP_CIPHER_CTX_set_padding(mDecryptCtx, 0);
 
-	if (pEncryptedData.size() % EVP_CIPHER_block_size(EVP_CIPHER_CTX_cipher(mCtx)) != 0)
+	if (pEncryptedData.size() % EVP_CIPHER_block_size(mCipher) != 0)
 	{
 		qCCritical(card) << "Encrypted data length is not a multiple of the block size";
 		return QByteArray();
 	}
 
-	QVector<uchar> plaintext(pEncryptedData.size());
+	QByteArray decryptedData(pEncryptedData.size(), Qt::Uninitialized);
+	auto* plaintext = reinterpret_cast<uchar*>(decryptedData.data());
 	int update_len = 0;
-	if (!EVP_DecryptUpdate(mCtx, plaintext.data(), &update_len, reinterpret_cast<const uchar*>(pEncryptedData.constData()), pEncryptedData.size()))
+	if (!EVP_DecryptUpdate(mDecryptCtx, plaintext, &update_len, reinterpret_cast<const uchar*>(pEncryptedData.constData()), pEncryptedData.size()))
 	{
 		qCCritical(card) << "Error on EVP_DecryptUpdate";
 		return QByteArray();
 	}
 	int final_len = 0;
-	if (!EVP_DecryptFinal_ex(mCtx, plaintext.data() + update_len, &final_len))
+	if (!EVP_DecryptFinal_ex(mDecryptCtx, plaintext + update_len, &final_len))
 	{
 		qCCritical(card) << "Error on EVP_DecryptFinal_ex";
 		return QByteArray();
 	}
-	QByteArray decryptedData;
-	decryptedData.append(reinterpret_cast<const char*>(plaintext.data()), update_len + final_len);
+	decryptedData.resize(update_len + final_len);
 
 	return decryptedData;
 }
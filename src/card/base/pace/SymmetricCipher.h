@@ -12,12 +12,23 @@
 namespace governikus
 {
 
+struct PaceAlgorithm;
+
+
 class SymmetricCipher final
 {
 	private:
-		EVP_CIPHER_CTX* mCtx;
+		/*!
+		 * Both contexts are keyed once in the constructor. Every operation
+		 * only sets the current initialization vector.
+		 */
+		EVP_CIPHER_CTX* mEncryptCtx;
+		EVP_CIPHER_CTX* mDecryptCtx;
 		const EVP_CIPHER* mCipher;
-		QByteArray mIv, mKeyBytes;
+		QByteArray mIv;
+
+		static EVP_CIPHER_CTX* createContext(const EVP_CIPHER* pCipher, const QByteArray& pKeyBytes, bool pEncrypt);
+		static void freeContext(EVP_CIPHER_CTX* pCtx);
 
 		Q_DISABLE_COPY(SymmetricCipher)
 
@@ -29,6 +40,11 @@ class SymmetricCipher final
 		 * \param pKeyBytes the bytes of the key
 		 */
 		SymmetricCipher(const QByteArray& pPaceAlgorithm, const QByteArray& pKeyBytes);
+
+		/*!
+		 * \brief Creates a new instance with an already resolved PACE algorithm, see PaceAlgorithm::fromOid.
+		 */
+		SymmetricCipher(const PaceAlgorithm* pPaceAlgorithm, const QByteArray& pKeyBytes);
 		~SymmetricCipher();
 
 		/*!
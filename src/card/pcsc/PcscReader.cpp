@@ -50,9 +50,6 @@ PcscReader::PcscReader(const QString& pReaderName)
 
 	mReaderInfo.setBasicReader(!hasFeature(FeatureID::EXECUTE_PACE));
 	mReaderInfo.setConnected(true);
-
-	update();
-	mTimerId = startTimer(500);
 }
 
 
@@ -156,11 +153,6 @@ Reader::CardEvent PcscReader::updateCard()
 	{
 		qCWarning(card_pcsc) << "SCardGetStatusChange:" << PcscUtils::toString(returnCode);
 		qCWarning(card_pcsc) << "Reader unknown, stop updating reader information";
-		if (mTimerId != 0)
-		{
-			killTimer(mTimerId);
-			mTimerId = 0;
-		}
 		return Reader::CardEvent::NONE;
 	}
 	else if (returnCode != PcscUtils::Scard_S_Success)
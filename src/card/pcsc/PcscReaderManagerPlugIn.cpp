@@ -18,8 +18,9 @@ Q_DECLARE_LOGGING_CATEGORY(card_pcsc)
 PcscReaderManagerPlugIn::PcscReaderManagerPlugIn()
 	: ReaderManagerPlugIn(ReaderManagerPlugInType::PCSC, true)
 	, mContextHandle(0)
-	, mTimerId(0)
+	, mMonitor()
 	, mReaders()
+	, mReaderThreads()
 {
 	setObjectName(QStringLiteral("PcscReaderManager"));
 
@@ -31,12 +32,12 @@ PcscReaderManagerPlugIn::PcscReaderManagerPlugIn()
 
 PcscReaderManagerPlugIn::~PcscReaderManagerPlugIn()
 {
-	Q_ASSERT(mTimerId == 0);
+	Q_ASSERT(mMonitor.isNull());
 	Q_ASSERT(mContextHandle == 0);
 
 	while (!mReaders.isEmpty())
 	{
-		removeReader(qAsConst(mReaders).first()->getName());
+		removeReader(mReaders.firstKey());
 	}
 }
 
@@ -59,9 +60,12 @@ void PcscReaderManagerPlugIn::startScan(bool pAutoConnect)
 		qCWarning(card_pcsc) << "Not started: Cannot establish context";
 	}
 
-	if (mTimerId == 0)
+	if (mMonitor.isNull())
 	{
-		mTimerId = startTimer(500);
+		mMonitor.reset(new PcscReaderMonitor());
+		connect(mMonitor.data(), &PcscReaderMonitor::fireReaderListChanged, this, &PcscReaderManagerPlugIn::updateReaders);
+		connect(mMonitor.data(), &PcscReaderMonitor::fireReaderStateChanged, this, &PcscReaderManagerPlugIn::onReaderStateChanged);
+		mMonitor->start();
 	}
 	ReaderManagerPlugIn::startScan(pAutoConnect);
 }
@@ -69,10 +73,10 @@ void PcscReaderManagerPlugIn::startScan(bool pAutoConnect)
 
 void PcscReaderManagerPlugIn::stopScan(const QString& pError)
 {
-	if (mTimerId)
+	if (!mMonitor.isNull())
 	{
-		killTimer(mTimerId);
-		mTimerId = 0;
+		mMonitor->stop();
+		mMonitor.reset();
 	}
 	if (mContextHandle)
 	{
@@ -89,11 +93,11 @@ void PcscReaderManagerPlugIn::stopScan(const QString& pError)
 }
 
 
-void PcscReaderManagerPlugIn::timerEvent(QTimerEvent* pEvent)
+void PcscReaderManagerPlugIn::onReaderStateChanged(const QString& pReaderName)
 {
-	if (pEvent->timerId() == mTimerId)
+	if (auto* reader = mReaders.value(pReaderName))
 	{
-		updateReaders();
+		QMetaObject::invokeMethod(reader, &Reader::update, Qt::QueuedConnection);
 	}
 }
 
@@ -101,12 +105,12 @@ void PcscReaderManagerPlugIn::timerEvent(QTimerEvent* pEvent)
 void PcscReaderManagerPlugIn::updateReaders()
 {
 	QStringList readersToAdd;
-	PCSC_RETURNCODE returnCode = readReaderNames(readersToAdd);
+	PCSC_RETURNCODE returnCode = PcscReaderMonitor::readReaderNames(mContextHandle, readersToAdd);
 	if (returnCode != PcscUtils::Scard_S_Success && returnCode != PcscUtils::Scard_E_No_Readers_Available)
 	{
 		qCWarning(card_pcsc) << "Cannot update readers, returnCode:" << returnCode;
 
-		if (returnCode == PcscUtils::Scard_E_No_Service && mTimerId != 0)
+		if (returnCode == PcscUtils::Scard_E_No_Service && !mMonitor.isNull())
 		{
 			// Work around for an issue on Linux: Sometimes when unplugging a reader
 			// the library seems to get confused and any further calls with existing
@@ -116,7 +120,7 @@ void PcscReaderManagerPlugIn::updateReaders()
 			stopScan();
 			startScan(true);
 		}
-		else if (returnCode == PcscUtils::Scard_E_Service_Stopped && mTimerId != 0)
+		else if (returnCode == PcscUtils::Scard_E_Service_Stopped && !mMonitor.isNull())
 		{
 			// Work around for an issue on Windows 8.1: Sometimes when unplugging a reader
 			// the library seems to get confused and any further calls with existing
@@ -126,7 +130,7 @@ void PcscReaderManagerPlugIn::updateReaders()
 			stopScan();
 			startScan(true);
 		}
-		else if (returnCode == PcscUtils::Scard_E_Invalid_Handle && mTimerId != 0)
+		else if (returnCode == PcscUtils::Scard_E_Invalid_Handle && !mMonitor.isNull())
 		{
 			// If the pc/sc daemon terminates on Linux, the handle is invalidated. We try
 			// to restart the manager in this case.
@@ -161,19 +165,15 @@ void PcscReaderManagerPlugIn::updateReaders()
 
 		qCDebug(card_pcsc) << "fireReaderAdded:" << readerName << "(" << mReaders.size() << "reader in total )";
 		Q_EMIT fireReaderAdded(reader->getReaderInfo());
-	}
-}
 
-
-QString PcscReaderManagerPlugIn::extractReaderName(PCSC_CHAR_PTR pReaderPointer) const
-{
-#if defined(Q_OS_WIN) && defined(UNICODE)
-	return QString::fromWCharArray(pReaderPointer);
-
-#else
-	return QString::fromUtf8(pReaderPointer);
-
-#endif
+		// Every reader gets its own thread for card I/O. The thread stops itself if the
+		// reader is removed and no CardConnectionWorker refers to it anymore.
+		auto* readerThread = new ReaderThread(readerName);
+		mReaderThreads.insert(readerName, readerThread);
+		connect(readerThread, &ReaderThread::fireReaderDestroyed, this, &PcscReaderManagerPlugIn::onReaderDestroyed, Qt::QueuedConnection);
+		readerThread->take(reader);
+		QMetaObject::invokeMethod(reader, &Reader::update, Qt::QueuedConnection);
+	}
 }
 
 
@@ -186,11 +186,16 @@ void PcscReaderManagerPlugIn::removeReader(const QString& pReaderName)
 	}
 
 	auto* reader = mReaders.take(pReaderName);
-	auto info = reader->getReaderInfo();
-	delete reader;
+	mReaderThreads.take(pReaderName)->destroy(reader);
+}
+
+
+void PcscReaderManagerPlugIn::onReaderDestroyed(const ReaderInfo& pInfo)
+{
+	auto info = pInfo;
 	info.setCardInfo(CardInfo(CardType::NONE));
 
-	qCDebug(card_pcsc) << "fireReaderRemoved:" << pReaderName;
+	qCDebug(card_pcsc) << "fireReaderRemoved:" << info.getName();
 	Q_EMIT fireReaderRemoved(info);
 }
 
@@ -202,37 +207,3 @@ void PcscReaderManagerPlugIn::removeReaders(const QStringList& pReaderNames)
 		removeReader(readerName);
 	}
 }
-
-
-PCSC_RETURNCODE PcscReaderManagerPlugIn::readReaderNames(QStringList& pReaderNames)
-{
-	if (mContextHandle == 0)
-	{
-		return PcscUtils::Scard_E_Invalid_Handle;
-	}
-
-	QVarLengthArray<PCSC_CHAR, 8192> readers;
-	auto maxReadersSize = static_cast<PCSC_INT>(readers.capacity());
-	PCSC_RETURNCODE returnCode = SCardListReaders(mContextHandle, nullptr, readers.data(), &maxReadersSize);
-	if (returnCode != PcscUtils::Scard_S_Success)
-	{
-		if (returnCode != PcscUtils::Scard_E_No_Readers_Available)
-		{
-			qCWarning(card_pcsc) << "SCardListReaders:" << PcscUtils::toString(returnCode);
-			qCWarning(card_pcsc) << "Cannot read reader names";
-		}
-		return returnCode;
-	}
-
-	PCSC_CHAR_PTR pReader = readers.data();
-	const PCSC_CHAR_PTR end = pReader + maxReadersSize - 1;
-	while (pReader < end)
-	{
-		QString readerName = extractReaderName(pReader);
-		pReaderNames += readerName;
-		// Advance to the next value.
-		pReader += readerName.size() + 1;
-	}
-
-	return returnCode;
-}
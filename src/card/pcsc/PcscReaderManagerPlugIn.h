@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include "PcscReaderMonitor.h"
 #include "PcscUtils.h"
 #include "Reader.h"
 #include "ReaderManagerPlugIn.h"
+#include "ReaderThread.h"
 
 #include <QMap>
+#include <QScopedPointer>
 #include <QStringList>
 
 
@@ -26,18 +29,18 @@ class PcscReaderManagerPlugIn
 
 	private:
 		SCARDCONTEXT mContextHandle;
-		int mTimerId;
+		QScopedPointer<PcscReaderMonitor> mMonitor;
 		QMap<QString, Reader*> mReaders;
+		QMap<QString, ReaderThread*> mReaderThreads;
 
 	private:
-		PCSC_RETURNCODE readReaderNames(QStringList& pReaderNames);
-		void updateReaders();
-		inline QString extractReaderName(PCSC_CHAR_PTR pReaderPointer) const;
 		void removeReader(const QString& pReaderName);
 		void removeReaders(const QStringList& pReaderNames);
 
-	protected:
-		void timerEvent(QTimerEvent* pEvent) override;
+	private Q_SLOTS:
+		void updateReaders();
+		void onReaderStateChanged(const QString& pReaderName);
+		void onReaderDestroyed(const ReaderInfo& pInfo);
 
 	public:
 		PcscReaderManagerPlugIn();
@@ -0,0 +1,316 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PcscReaderMonitor.h"
+
+#include <QHash>
+#include <QLoggingCategory>
+#include <QVarLengthArray>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(card_pcsc)
+
+
+#ifndef INFINITE
+	#define INFINITE 0xFFFFFFFF
+#endif
+
+
+namespace
+{
+#if defined(Q_OS_WIN) && defined(UNICODE)
+const PCSC_CHAR PNP_NOTIFICATION[] = L"\\\\?PnP?\\Notification";
+#else
+const PCSC_CHAR PNP_NOTIFICATION[] = "\\\\?PnP?\\Notification";
+#endif
+
+// Used if the platform does not support the PnP notification pseudo reader.
+const PCSC_INT FALLBACK_TIMEOUT = 500;
+
+
+QString extractReaderName(const PCSC_CHAR* pReaderPointer)
+{
+#if defined(Q_OS_WIN) && defined(UNICODE)
+	return QString::fromWCharArray(pReaderPointer);
+
+#else
+	return QString::fromUtf8(pReaderPointer);
+
+#endif
+}
+
+
+std::basic_string<PCSC_CHAR> toNativeReaderName(const QString& pReaderName)
+{
+#if defined(Q_OS_WIN) && defined(UNICODE)
+	return pReaderName.toStdWString();
+
+#else
+	return pReaderName.toStdString();
+
+#endif
+}
+
+
+} // namespace
+
+
+PcscReaderMonitor::PcscReaderMonitor()
+	: QThread()
+	, mContextHandle(0)
+	, mPnpSupported(true)
+	, mReaderNames()
+	, mNativeReaderNames()
+	, mReaderStates()
+{
+	setObjectName(QStringLiteral("PcscReaderMonitor"));
+
+	const PCSC_RETURNCODE returnCode = SCardEstablishContext(SCARD_SCOPE_USER, nullptr, nullptr, &mContextHandle);
+	qCDebug(card_pcsc) << "SCardEstablishContext:" << PcscUtils::toString(returnCode);
+	if (returnCode != PcscUtils::Scard_S_Success)
+	{
+		qCWarning(card_pcsc) << "Cannot establish context for monitor";
+		mContextHandle = 0;
+	}
+}
+
+
+PcscReaderMonitor::~PcscReaderMonitor()
+{
+	stop();
+
+	if (mContextHandle)
+	{
+		qCDebug(card_pcsc) << "SCardReleaseContext:" << PcscUtils::toString(SCardReleaseContext(mContextHandle));
+		mContextHandle = 0;
+	}
+}
+
+
+void PcscReaderMonitor::stop()
+{
+	if (!isRunning())
+	{
+		return;
+	}
+
+	requestInterruption();
+
+	// The cancel request is lost if the thread has not entered
+	// SCardGetStatusChange yet, so repeat it until the thread returns.
+	do
+	{
+		SCardCancel(mContextHandle);
+	}
+	while (!wait(100));
+}
+
+
+void PcscReaderMonitor::run()
+{
+	if (mContextHandle == 0)
+	{
+		return;
+	}
+
+	refreshReaderNames();
+	Q_EMIT fireReaderListChanged();
+
+	while (!isInterruptionRequested())
+	{
+		if (mReaderStates.isEmpty())
+		{
+			msleep(FALLBACK_TIMEOUT);
+			if (refreshReaderNames())
+			{
+				Q_EMIT fireReaderListChanged();
+			}
+			continue;
+		}
+
+		const PCSC_INT timeout = mPnpSupported ? INFINITE : FALLBACK_TIMEOUT;
+		const PCSC_RETURNCODE returnCode = SCardGetStatusChange(mContextHandle, timeout, mReaderStates.data(), static_cast<PCSC_INT>(mReaderStates.size()));
+		if (isInterruptionRequested())
+		{
+			break;
+		}
+
+		switch (returnCode)
+		{
+			case PcscUtils::Scard_S_Success:
+				handleStates();
+				break;
+
+			case PcscUtils::Scard_E_Cancelled:
+				break;
+
+			case PcscUtils::Scard_E_Timeout:
+				if (refreshReaderNames())
+				{
+					Q_EMIT fireReaderListChanged();
+				}
+				break;
+
+			case PcscUtils::Scard_E_Unknown_Reader:
+				if (mPnpSupported)
+				{
+					qCDebug(card_pcsc) << "PnP notification not supported, falling back to polling the reader list";
+					mPnpSupported = false;
+					buildReaderStates();
+					break;
+				}
+				Q_FALLTHROUGH();
+
+			default:
+				// Let the plugin handle the error, it restarts the scan if the service is gone.
+				qCWarning(card_pcsc) << "SCardGetStatusChange:" << PcscUtils::toString(returnCode);
+				Q_EMIT fireReaderListChanged();
+				msleep(FALLBACK_TIMEOUT);
+				if (refreshReaderNames())
+				{
+					Q_EMIT fireReaderListChanged();
+				}
+		}
+	}
+
+	qCDebug(card_pcsc) << "Monitor stopped";
+}
+
+
+void PcscReaderMonitor::handleStates()
+{
+	const int offset = mPnpSupported ? 1 : 0;
+	bool listChanged = false;
+
+	for (int i = 0; i < mReaderStates.size(); ++i)
+	{
+		auto& state = mReaderStates[i];
+		if ((state.dwEventState & SCARD_STATE_CHANGED) == 0)
+		{
+			continue;
+		}
+		state.dwCurrentState = state.dwEventState;
+
+		if (i < offset)
+		{
+			if ((state.dwEventState & SCARD_STATE_UNKNOWN) != 0)
+			{
+				qCDebug(card_pcsc) << "PnP notification not supported, falling back to polling the reader list";
+				mPnpSupported = false;
+			}
+			listChanged = true;
+			continue;
+		}
+
+		Q_EMIT fireReaderStateChanged(mReaderNames.at(i - offset));
+	}
+
+	if (listChanged)
+	{
+		if (refreshReaderNames())
+		{
+			Q_EMIT fireReaderListChanged();
+		}
+		else if (!mPnpSupported && offset != 0)
+		{
+			buildReaderStates();
+		}
+	}
+}
+
+
+bool PcscReaderMonitor::refreshReaderNames()
+{
+	QStringList readerNames;
+	const PCSC_RETURNCODE returnCode = readReaderNames(mContextHandle, readerNames);
+	if (returnCode != PcscUtils::Scard_S_Success && returnCode != PcscUtils::Scard_E_No_Readers_Available)
+	{
+		return false;
+	}
+
+	if (readerNames == mReaderNames && !mReaderStates.isEmpty())
+	{
+		return false;
+	}
+
+	const bool changed = readerNames != mReaderNames;
+	mReaderNames = readerNames;
+	buildReaderStates();
+	return changed;
+}
+
+
+void PcscReaderMonitor::buildReaderStates()
+{
+	const int offset = mReaderStates.size() - static_cast<int>(mNativeReaderNames.size());
+	QHash<QString, PCSC_INT> knownStates;
+	for (int i = offset; i < mReaderStates.size(); ++i)
+	{
+		knownStates.insert(extractReaderName(mReaderStates.at(i).szReader), mReaderStates.at(i).dwCurrentState);
+	}
+	const PCSC_INT pnpState = offset > 0 ? mReaderStates.at(0).dwCurrentState : SCARD_STATE_UNAWARE;
+
+	mReaderStates.clear();
+	mNativeReaderNames.clear();
+	mNativeReaderNames.reserve(static_cast<size_t>(mReaderNames.size()));
+	for (const auto& readerName : qAsConst(mReaderNames))
+	{
+		mNativeReaderNames.push_back(toNativeReaderName(readerName));
+	}
+
+	if (mPnpSupported)
+	{
+		SCARD_READERSTATE state;
+		memset(&state, 0, sizeof(SCARD_READERSTATE));
+		state.szReader = PNP_NOTIFICATION;
+		state.dwCurrentState = pnpState;
+		mReaderStates += state;
+	}
+
+	for (int i = 0; i < mReaderNames.size(); ++i)
+	{
+		SCARD_READERSTATE state;
+		memset(&state, 0, sizeof(SCARD_READERSTATE));
+		state.szReader = mNativeReaderNames.at(static_cast<size_t>(i)).c_str();
+		state.dwCurrentState = knownStates.value(mReaderNames.at(i), SCARD_STATE_UNAWARE);
+		mReaderStates += state;
+	}
+}
+
+
+PCSC_RETURNCODE PcscReaderMonitor::readReaderNames(SCARDCONTEXT pContextHandle, QStringList& pReaderNames)
+{
+	if (pContextHandle == 0)
+	{
+		return PcscUtils::Scard_E_Invalid_Handle;
+	}
+
+	QVarLengthArray<PCSC_CHAR, 8192> readers;
+	auto maxReadersSize = static_cast<PCSC_INT>(readers.capacity());
+	PCSC_RETURNCODE returnCode = SCardListReaders(pContextHandle, nullptr, readers.data(), &maxReadersSize);
+	if (returnCode != PcscUtils::Scard_S_Success)
+	{
+		if (returnCode != PcscUtils::Scard_E_No_Readers_Available)
+		{
+			qCWarning(card_pcsc) << "SCardListReaders:" << PcscUtils::toString(returnCode);
+			qCWarning(card_pcsc) << "Cannot read reader names";
+		}
+		return returnCode;
+	}
+
+	PCSC_CHAR_PTR pReader = readers.data();
+	const PCSC_CHAR_PTR end = pReader + maxReadersSize - 1;
+	while (pReader < end)
+	{
+		QString readerName = extractReaderName(pReader);
+		pReaderNames += readerName;
+		// Advance to the next value.
+		pReader += readerName.size() + 1;
+	}
+
+	return returnCode;
+}
@@ -0,0 +1,56 @@
+/*!
+ * \brief Thread that blocks in SCardGetStatusChange and reports reader and card changes.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "PcscUtils.h"
+
+#include <QStringList>
+#include <QThread>
+#include <QVector>
+
+#include <string>
+#include <vector>
+
+
+namespace governikus
+{
+
+class PcscReaderMonitor
+	: public QThread
+{
+	Q_OBJECT
+
+	private:
+		SCARDCONTEXT mContextHandle;
+		bool mPnpSupported;
+		QStringList mReaderNames;
+		std::vector<std::basic_string<PCSC_CHAR>> mNativeReaderNames;
+		QVector<SCARD_READERSTATE> mReaderStates;
+
+		void run() override;
+
+		bool refreshReaderNames();
+		void buildReaderStates();
+		void handleStates();
+
+	public:
+		PcscReaderMonitor();
+		~PcscReaderMonitor() override;
+
+		/*!
+		 * Interrupts the blocking SCardGetStatusChange and waits for the thread to finish.
+		 */
+		void stop();
+
+		static PCSC_RETURNCODE readReaderNames(SCARDCONTEXT pContextHandle, QStringList& pReaderNames);
+
+	Q_SIGNALS:
+		void fireReaderListChanged();
+		void fireReaderStateChanged(const QString& pReaderName);
+};
+
+} // namespace governikus
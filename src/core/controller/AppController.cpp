@@ -20,6 +20,7 @@
 #include "SecureStorage.h"
 #include "UILoader.h"
 #include "UIPlugIn.h"
+#include "VolatileSettings.h"
 
 #if __has_include("RemoteClient.h")
 	#include "context/RemoteServiceContext.h"
@@ -89,7 +90,7 @@ QSharedPointer<WorkflowContext> WorkflowRequest::getContext() const
 
 bool AppController::canStartNewAction() const
 {
-	return mCurrentAction == Action::NONE && mActiveController.isNull();
+	return mCurrentAction == Action::NONE && mActiveController.isNull() && mSessionManager.isEmpty();
 }
 
 
@@ -97,6 +98,7 @@ AppController::AppController()
 	: mCurrentAction(Action::NONE)
 	, mWaitingRequest()
 	, mActiveController()
+	, mSessionManager(Env::getSingleton<VolatileSettings>()->getMaxSessions())
 	, mActivationController()
 	, mShutdownRunning(false)
 	, mUiDomination(nullptr)
@@ -118,6 +120,10 @@ AppController::AppController()
 	connect(Env::getSingleton<NetworkManager>(), &NetworkManager::fireProxyAuthenticationRequired, this, &AppController::fireProxyAuthenticationRequired);
 
 	connect(this, &AppController::fireShutdown, Env::getSingleton<NetworkManager>(), &NetworkManager::onShutdown, Qt::QueuedConnection);
+
+	connect(&mSessionManager, &WorkflowSessionManager::fireSessionStarted, this, &AppController::fireSessionStarted);
+	connect(&mSessionManager, &WorkflowSessionManager::fireSessionFinished, this, &AppController::fireSessionFinished);
+	connect(&mSessionManager, &WorkflowSessionManager::fireAllSessionsFinished, this, &AppController::onAllSessionsFinished);
 }
 
 
@@ -285,7 +291,16 @@ void AppController::onWorkflowFinished()
 		mWaitingRequest.reset();
 	}
 
-	if (mShutdownRunning)
+	if (mShutdownRunning && mSessionManager.isEmpty())
+	{
+		completeShutdown();
+	}
+}
+
+
+void AppController::onAllSessionsFinished()
+{
+	if (mShutdownRunning && mActiveController.isNull())
 	{
 		completeShutdown();
 	}
@@ -348,13 +363,20 @@ void AppController::onAuthenticationContextRequest(const QSharedPointer<Activati
 {
 	qDebug() << "Authentication requested";
 	const auto& authContext = QSharedPointer<AuthContext>::create(pActivationContext);
-	if (canStartNewAction())
+	if (mSessionManager.isEnabled())
+	{
+		// Every authentication runs in its own session on its own reader
+		if (mActiveController.isNull() && !mShutdownRunning && mSessionManager.start<AuthController>(authContext))
+		{
+			return;
+		}
+	}
+	else if (canStartNewAction())
 	{
 		startNewWorkflow<AuthController>(Action::AUTH, authContext);
 		return;
 	}
-
-	if (mCurrentAction == Action::AUTH || mCurrentAction == Action::SELF || mCurrentAction == Action::PIN)
+	else if (mCurrentAction == Action::AUTH || mCurrentAction == Action::SELF || mCurrentAction == Action::PIN)
 	{
 		const QSharedPointer<WorkflowContext> activeContext = mActiveController->getContext();
 		Q_ASSERT(!activeContext.isNull());
@@ -434,8 +456,9 @@ void AppController::doShutdown(int pExitCode)
 	mExitCode = pExitCode;
 	mShutdownRunning = true;
 	mActivationController.shutdown();
+	mSessionManager.killAll();
 
-	if (mActiveController)
+	if (mActiveController || !mSessionManager.isEmpty())
 	{
 		// Make sure that any request for a new workflow is removed from the queue.
 		mWaitingRequest.reset();
@@ -445,7 +468,7 @@ void AppController::doShutdown(int pExitCode)
 		Q_EMIT fireHideUi();
 
 		// Make sure the workflow runs to the end without user interaction.
-		const QSharedPointer<WorkflowContext> context = mActiveController->getContext();
+		const QSharedPointer<WorkflowContext> context = mActiveController ? mActiveController->getContext() : QSharedPointer<WorkflowContext>();
 		if (context)
 		{
 			context->killWorkflow();
@@ -508,7 +531,7 @@ void AppController::onUILoaderShutdownComplete()
 void AppController::onUiDominationRequested(const UIPlugIn* pUi, const QString& pInformation)
 {
 	bool accepted = false;
-	if (mUiDomination == nullptr && mCurrentAction == Action::NONE)
+	if (mUiDomination == nullptr && mCurrentAction == Action::NONE && mSessionManager.isEmpty())
 	{
 		mUiDomination = pUi;
 		accepted = true;
@@ -542,6 +565,8 @@ void AppController::onUiPlugin(UIPlugIn* pPlugin)
 	connect(this, &AppController::fireShutdown, pPlugin, &UIPlugIn::doShutdown, Qt::QueuedConnection);
 	connect(this, &AppController::fireWorkflowStarted, pPlugin, &UIPlugIn::onWorkflowStarted);
 	connect(this, &AppController::fireWorkflowFinished, pPlugin, &UIPlugIn::onWorkflowFinished);
+	connect(this, &AppController::fireSessionStarted, pPlugin, &UIPlugIn::onSessionStarted);
+	connect(this, &AppController::fireSessionFinished, pPlugin, &UIPlugIn::onSessionFinished);
 	connect(this, &AppController::fireInitialized, pPlugin, &UIPlugIn::onApplicationInitialized);
 	connect(this, &AppController::fireStarted, pPlugin, &UIPlugIn::onApplicationStarted);
 	connect(this, &AppController::fireShowUi, pPlugin, &UIPlugIn::onShowUi);
@@ -8,6 +8,7 @@
 
 #include "ActivationController.h"
 #include "EnumHelper.h"
+#include "WorkflowSessionManager.h"
 
 #include <QAbstractNativeEventFilter>
 #include <QSharedPointer>
@@ -47,6 +48,7 @@ class AppController final
 		Action mCurrentAction;
 		QScopedPointer<WorkflowRequest> mWaitingRequest;
 		QScopedPointer<WorkflowController> mActiveController;
+		WorkflowSessionManager mSessionManager;
 		ActivationController mActivationController;
 		bool mShutdownRunning;
 		const UIPlugIn* mUiDomination;
@@ -78,6 +80,8 @@ class AppController final
 		void fireShutdown();
 		void fireWorkflowStarted(QSharedPointer<WorkflowContext> pContext);
 		void fireWorkflowFinished(QSharedPointer<WorkflowContext> pContext);
+		void fireSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext);
+		void fireSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext);
 		void fireShowUi(UiModule pModule);
 		void fireHideUi();
 		void fireShowUserInformation(const QString& pInformationMessage);
@@ -93,6 +97,7 @@ class AppController final
 		void doShutdown(int pExitCode);
 		void onUiPlugin(UIPlugIn* pPlugin);
 		void onWorkflowFinished();
+		void onAllSessionsFinished();
 		void onCloseReminderFinished(bool pDontRemindAgain);
 		void onChangePinRequested(bool pRequestTransportPin);
 		void onSelfAuthenticationRequested();
@@ -0,0 +1,167 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "WorkflowSessionManager.h"
+
+#include "ReaderManager.h"
+
+#include <algorithm>
+#include <QLoggingCategory>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(support)
+
+
+WorkflowSessionManager::WorkflowSessionManager(int pMaxSessions)
+	: QObject()
+	, mMaxSessions(pMaxSessions)
+	, mNextId(1)
+	, mSessions()
+{
+	setObjectName(QStringLiteral("WorkflowSessionManager"));
+}
+
+
+WorkflowSessionManager::~WorkflowSessionManager()
+{
+	if (!mSessions.isEmpty())
+	{
+		qWarning() << "Destroying" << mSessions.size() << "running sessions";
+	}
+}
+
+
+bool WorkflowSessionManager::isBound(const QString& pReaderName) const
+{
+	return std::any_of(mSessions.constBegin(), mSessions.constEnd(), [&pReaderName](const Session& pSession){
+			return pSession.mReaderName == pReaderName;
+		});
+}
+
+
+ReaderInfo WorkflowSessionManager::admit() const
+{
+	if (mSessions.size() >= mMaxSessions)
+	{
+		qWarning() << "Session rejected, limit of" << mMaxSessions << "sessions reached";
+		return ReaderInfo();
+	}
+
+	ReaderInfo idleReader;
+	const auto& readerInfos = Env::getSingleton<ReaderManager>()->getReaderInfos();
+	for (const auto& info : readerInfos)
+	{
+		if (!info.isConnected() || isBound(info.getName()))
+		{
+			continue;
+		}
+
+		if (info.hasEidCard())
+		{
+			return info;
+		}
+
+		if (idleReader.getName().isEmpty())
+		{
+			idleReader = info;
+		}
+	}
+
+	if (idleReader.getName().isEmpty())
+	{
+		qWarning() << "Session rejected, no idle reader available";
+	}
+	return idleReader;
+}
+
+
+void WorkflowSessionManager::addSession(const ReaderInfo& pReaderInfo, const QSharedPointer<WorkflowController>& pController)
+{
+	const quint64 id = mNextId++;
+	mSessions += Session{id, pReaderInfo.getName(), pController};
+
+	qCInfo(support) << "Starting session" << id << "on" << pReaderInfo.getName() << '|' << mSessions.size() << "of" << mMaxSessions << "sessions running";
+	connect(pController.data(), &WorkflowController::fireComplete, this, [this, id] {
+			onSessionFinished(id);
+		}, Qt::QueuedConnection);
+
+	// The UI of the session must be connected before the first state is entered.
+	Q_EMIT fireSessionStarted(id, pController->getContext());
+	pController->run();
+}
+
+
+void WorkflowSessionManager::onSessionFinished(quint64 pId)
+{
+	const auto session = std::find_if(mSessions.begin(), mSessions.end(), [pId](const Session& pSession){
+			return pSession.mId == pId;
+		});
+	if (session == mSessions.end())
+	{
+		return;
+	}
+
+	const auto controller = session->mController;
+	mSessions.erase(session);
+	qCInfo(support) << "Finished session" << pId << '|' << mSessions.size() << "sessions running";
+
+	Q_EMIT fireSessionFinished(pId, controller->getContext());
+	if (mSessions.isEmpty())
+	{
+		Q_EMIT fireAllSessionsFinished();
+	}
+}
+
+
+bool WorkflowSessionManager::isEnabled() const
+{
+	return mMaxSessions > 1;
+}
+
+
+int WorkflowSessionManager::getMaxSessions() const
+{
+	return mMaxSessions;
+}
+
+
+void WorkflowSessionManager::setMaxSessions(int pMaxSessions)
+{
+	mMaxSessions = pMaxSessions;
+}
+
+
+int WorkflowSessionManager::getSessionCount() const
+{
+	return mSessions.size();
+}
+
+
+bool WorkflowSessionManager::isEmpty() const
+{
+	return mSessions.isEmpty();
+}
+
+
+QStringList WorkflowSessionManager::getBoundReaderNames() const
+{
+	QStringList readerNames;
+	for (const auto& session : qAsConst(mSessions))
+	{
+		readerNames += session.mReaderName;
+	}
+	return readerNames;
+}
+
+
+void WorkflowSessionManager::killAll()
+{
+	for (const auto& session : qAsConst(mSessions))
+	{
+		session.mController->getContext()->killWorkflow();
+	}
+}
@@ -0,0 +1,92 @@
+/*!
+ * \brief Hosts several workflows that run concurrently, each bound to its own reader.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "context/WorkflowContext.h"
+#include "controller/WorkflowController.h"
+#include "ReaderInfo.h"
+
+#include <QObject>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QVector>
+
+class test_WorkflowSessionManager;
+
+namespace governikus
+{
+
+class WorkflowSessionManager
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		friend class ::test_WorkflowSessionManager;
+
+		struct Session
+		{
+			quint64 mId;
+			QString mReaderName;
+			QSharedPointer<WorkflowController> mController;
+		};
+
+		int mMaxSessions;
+		quint64 mNextId;
+		QVector<Session> mSessions;
+
+		[[nodiscard]] bool isBound(const QString& pReaderName) const;
+		[[nodiscard]] ReaderInfo admit() const;
+		void addSession(const ReaderInfo& pReaderInfo, const QSharedPointer<WorkflowController>& pController);
+		void onSessionFinished(quint64 pId);
+
+	public:
+		explicit WorkflowSessionManager(int pMaxSessions);
+		~WorkflowSessionManager() override;
+
+		/*!
+		 * Concurrent sessions are only used if more than one session is allowed.
+		 * Otherwise the AppController runs one workflow at a time.
+		 */
+		[[nodiscard]] bool isEnabled() const;
+		[[nodiscard]] int getMaxSessions() const;
+		void setMaxSessions(int pMaxSessions);
+
+		[[nodiscard]] int getSessionCount() const;
+		[[nodiscard]] bool isEmpty() const;
+		[[nodiscard]] QStringList getBoundReaderNames() const;
+
+		/*!
+		 * Starts a new session if the limit is not reached and a reader is available
+		 * that is not bound to another session. Readers with an eID card are preferred.
+		 * \return false if the session is not admitted.
+		 */
+		template<typename Controller, typename Context>
+		bool start(const QSharedPointer<Context>& pContext)
+		{
+			const ReaderInfo readerInfo = admit();
+			if (readerInfo.getName().isEmpty())
+			{
+				return false;
+			}
+
+			pContext->setBoundReaderName(readerInfo.getName());
+			pContext->setReaderPlugInTypes({readerInfo.getPlugInType()});
+			addSession(readerInfo, QSharedPointer<WorkflowController>(new Controller(pContext), &QObject::deleteLater));
+			return true;
+		}
+
+
+		void killAll();
+
+	Q_SIGNALS:
+		void fireSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext);
+		void fireSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext);
+		void fireAllSessionsFinished();
+};
+
+} // namespace governikus
@@ -0,0 +1,217 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogFileWriter.h"
+
+#include <QMutexLocker>
+#include <QScopeGuard>
+
+using namespace governikus;
+
+
+const int LogFileWriter::CAPACITY = 1024 * 1024;
+const unsigned long LogFileWriter::FLUSH_INTERVAL = 500;
+
+
+LogFileWriter::LogFileWriter(int pCapacity, unsigned long pFlushInterval)
+	: QThread()
+	, mCapacity(pCapacity)
+	, mFlushInterval(pFlushInterval)
+	, mFileMutex()
+	, mFile(nullptr)
+	, mWriteBuffer()
+	, mBufferMutex()
+	, mPendingCondition()
+	, mFreeCondition()
+	, mBuffer()
+	, mPosition(0)
+	, mAsync(false)
+	, mFlushRequested(false)
+	, mStopRequested(false)
+{
+	setObjectName(QStringLiteral("LogFileWriter"));
+
+	// Both buffers are swapped on every write and keep their capacity.
+	mBuffer.reserve(mCapacity);
+	mWriteBuffer.reserve(mCapacity);
+}
+
+
+LogFileWriter::~LogFileWriter()
+{
+	setAsync(false);
+}
+
+
+void LogFileWriter::writeBuffer()
+{
+	{
+		const QMutexLocker bufferLocker(&mBufferMutex);
+		if (mBuffer.isEmpty())
+		{
+			return;
+		}
+
+		mWriteBuffer.swap(mBuffer);
+		mFreeCondition.wakeAll();
+	}
+
+	if (mFile && mFile->isOpen() && mFile->isWritable())
+	{
+		mFile->write(mWriteBuffer);
+	}
+	mWriteBuffer.resize(0);
+}
+
+
+void LogFileWriter::run()
+{
+	QMutexLocker bufferLocker(&mBufferMutex);
+	while (!mStopRequested)
+	{
+		if (!mFlushRequested && mBuffer.size() < mCapacity / 2)
+		{
+			mPendingCondition.wait(&mBufferMutex, mFlushInterval);
+		}
+		mFlushRequested = false;
+
+		if (mBuffer.isEmpty())
+		{
+			continue;
+		}
+
+		bufferLocker.unlock();
+		flush();
+		bufferLocker.relock();
+	}
+}
+
+
+void LogFileWriter::setFile(QFileDevice* pFile)
+{
+	const QMutexLocker fileLocker(&mFileMutex);
+	writeBuffer();
+	if (mFile && mFile->isOpen())
+	{
+		mFile->flush();
+	}
+
+	const QMutexLocker bufferLocker(&mBufferMutex);
+	mFile = pFile;
+	mPosition = mFile ? mFile->pos() : 0;
+}
+
+
+void LogFileWriter::setAsync(bool pAsync)
+{
+	if (pAsync == isAsync())
+	{
+		return;
+	}
+
+	if (pAsync)
+	{
+		{
+			const QMutexLocker bufferLocker(&mBufferMutex);
+			mAsync = true;
+			mStopRequested = false;
+		}
+		start();
+		return;
+	}
+
+	{
+		const QMutexLocker bufferLocker(&mBufferMutex);
+		mAsync = false;
+		mStopRequested = true;
+		mPendingCondition.wakeOne();
+		mFreeCondition.wakeAll();
+	}
+	wait();
+	flush();
+}
+
+
+bool LogFileWriter::isAsync()
+{
+	const QMutexLocker bufferLocker(&mBufferMutex);
+	return mAsync;
+}
+
+
+qint64 LogFileWriter::getPosition()
+{
+	const QMutexLocker bufferLocker(&mBufferMutex);
+	return mPosition;
+}
+
+
+void LogFileWriter::append(const QByteArray& pData, bool pRequestFlush)
+{
+	QMutexLocker bufferLocker(&mBufferMutex);
+	if (mFile == nullptr)
+	{
+		return;
+	}
+
+	while (mAsync && mBuffer.size() >= mCapacity)
+	{
+		mPendingCondition.wakeOne();
+		mFreeCondition.wait(&mBufferMutex);
+	}
+
+	mPosition += pData.size();
+
+	if (mAsync)
+	{
+		mBuffer += pData;
+		if (pRequestFlush || mBuffer.size() >= mCapacity / 2)
+		{
+			mFlushRequested = true;
+			mPendingCondition.wakeOne();
+		}
+		return;
+	}
+
+	bufferLocker.unlock();
+
+	const QMutexLocker fileLocker(&mFileMutex);
+	if (mFile && mFile->isOpen() && mFile->isWritable())
+	{
+		mFile->write(pData);
+		mFile->flush();
+	}
+}
+
+
+void LogFileWriter::flush()
+{
+	const QMutexLocker fileLocker(&mFileMutex);
+	writeBuffer();
+	if (mFile && mFile->isOpen())
+	{
+		mFile->flush();
+	}
+}
+
+
+bool LogFileWriter::read(qint64 pStart, qint64 pLength, QByteArray& pData)
+{
+	const QMutexLocker fileLocker(&mFileMutex);
+	writeBuffer();
+
+	if (mFile == nullptr || !mFile->isOpen() || !mFile->isReadable())
+	{
+		return false;
+	}
+
+	const auto currentPos = mFile->pos();
+	const auto resetPosition = qScopeGuard([this, currentPos] {
+			mFile->seek(currentPos);
+		});
+
+	mFile->seek(pStart);
+	pData = pLength > 0 ? mFile->read(pLength) : mFile->readAll();
+	return true;
+}
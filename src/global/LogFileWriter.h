@@ -0,0 +1,98 @@
+/*!
+ * \brief Buffered writer of the log file that writes and flushes in a background thread.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QFileDevice>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+class test_LogHandler;
+
+namespace governikus
+{
+
+/*!
+ * Producers append to an in-memory buffer that is only locked for the copy of
+ * the message. The background thread swaps the buffer, writes it as a batch and
+ * flushes the file every FLUSH_INTERVAL milliseconds, if the buffer is half full
+ * or if a flush is requested. If the buffer is full the producer waits for the
+ * writer, so no message is dropped. A lock-free queue would not help here, as
+ * the LogHandler already serializes all producers with its own mutex.
+ *
+ * Without a running thread every write goes to the file immediately.
+ *
+ * \note Never log from this class, it is used inside the message handler.
+ */
+class LogFileWriter
+	: public QThread
+{
+	Q_OBJECT
+
+	friend class ::test_LogHandler;
+
+	private:
+		const int mCapacity;
+		const unsigned long mFlushInterval;
+
+		QMutex mFileMutex;
+		QFileDevice* mFile;
+		QByteArray mWriteBuffer;
+
+		QMutex mBufferMutex;
+		QWaitCondition mPendingCondition;
+		QWaitCondition mFreeCondition;
+		QByteArray mBuffer;
+		qint64 mPosition;
+		bool mAsync;
+		bool mFlushRequested;
+		bool mStopRequested;
+
+		// Requires a locked mFileMutex
+		void writeBuffer();
+
+	protected:
+		void run() override;
+
+	public:
+		static const int CAPACITY;
+		static const unsigned long FLUSH_INTERVAL;
+
+		explicit LogFileWriter(int pCapacity = CAPACITY, unsigned long pFlushInterval = FLUSH_INTERVAL);
+		~LogFileWriter() override;
+
+		/*!
+		 * Writes all pending data to the current file and uses the given one from now on.
+		 * The file must be open. Use nullptr to stop writing.
+		 */
+		void setFile(QFileDevice* pFile);
+
+		void setAsync(bool pAsync);
+		[[nodiscard]] bool isAsync();
+
+		/*!
+		 * Returns the position in the file that the next appended data will have,
+		 * including the data that is still buffered.
+		 */
+		[[nodiscard]] qint64 getPosition();
+
+		/*!
+		 * Appends the data to the file. Must not be called concurrently, the LogHandler
+		 * serializes all messages anyway.
+		 */
+		void append(const QByteArray& pData, bool pRequestFlush = false);
+		void flush();
+
+		/*!
+		 * Reads from the file after all pending data is written.
+		 * \return false if there is no readable file.
+		 */
+		bool read(qint64 pStart, qint64 pLength, QByteArray& pData);
+};
+
+} // namespace governikus
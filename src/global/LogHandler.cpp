@@ -8,7 +8,6 @@
 
 #include <QCoreApplication>
 #include <QDir>
-#include <QScopeGuard>
 #include <QStringBuilder>
 
 using namespace governikus;
@@ -32,12 +31,16 @@ LogHandler::LogHandler()
 	, mEnvPattern(!qEnvironmentVariableIsEmpty("QT_MESSAGE_PATTERN"))
 	, mFunctionFilenameSize(74)
 	, mBacklogPosition(0)
+	, mBacklogLine(0)
 	, mCriticalLog(false)
 	, mCriticalLogWindow(10)
 	, mCriticalLogIgnore({LOGCAT(fileprovider), LOGCAT(securestorage), LOGCAT(configuration)})
 	, mMessagePattern(QStringLiteral("%{category} %{time yyyy.MM.dd hh:mm:ss.zzz} %{threadid} %{if-debug} %{endif}%{if-info}I%{endif}%{if-warning}W%{endif}%{if-critical}C%{endif}%{if-fatal}F%{endif} %{function}(%{file}:%{line}) %{message}"))
 	, mDefaultMessagePattern(QStringLiteral("%{if-category}%{category}: %{endif}%{message}")) // as defined in qlogging.cpp
 	, mLogFile()
+	, mLogFileWriter()
+	, mLineIndex(0, LogLineIndex::MAX_LINES)
+	, mAsyncWrite(true)
 	, mHandler(nullptr)
 	, mUseHandler(true)
 	, mAutoRemove(true)
@@ -100,11 +103,15 @@ void LogHandler::init()
 	{
 		mLogFile = new QTemporaryFile(getLogFileTemplate());
 		QObject::connect(QCoreApplication::instance(), &QCoreApplication::destroyed, mLogFile.data(), [this] {
+				const QMutexLocker locker(&mMutex);
+				mLogFileWriter.setAsync(false);
+				mLogFileWriter.setFile(nullptr);
 				delete this->mLogFile.data();
 			});
 
 		setAutoRemove(mAutoRemove);
 		setLogFileInternal(mUseLogFile);
+		mLogFileWriter.setAsync(mAsyncWrite);
 
 		// Avoid deadlock with subsequent logging of this call.
 		QMetaObject::invokeMethod(mLogFile.data(), [this] {removeOldLogFiles();}, Qt::QueuedConnection);
@@ -139,27 +146,24 @@ void LogHandler::setAutoRemove(bool pRemove)
 }
 
 
-void LogHandler::logToFile(const QString& pOutput)
+void LogHandler::logToFile(QtMsgType pType, const QByteArray& pOutput)
 {
-	if (mLogFile && mLogFile->isOpen() && mLogFile->isWritable())
+	mLineIndex.append(pOutput);
+	mLogFileWriter.append(pOutput, pType == QtCriticalMsg);
+
+	// The application aborts after a fatal message
+	if (pType == QtFatalMsg)
 	{
-		mLogFile->write(pOutput.toUtf8());
-		mLogFile->flush();
+		mLogFileWriter.flush();
 	}
 }
 
 
 QByteArray LogHandler::readLogFile(qint64 pStart, qint64 pLength)
 {
-	if (mLogFile && mLogFile->isOpen() && mLogFile->isReadable())
+	if (QByteArray data; mLogFileWriter.read(pStart, pLength, data))
 	{
-		const auto currentPos = mLogFile->pos();
-		const auto resetPosition = qScopeGuard([this, currentPos] {
-				mLogFile->seek(currentPos);
-			});
-
-		mLogFile->seek(pStart);
-		return pLength > 0 ? mLogFile->read(pLength) : mLogFile->readAll();
+		return data;
 	}
 
 	if (useLogFile())
@@ -179,6 +183,47 @@ QByteArray LogHandler::getBacklog(bool pAll)
 }
 
 
+int LogHandler::getLineCount(bool pAll)
+{
+	const QMutexLocker mutexLocker(&mMutex);
+
+	if (!useLogFile())
+	{
+		return 0;
+	}
+
+	return mLineIndex.getLineCount() - (pAll ? 0 : mBacklogLine);
+}
+
+
+QByteArray LogHandler::getLines(int pOffset, int pCount, bool pAll)
+{
+	const QMutexLocker mutexLocker(&mMutex);
+
+	if (!useLogFile())
+	{
+		return QByteArray();
+	}
+
+	const int first = pOffset + (pAll ? 0 : mBacklogLine);
+	const int available = mLineIndex.getLineCount() - first;
+	if (pOffset < 0 || pCount <= 0 || available <= 0)
+	{
+		return QByteArray();
+	}
+
+	const qint64 start = mLineIndex.getLineStart(first);
+	const qint64 end = mLineIndex.getLineStart(first + qMin(pCount, available));
+	if (end <= start)
+	{
+		// The requested lines are dropped from the index
+		return QByteArray();
+	}
+
+	return readLogFile(start, end - start);
+}
+
+
 QByteArray LogHandler::getCriticalLogWindow()
 {
 	const QMutexLocker mutexLocker(&mMutex);
@@ -236,7 +281,9 @@ void LogHandler::resetBacklog()
 
 	if (useLogFile())
 	{
-		mBacklogPosition = mLogFile->pos();
+		mBacklogPosition = mLogFileWriter.getPosition();
+		mBacklogLine = mLineIndex.getLine(mBacklogPosition);
+		mLineIndex.drop(mBacklogPosition);
 		mCriticalLog = false;
 		mCriticalLogWindow.clear();
 	}
@@ -371,8 +418,12 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 #endif
 
 	const QString logMsg = qFormatLogMessage(pType, ctx, message) + lineBreak;
-	handleLogWindow(pType, pContext.category, logMsg);
-	logToFile(logMsg);
+	if (useLogFile())
+	{
+		const QByteArray output = logMsg.toUtf8();
+		handleLogWindow(pType, pContext.category, output.size());
+		logToFile(pType, output);
+	}
 
 	if (Q_LIKELY(mUseHandler))
 	{
@@ -392,13 +443,8 @@ void LogHandler::handleMessage(QtMsgType pType, const QMessageLogContext& pConte
 }
 
 
-void LogHandler::handleLogWindow(QtMsgType pType, const char* pCategory, const QString& pMsg)
+void LogHandler::handleLogWindow(QtMsgType pType, const char* pCategory, qint64 pLength)
 {
-	if (!useLogFile())
-	{
-		return;
-	}
-
 	if (mCriticalLog && mCriticalLogWindow.isFull())
 	{
 		return;
@@ -408,7 +454,7 @@ void LogHandler::handleLogWindow(QtMsgType pType, const char* pCategory, const Q
 		mCriticalLog = true;
 	}
 
-	mCriticalLogWindow.append({mLogFile->pos(), pMsg.size()});
+	mCriticalLogWindow.append({mLogFileWriter.getPosition(), pLength});
 }
 
 
@@ -418,6 +464,7 @@ bool LogHandler::copy(const QString& pDest)
 
 	if (useLogFile())
 	{
+		mLogFileWriter.flush();
 		return copyOther(mLogFile->fileName(), pDest);
 	}
 
@@ -513,16 +560,23 @@ void LogHandler::setLogFileInternal(bool pEnable)
 		if (!mLogFile->isOpen())
 		{
 			mLogFile->setFileTemplate(getLogFileTemplate());
-			mLogFile->open();
+			if (mLogFile->open())
+			{
+				mLogFileWriter.setFile(mLogFile.data());
+				mLineIndex.clear(mLogFileWriter.getPosition());
+			}
 		}
 	}
 	else
 	{
 		if (mLogFile->isOpen())
 		{
+			mLogFileWriter.setFile(nullptr);
 			mLogFile->close();
 			mLogFile->remove();
+			mLineIndex.clear();
 			mBacklogPosition = 0;
+			mBacklogLine = 0;
 			mCriticalLog = false;
 			mCriticalLogWindow.clear();
 		}
@@ -549,6 +603,25 @@ bool LogHandler::useHandler() const
 }
 
 
+void LogHandler::setAsyncWrite(bool pEnable)
+{
+	const QMutexLocker mutexLocker(&mMutex);
+	mAsyncWrite = pEnable;
+
+	// The writer is started by init()
+	if (mLogFile)
+	{
+		mLogFileWriter.setAsync(mAsyncWrite);
+	}
+}
+
+
+bool LogHandler::useAsyncWrite() const
+{
+	return mAsyncWrite;
+}
+
+
 void LogHandler::messageHandler(QtMsgType pType, const QMessageLogContext& pContext, const QString& pMsg)
 {
 	getInstance().handleMessage(pType, pContext, pMsg);
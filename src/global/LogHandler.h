@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Env.h"
+#include "LogFileWriter.h"
+#include "LogLineIndex.h"
 
 #include <QContiguousCache>
 #include <QDateTime>
@@ -69,11 +71,15 @@ class LogHandler
 		const bool mEnvPattern;
 		const int mFunctionFilenameSize;
 		qint64 mBacklogPosition;
+		int mBacklogLine;
 		bool mCriticalLog;
 		QContiguousCache<LogWindowEntry> mCriticalLogWindow;
 		QStringList mCriticalLogIgnore;
 		const QString mMessagePattern, mDefaultMessagePattern;
 		QPointer<QTemporaryFile> mLogFile;
+		LogFileWriter mLogFileWriter;
+		LogLineIndex mLineIndex;
+		bool mAsyncWrite;
 		QtMessageHandler mHandler;
 		bool mUseHandler;
 		bool mAutoRemove;
@@ -86,14 +92,14 @@ class LogHandler
 				const QByteArray& pFilename = QByteArray(),
 				const QByteArray& pFunction = QByteArray(),
 				const QByteArray& pCategory = QByteArray()) const;
-		inline void logToFile(const QString& pOutput);
+		inline void logToFile(QtMsgType pType, const QByteArray& pOutput);
 		inline QByteArray formatFunction(const char* const pFunction, const QByteArray& pFilename, int pLine) const;
 		inline QByteArray formatFilename(const char* const pFilename) const;
 		[[nodiscard]] inline QByteArray formatCategory(const QByteArray& pCategory) const;
 
 		[[nodiscard]] QString getPaddedLogMsg(const QMessageLogContext& pContext, const QString& pMsg) const;
 		void handleMessage(QtMsgType pType, const QMessageLogContext& pContext, const QString& pMsg);
-		void handleLogWindow(QtMsgType pType, const char* pCategory, const QString& pMsg);
+		void handleLogWindow(QtMsgType pType, const char* pCategory, qint64 pLength);
 		void removeOldLogFiles();
 		QByteArray readLogFile(qint64 pStart, qint64 pLength = -1);
 		void setLogFileInternal(bool pEnable);
@@ -122,6 +128,18 @@ class LogHandler
 		[[nodiscard]] bool copyOther(const QString& pSource, const QString& pDest) const;
 		void resetBacklog();
 		QByteArray getBacklog(bool pAll = false);
+
+		/*!
+		 * Returns the number of lines of the backlog or of the whole log file.
+		 */
+		[[nodiscard]] int getLineCount(bool pAll = false);
+
+		/*!
+		 * Returns up to pCount lines of the backlog or of the whole log file, starting
+		 * with line pOffset. Only the requested range is read from the log file.
+		 * Lines before the backlog are not indexed anymore, so they are empty for pAll.
+		 */
+		QByteArray getLines(int pOffset, int pCount, bool pAll = false);
 		QByteArray getCriticalLogWindow();
 		[[nodiscard]] bool hasCriticalLog() const;
 		[[nodiscard]] int getCriticalLogCapacity() const;
@@ -135,6 +153,13 @@ class LogHandler
 		[[nodiscard]] bool useLogFile() const;
 		void setUseHandler(bool pEnable);
 		[[nodiscard]] bool useHandler() const;
+
+		/*!
+		 * Writes the log file in a background thread instead of the thread that logs.
+		 * Reading the log file always sees every message logged so far.
+		 */
+		void setAsyncWrite(bool pEnable);
+		[[nodiscard]] bool useAsyncWrite() const;
 };
 
 inline QDebug operator<<(QDebug pDbg, const governikus::LogHandler& pHandler)
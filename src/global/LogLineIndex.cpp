@@ -0,0 +1,107 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "LogLineIndex.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace governikus;
+
+
+const int LogLineIndex::MAX_LINES = 200000;
+
+
+LogLineIndex::LogLineIndex(qint64 pPosition, int pMaxLines)
+	: mMaxLines(pMaxLines)
+	, mDroppedLines(0)
+	, mLineStarts()
+	, mEnd(pPosition)
+	, mLineOpen(false)
+{
+}
+
+
+void LogLineIndex::clear(qint64 pPosition)
+{
+	mDroppedLines = 0;
+	mLineStarts.clear();
+	mEnd = pPosition;
+	mLineOpen = false;
+}
+
+
+void LogLineIndex::append(const char* pData, qint64 pSize)
+{
+	qint64 i = 0;
+	while (i < pSize)
+	{
+		if (!mLineOpen)
+		{
+			mLineStarts += mEnd + i;
+			mLineOpen = true;
+		}
+
+		const auto* lineBreak = static_cast<const char*>(memchr(pData + i, '\n', static_cast<size_t>(pSize - i)));
+		if (lineBreak == nullptr)
+		{
+			break;
+		}
+
+		i = lineBreak - pData + 1;
+		mLineOpen = false;
+	}
+
+	mEnd += pSize;
+
+	if (mMaxLines > 0 && mLineStarts.size() > mMaxLines)
+	{
+		// Dropping a quarter of the lines at once avoids to move the vector on every line.
+		const int count = mLineStarts.size() - mMaxLines + mMaxLines / 4;
+		mLineStarts.remove(0, count);
+		mDroppedLines += count;
+	}
+}
+
+
+void LogLineIndex::append(const QByteArray& pData)
+{
+	append(pData.constData(), pData.size());
+}
+
+
+void LogLineIndex::drop(qint64 pPosition)
+{
+	const auto line = std::lower_bound(mLineStarts.constBegin(), mLineStarts.constEnd(), pPosition);
+	const auto count = static_cast<int>(line - mLineStarts.constBegin());
+	mLineStarts.remove(0, count);
+	mDroppedLines += count;
+}
+
+
+int LogLineIndex::getLineCount() const
+{
+	return mDroppedLines + mLineStarts.size();
+}
+
+
+qint64 LogLineIndex::getEnd() const
+{
+	return mEnd;
+}
+
+
+int LogLineIndex::getLine(qint64 pPosition) const
+{
+	const auto line = std::lower_bound(mLineStarts.constBegin(), mLineStarts.constEnd(), pPosition);
+	return mDroppedLines + static_cast<int>(line - mLineStarts.constBegin());
+}
+
+
+qint64 LogLineIndex::getLineStart(int pLine) const
+{
+	Q_ASSERT(pLine >= 0);
+	const int line = qMax(0, pLine - mDroppedLines);
+	return line < mLineStarts.size() ? mLineStarts.at(line) : mEnd;
+}
@@ -0,0 +1,67 @@
+/*!
+ * \brief Index of the line offsets of a log file.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QVector>
+
+namespace governikus
+{
+
+/*!
+ * Keeps the start offset of every line so that a range of lines can be read
+ * without scanning the file. The data is appended in the order it is written
+ * and a line may span several appends. Lines can be dropped from the front, but
+ * the remaining lines keep their number.
+ *
+ * \note Never log from this class, it is used inside the message handler.
+ */
+class LogLineIndex
+{
+	private:
+		const int mMaxLines;
+		int mDroppedLines;
+		QVector<qint64> mLineStarts;
+		qint64 mEnd;
+		bool mLineOpen;
+
+	public:
+		static const int MAX_LINES;
+
+		/*!
+		 * Keeps at most pMaxLines lines and drops the oldest ones, use 0 to keep all lines.
+		 */
+		explicit LogLineIndex(qint64 pPosition = 0, int pMaxLines = 0);
+
+		/*!
+		 * Removes all lines, the next appended data starts at the given position.
+		 */
+		void clear(qint64 pPosition = 0);
+		void append(const char* pData, qint64 pSize);
+		void append(const QByteArray& pData);
+
+		/*!
+		 * Drops all lines that start before the given position.
+		 */
+		void drop(qint64 pPosition);
+
+		[[nodiscard]] int getLineCount() const;
+		[[nodiscard]] qint64 getEnd() const;
+
+		/*!
+		 * Returns the first line that starts at or after the given position.
+		 */
+		[[nodiscard]] int getLine(qint64 pPosition) const;
+
+		/*!
+		 * Returns the start of the line or the end of the data if there is no such line.
+		 * A dropped line starts at the first line that is left.
+		 */
+		[[nodiscard]] qint64 getLineStart(int pLine) const;
+};
+
+} // namespace governikus
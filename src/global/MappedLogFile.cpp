@@ -0,0 +1,108 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "MappedLogFile.h"
+
+#include <QLoggingCategory>
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(fileprovider)
+
+
+MappedLogFile::MappedLogFile(const QString& pFileName, bool pMap)
+	: mFile(pFileName)
+	, mData(nullptr)
+	, mIndex()
+{
+	if (!mFile.open(QIODevice::ReadOnly))
+	{
+		qCWarning(fileprovider) << "Cannot open log file" << pFileName << '|' << mFile.errorString();
+		return;
+	}
+
+	// An empty file cannot be mapped and has no lines anyway.
+	if (pMap && mFile.size() > 0)
+	{
+		mData = mFile.map(0, mFile.size());
+		if (mData == nullptr)
+		{
+			qCDebug(fileprovider) << "Cannot map log file, reading it instead:" << mFile.errorString();
+		}
+	}
+
+	buildIndex();
+}
+
+
+MappedLogFile::~MappedLogFile()
+{
+	if (mData)
+	{
+		mFile.unmap(const_cast<uchar*>(mData));
+	}
+}
+
+
+void MappedLogFile::buildIndex()
+{
+	if (mData)
+	{
+		mIndex.append(reinterpret_cast<const char*>(mData), mFile.size());
+		return;
+	}
+
+	const qint64 CHUNK_SIZE = 64 * 1024;
+	QByteArray chunk(CHUNK_SIZE, Qt::Uninitialized);
+	qint64 read = 0;
+	while ((read = mFile.read(chunk.data(), CHUNK_SIZE)) > 0)
+	{
+		mIndex.append(chunk.constData(), read);
+	}
+}
+
+
+bool MappedLogFile::isOpen() const
+{
+	return mFile.isOpen();
+}
+
+
+bool MappedLogFile::isMapped() const
+{
+	return mData != nullptr;
+}
+
+
+QString MappedLogFile::getFileName() const
+{
+	return mFile.fileName();
+}
+
+
+int MappedLogFile::getLineCount() const
+{
+	return mIndex.getLineCount();
+}
+
+
+QByteArray MappedLogFile::getLines(int pOffset, int pCount)
+{
+	if (!isOpen() || pOffset < 0 || pCount <= 0 || pOffset >= mIndex.getLineCount())
+	{
+		return QByteArray();
+	}
+
+	const qint64 start = mIndex.getLineStart(pOffset);
+	const qint64 end = mIndex.getLineStart(pOffset + qMin(pCount, mIndex.getLineCount() - pOffset));
+
+	if (mData)
+	{
+		return QByteArray(reinterpret_cast<const char*>(mData + start), static_cast<int>(end - start));
+	}
+
+	mFile.seek(start);
+	return mFile.read(end - start);
+}
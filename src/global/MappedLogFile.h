@@ -0,0 +1,50 @@
+/*!
+ * \brief Read-only access to the lines of an old log file.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "LogLineIndex.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+namespace governikus
+{
+
+/*!
+ * Indexes the lines of a log file once and reads only the requested ranges
+ * afterwards. The file is memory-mapped if possible, otherwise the ranges
+ * are read from the file.
+ */
+class MappedLogFile
+{
+	Q_DISABLE_COPY(MappedLogFile)
+
+	private:
+		QFile mFile;
+		const uchar* mData;
+		LogLineIndex mIndex;
+
+		void buildIndex();
+
+	public:
+		explicit MappedLogFile(const QString& pFileName, bool pMap = true);
+		~MappedLogFile();
+
+		[[nodiscard]] bool isOpen() const;
+		[[nodiscard]] bool isMapped() const;
+		[[nodiscard]] QString getFileName() const;
+
+		[[nodiscard]] int getLineCount() const;
+
+		/*!
+		 * Returns up to pCount lines starting with line pOffset, including the line breaks.
+		 */
+		[[nodiscard]] QByteArray getLines(int pOffset, int pCount);
+};
+
+} // namespace governikus
@@ -12,6 +12,7 @@
 #include "PortFile.h"
 #include "SingletonHelper.h"
 #include "UILoader.h"
+#include "VolatileSettings.h"
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
 #include "HttpServer.h"
@@ -35,6 +36,11 @@ CommandLineParser::CommandLineParser()
 	, mOptionProxy(QStringLiteral("no-proxy"), QStringLiteral("Ignore proxy settings."))
 	, mOptionUi(QStringLiteral("ui"), QStringLiteral("Use given UI plugin."), UILoader::getDefault().join(QLatin1Char(',')))
 	, mOptionPort(QStringLiteral("port"), QStringLiteral("Use listening port."), QString::number(PortFile::cDefaultPort))
+	, mOptionSessions(QStringLiteral("sessions"), QStringLiteral("Maximum number of concurrent authentications, each on its own reader."), QString::number(Env::getSingleton<VolatileSettings>()->getMaxSessions()))
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+	, mOptionHttpConnections(QStringLiteral("http-connections"), QStringLiteral("Maximum number of open connections of the local HTTP server."), QString::number(HttpServer::cMaxConnections))
+	, mOptionHttpIdleTimeout(QStringLiteral("http-idle-timeout"), QStringLiteral("Idle timeout in seconds of connections that are kept alive, 0 disables keep-alive."), QString::number(HttpServer::cIdleTimeout))
+#endif
 {
 	addOptions();
 }
@@ -56,6 +62,12 @@ void CommandLineParser::addOptions()
 	mParser.addOption(mOptionProxy);
 	mParser.addOption(mOptionUi);
 	mParser.addOption(mOptionPort);
+	mParser.addOption(mOptionSessions);
+
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+	mParser.addOption(mOptionHttpConnections);
+	mParser.addOption(mOptionHttpIdleTimeout);
+#endif
 }
 
 
@@ -94,6 +106,38 @@ void CommandLineParser::parse(QCoreApplication* pApp)
 #endif
 		}
 	}
+
+	if (mParser.isSet(mOptionSessions))
+	{
+		bool converted = false;
+		const int sessions = mParser.value(mOptionSessions).toInt(&converted);
+		if (converted && sessions > 0)
+		{
+			Env::getSingleton<VolatileSettings>()->setMaxSessions(sessions);
+		}
+	}
+
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+	if (mParser.isSet(mOptionHttpConnections))
+	{
+		bool converted = false;
+		const int connections = mParser.value(mOptionHttpConnections).toInt(&converted);
+		if (converted && connections > 0)
+		{
+			HttpServer::cMaxConnections = connections;
+		}
+	}
+
+	if (mParser.isSet(mOptionHttpIdleTimeout))
+	{
+		bool converted = false;
+		const int timeout = mParser.value(mOptionHttpIdleTimeout).toInt(&converted);
+		if (converted && timeout >= 0)
+		{
+			HttpServer::cIdleTimeout = timeout;
+		}
+	}
+#endif
 }
 
 
@@ -23,6 +23,11 @@ class CommandLineParser
 		const QCommandLineOption mOptionProxy;
 		const QCommandLineOption mOptionUi;
 		const QCommandLineOption mOptionPort;
+		const QCommandLineOption mOptionSessions;
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+		const QCommandLineOption mOptionHttpConnections;
+		const QCommandLineOption mOptionHttpIdleTimeout;
+#endif
 
 		Q_DISABLE_COPY(CommandLineParser)
 
@@ -14,6 +14,10 @@
 #include <QOperatingSystemVersion>
 #include <QWeakPointer>
 
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 1, 0))
+	#include <QNetworkInformation>
+#endif
+
 using namespace governikus;
 
 Q_DECLARE_LOGGING_CATEGORY(network)
@@ -37,6 +41,7 @@ template<> DatagramHandler* createNewObject<DatagramHandler*, bool>(bool&& pEnab
 } // namespace governikus
 
 quint16 DatagramHandlerImpl::cPort = PortFile::cDefaultPort;
+int DatagramHandlerImpl::cBroadcastTargetsLifetime = 30000;
 
 DatagramHandlerImpl::DatagramHandlerImpl(bool pEnableListening, quint16 pPort)
 	: DatagramHandler()
@@ -45,9 +50,19 @@ DatagramHandlerImpl::DatagramHandlerImpl(bool pEnableListening, quint16 pPort)
 	, mUsedPort(pPort)
 	, mPortFile(QStringLiteral("udp"))
 	, mEnableListening(pEnableListening)
+	, mBroadcastTargets()
+	, mBroadcastTargetsAge()
+	, mSendStatistics()
 {
 	resetSocket();
 
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 1, 0))
+	if (QNetworkInformation::load(QNetworkInformation::Feature::Reachability))
+	{
+		connect(QNetworkInformation::instance(), &QNetworkInformation::reachabilityChanged, this, &DatagramHandlerImpl::onNetworkChanged);
+	}
+#endif
+
 #if defined(Q_OS_IOS)
 	if (pEnableListening)
 	{
@@ -65,6 +80,9 @@ void DatagramHandlerImpl::resetSocket()
 		mSocket->close();
 	}
 
+	mBroadcastTargets.clear();
+	mBroadcastTargetsAge.invalidate();
+
 	mSocket.reset(new QUdpSocket());
 	mSocket->setProxy(QNetworkProxy::NoProxy);
 
@@ -124,9 +142,46 @@ bool DatagramHandlerImpl::send(const QByteArray& pData)
 }
 
 
-bool DatagramHandlerImpl::sendToAllAddressEntries(const QByteArray& pData, quint16 pPort)
+const QMap<QString, DatagramHandlerImpl::SendStatistics>& DatagramHandlerImpl::getSendStatistics() const
+{
+	return mSendStatistics;
+}
+
+
+QSharedPointer<QUdpSocket> DatagramHandlerImpl::createBroadcastSocket(const QHostAddress& pLocalAddress) const
 {
-	QVector<QHostAddress> broadcastAddresses;
+	const auto socket = QSharedPointer<QUdpSocket>::create();
+	socket->setProxy(QNetworkProxy::NoProxy);
+	if (!socket->bind(pLocalAddress))
+	{
+		qCDebug(network) << "Cannot bind broadcast socket to" << pLocalAddress << '|' << socket->errorString();
+		return QSharedPointer<QUdpSocket>();
+	}
+
+	return socket;
+}
+
+
+void DatagramHandlerImpl::updateBroadcastTargets()
+{
+	QVector<BroadcastTarget> broadcastTargets;
+	const auto& addTarget = [this, &broadcastTargets](const QNetworkInterface& pInterface, const QHostAddress& pAddress, const QHostAddress& pLocalAddress){
+				BroadcastTarget target {pInterface.name(), pAddress, pLocalAddress, QSharedPointer<QUdpSocket>()};
+				for (const auto& existing : qAsConst(mBroadcastTargets))
+				{
+					if (existing.mInterfaceName == target.mInterfaceName && existing.mAddress == pAddress && existing.mLocalAddress == pLocalAddress)
+					{
+						target.mSocket = existing.mSocket;
+						break;
+					}
+				}
+
+				if (!target.mSocket)
+				{
+					target.mSocket = createBroadcastSocket(pLocalAddress);
+				}
+				broadcastTargets += target;
+			};
 
 	const auto& interfaces = QNetworkInterface::allInterfaces();
 	for (const QNetworkInterface& interface : interfaces)
@@ -161,7 +216,7 @@ bool DatagramHandlerImpl::sendToAllAddressEntries(const QByteArray& pData, quint
 						continue;
 					}
 
-					broadcastAddresses += broadcastAddr;
+					addTarget(interface, broadcastAddr, ipAddr);
 					break;
 				}
 
@@ -180,7 +235,7 @@ bool DatagramHandlerImpl::sendToAllAddressEntries(const QByteArray& pData, quint
 
 					QHostAddress scopedMulticastAddress = QHostAddress(QStringLiteral("ff02::1"));
 					scopedMulticastAddress.setScopeId(scopeId);
-					broadcastAddresses += scopedMulticastAddress;
+					addTarget(interface, scopedMulticastAddress, ipAddr);
 
 					skipFurtherIPv6AddressesOnThisInterface = true;
 					break;
@@ -194,35 +249,59 @@ bool DatagramHandlerImpl::sendToAllAddressEntries(const QByteArray& pData, quint
 		}
 	}
 
-	if (broadcastAddresses.isEmpty())
+	mBroadcastTargets = broadcastTargets;
+	mBroadcastTargetsAge.start();
+}
+
+
+bool DatagramHandlerImpl::sendToAllAddressEntries(const QByteArray& pData, quint16 pPort)
+{
+	if (!mBroadcastTargetsAge.isValid() || mBroadcastTargetsAge.hasExpired(cBroadcastTargetsLifetime))
+	{
+		updateBroadcastTargets();
+	}
+
+	if (mBroadcastTargets.isEmpty())
 	{
 		return false;
 	}
 
 	bool broadcastedSuccessfully = true;
-	for (const QHostAddress& broadcastAddr : qAsConst(broadcastAddresses))
+	for (const auto& target : qAsConst(mBroadcastTargets))
 	{
-		if (!sendToAddress(pData, broadcastAddr, pPort))
+		auto& statistics = mSendStatistics[target.mInterfaceName];
+		if (sendToAddress(pData, target.mAddress, pPort, target.mSocket.data()))
 		{
-			qCDebug(network) << "Broadcasting to" << broadcastAddr << "failed";
-			broadcastedSuccessfully = false;
+			++statistics.mSent;
+			continue;
 		}
+
+		++statistics.mFailed;
+		qCDebug(network) << "Broadcasting to" << target.mAddress << "on" << target.mInterfaceName << "failed";
+		broadcastedSuccessfully = false;
+	}
+
+	if (!broadcastedSuccessfully)
+	{
+		// Maybe an interface has changed, so enumerate them again on the next send.
+		mBroadcastTargetsAge.invalidate();
 	}
 
 	return broadcastedSuccessfully;
 }
 
 
-bool DatagramHandlerImpl::sendToAddress(const QByteArray& pData, const QHostAddress& pAddress, quint16 pPort)
+bool DatagramHandlerImpl::sendToAddress(const QByteArray& pData, const QHostAddress& pAddress, quint16 pPort, QUdpSocket* pSocket)
 {
 	// If port is 0 we should take our own listening port as destination as other instances
 	// should use the same port to receive broadcasts.
 	const auto port = pPort > 0 ? pPort : mUsedPort;
 	Q_ASSERT(port > 0);
 
-	if (mSocket->writeDatagram(pData.constData(), pAddress, port) != pData.size())
+	QUdpSocket* const socket = pSocket ? pSocket : mSocket.data();
+	if (socket->writeDatagram(pData.constData(), pAddress, port) != pData.size())
 	{
-		qCCritical(network) << "Cannot write datagram to address" << pAddress << ':' << mSocket->error() << '|' << mSocket->errorString();
+		qCCritical(network) << "Cannot write datagram to address" << pAddress << ':' << socket->error() << '|' << socket->errorString();
 		return false;
 	}
 
@@ -255,6 +334,13 @@ void DatagramHandlerImpl::checkNetworkPermission()
 #endif
 
 
+void DatagramHandlerImpl::onNetworkChanged()
+{
+	qCDebug(network) << "Network changed, enumerate broadcast targets again";
+	mBroadcastTargetsAge.invalidate();
+}
+
+
 void DatagramHandlerImpl::onReadyRead()
 {
 	while (mSocket->hasPendingDatagrams())
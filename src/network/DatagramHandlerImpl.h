@@ -10,9 +10,12 @@
 #include "MulticastLock.h"
 #include "PortFile.h"
 
+#include <QElapsedTimer>
+#include <QMap>
 #include <QScopedPointer>
 #include <QSharedPointer>
 #include <QUdpSocket>
+#include <QVector>
 
 
 namespace governikus
@@ -23,20 +26,46 @@ class DatagramHandlerImpl
 {
 	Q_OBJECT
 
+	public:
+		struct SendStatistics
+		{
+			quint64 mSent = 0;
+			quint64 mFailed = 0;
+		};
+
 	private:
 		friend class ::test_DatagramHandlerImpl;
 		friend struct QtSharedPointer::CustomDeleter<DatagramHandlerImpl, QtSharedPointer::NormalDeleter>;
 
+		struct BroadcastTarget
+		{
+			QString mInterfaceName;
+			QHostAddress mAddress;
+			QHostAddress mLocalAddress;
+			QSharedPointer<QUdpSocket> mSocket;
+		};
+
 		QScopedPointer<QUdpSocket, QScopedPointerDeleteLater> mSocket;
 		QScopedPointer<MulticastLock> mMulticastLock;
 		quint16 mUsedPort;
 		PortFile mPortFile;
 		bool mEnableListening;
+		QVector<BroadcastTarget> mBroadcastTargets;
+		QElapsedTimer mBroadcastTargetsAge;
+		QMap<QString, SendStatistics> mSendStatistics;
 
 		void resetSocket();
-		bool sendToAddress(const QByteArray& pData, const QHostAddress& pAddress, quint16 pPort = 0);
+		bool sendToAddress(const QByteArray& pData, const QHostAddress& pAddress, quint16 pPort = 0, QUdpSocket* pSocket = nullptr);
 		bool sendToAllAddressEntries(const QByteArray& pData, quint16 pPort);
 
+		/*!
+		 * Enumerates the network interfaces and collects the IPv4 broadcast and IPv6 link-local
+		 * multicast addresses. Every target gets a socket that is bound to the local address of
+		 * its interface. Sockets of unchanged targets are reused.
+		 */
+		void updateBroadcastTargets();
+		[[nodiscard]] QSharedPointer<QUdpSocket> createBroadcastSocket(const QHostAddress& pLocalAddress) const;
+
 #if defined(Q_OS_IOS)
 
 		void checkNetworkPermission();
@@ -45,14 +74,26 @@ class DatagramHandlerImpl
 	public:
 		static quint16 cPort;
 
+		/*!
+		 * The enumerated broadcast targets are used for this many milliseconds, unless
+		 * a network change is reported or a datagram cannot be sent.
+		 */
+		static int cBroadcastTargetsLifetime;
+
 		DatagramHandlerImpl(bool pEnableListening = true, quint16 pPort = DatagramHandlerImpl::cPort);
 		~DatagramHandlerImpl() override;
 
 		[[nodiscard]] bool isBound() const override;
 		bool send(const QByteArray& pData) override;
 
+		/*!
+		 * Returns the number of sent and failed broadcasts per interface name.
+		 */
+		[[nodiscard]] const QMap<QString, SendStatistics>& getSendStatistics() const;
+
 	private Q_SLOTS:
 		void onReadyRead();
+		void onNetworkChanged();
 };
 
 
@@ -6,6 +6,9 @@
 
 #include <QLoggingCategory>
 
+#include <chrono>
+#include <utility>
+
 using namespace governikus;
 
 Q_DECLARE_LOGGING_CATEGORY(network)
@@ -13,6 +16,12 @@ Q_DECLARE_LOGGING_CATEGORY(network)
 #define CAST_OBJ(parser) HttpRequest* obj = static_cast<HttpRequest*>(parser->data);
 
 HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
+	: HttpRequest(pSocket, QByteArray(), pParent)
+{
+}
+
+
+HttpRequest::HttpRequest(QTcpSocket* pSocket, const QByteArray& pPendingData, QObject* pParent)
 	: QObject(pParent)
 	, mUrl()
 	, mHeader()
@@ -22,8 +31,14 @@ HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
 	, mParserSettings()
 	, mSocketDisconnected(false)
 	, mFinished(false)
+	, mResponded(false)
+	, mKeepAlive(false)
+	, mIdleTimeout(0)
+	, mPipelined(!pPendingData.isEmpty())
 	, mCurrentHeaderField()
 	, mCurrentHeaderValue()
+	, mPendingData(pPendingData)
+	, mIdleTimer()
 {
 	Q_ASSERT(mSocket);
 
@@ -41,12 +56,19 @@ HttpRequest::HttpRequest(QTcpSocket* pSocket, QObject* pParent)
 	connect(mSocket.data(), &QAbstractSocket::readyRead, this, &HttpRequest::onReadyRead);
 	connect(mSocket.data(), &QAbstractSocket::disconnected, this, &HttpRequest::onSocketDisconnected, Qt::QueuedConnection);
 	connect(mSocket.data(), &QAbstractSocket::disconnected, this, &HttpRequest::deleteLater, Qt::QueuedConnection);
-	onReadyRead();
+
+	mIdleTimer.setSingleShot(true);
+	connect(&mIdleTimer, &QTimer::timeout, this, &HttpRequest::onIdleTimeout);
+
+	// The receiver connects to fireMessageComplete after the construction. Data that
+	// was received before, e.g. pipelined requests, does not emit readyRead again.
+	QMetaObject::invokeMethod(this, &HttpRequest::onReadyRead, Qt::QueuedConnection);
 }
 
 
 QTcpSocket* HttpRequest::take()
 {
+	mIdleTimer.stop();
 	disconnect(mSocket.data(), &QAbstractSocket::readyRead, this, &HttpRequest::onReadyRead);
 	disconnect(mSocket.data(), &QAbstractSocket::disconnected, this, &HttpRequest::onSocketDisconnected);
 	disconnect(mSocket.data(), &QAbstractSocket::disconnected, this, &HttpRequest::deleteLater);
@@ -57,6 +79,17 @@ QTcpSocket* HttpRequest::take()
 void HttpRequest::onSocketDisconnected()
 {
 	mSocketDisconnected = true;
+	mIdleTimer.stop();
+}
+
+
+void HttpRequest::onIdleTimeout()
+{
+	if (mSocket && !mFinished)
+	{
+		qCDebug(network) << "Closing idle connection";
+		mSocket->disconnectFromHost();
+	}
 }
 
 
@@ -75,6 +108,25 @@ bool HttpRequest::isConnected() const
 }
 
 
+void HttpRequest::setIdleTimeout(int pTimeout)
+{
+	mIdleTimeout = pTimeout;
+	mKeepAlive = mIdleTimeout > 0;
+	if (mKeepAlive && !mFinished)
+	{
+		mIdleTimer.start(std::chrono::seconds(mIdleTimeout));
+		return;
+	}
+	mIdleTimer.stop();
+}
+
+
+bool HttpRequest::isReusable() const
+{
+	return mKeepAlive && mFinished && mResponded && !mParser.upgrade && http_should_keep_alive(&mParser) && isConnected();
+}
+
+
 QByteArray HttpRequest::getMethod() const
 {
 	return QByteArray(http_method_str(static_cast<http_method>(mParser.method)));
@@ -118,39 +170,50 @@ bool HttpRequest::send(const HttpResponse& pResponse)
 		return false;
 	}
 
-	const auto& msg = pResponse.getMessage();
+	QByteArray msg;
+	if (mKeepAlive && mFinished && http_should_keep_alive(&mParser))
+	{
+		// The response still uses HTTP/1.0, so the persistent connection is announced explicitly.
+		HttpResponse response(pResponse);
+		response.setHeader(QByteArrayLiteral("Connection"), QByteArrayLiteral("keep-alive"));
+		response.setHeader(QByteArrayLiteral("Keep-Alive"), QByteArrayLiteral("timeout=") + QByteArray::number(mIdleTimeout));
+		msg = response.getMessage();
+	}
+	else
+	{
+		msg = pResponse.getMessage();
+	}
+
 	if (mSocket->write(msg) != msg.size())
 	{
 		qCCritical(network) << "Cannot write response:" << mSocket->error() << '|' << mSocket->errorString();
 		return false;
 	}
+	mResponded = true;
 	return true;
 }
 
 
 void HttpRequest::onReadyRead()
 {
-	if (!mSocket)
+	if (!mSocket || mFinished)
 	{
 		return;
 	}
 
-	while (mSocket->bytesAvailable())
+	if (!mPendingData.isEmpty())
 	{
-		const auto& buffer = mSocket->readAll();
-		http_parser_execute(&mParser, &mParserSettings, buffer.constData(), static_cast<size_t>(buffer.size()));
+		parse(std::exchange(mPendingData, QByteArray()));
+	}
 
-		// See macro HTTP_PARSER_ERRNO if http_errno fails.
-		// We do not use this to avoid -Wold-style-cast warning
-		const auto errorCode = static_cast<http_errno>(mParser.http_errno);
-		if (errorCode != HPE_OK)
-		{
-			qCWarning(network) << "Http request not well-formed:" << http_errno_name(errorCode) << '|' << http_errno_description(errorCode);
-		}
+	while (!mFinished && mSocket->bytesAvailable())
+	{
+		parse(mSocket->readAll());
 	}
 
 	if (mFinished)
 	{
+		mIdleTimer.stop();
 		disconnect(mSocket.data(), &QAbstractSocket::readyRead, this, &HttpRequest::onReadyRead);
 		disconnect(mSocket.data(), &QAbstractSocket::disconnected, this, &HttpRequest::deleteLater);
 		Q_EMIT fireMessageComplete(this);
@@ -158,6 +221,36 @@ void HttpRequest::onReadyRead()
 }
 
 
+void HttpRequest::parse(const QByteArray& pData)
+{
+	if (mFinished)
+	{
+		mPendingData += pData;
+		return;
+	}
+
+	if (mIdleTimer.isActive())
+	{
+		mIdleTimer.start();
+	}
+
+	const auto parsed = http_parser_execute(&mParser, &mParserSettings, pData.constData(), static_cast<size_t>(pData.size()));
+
+	// See macro HTTP_PARSER_ERRNO if http_errno fails.
+	// We do not use this to avoid -Wold-style-cast warning
+	const auto errorCode = static_cast<http_errno>(mParser.http_errno);
+	if (errorCode == HPE_PAUSED)
+	{
+		// Keep the pipelined requests for the next request on this connection.
+		mPendingData = pData.mid(static_cast<int>(parsed));
+	}
+	else if (errorCode != HPE_OK)
+	{
+		qCWarning(network) << "Http request not well-formed:" << http_errno_name(errorCode) << '|' << http_errno_description(errorCode);
+	}
+}
+
+
 int HttpRequest::onMessageBegin(http_parser* pParser)
 {
 	Q_UNUSED(pParser)
@@ -170,6 +263,9 @@ int HttpRequest::onMessageComplete(http_parser* pParser)
 	CAST_OBJ(pParser)
 	obj->mFinished = true;
 	qCDebug(network) << "Message completed";
+
+	// A connection that is kept alive may already contain the next request.
+	http_parser_pause(pParser, 1);
 	return 0;
 }
 
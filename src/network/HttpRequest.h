@@ -14,8 +14,10 @@
 #include <QObject>
 #include <QScopedPointer>
 #include <QTcpSocket>
+#include <QTimer>
 #include <QUrl>
 
+class test_HttpRequest;
 class test_WebserviceActivationHandler;
 class test_WebserviceActivationContext;
 
@@ -28,6 +30,7 @@ class HttpRequest
 	Q_OBJECT
 
 	private:
+		friend class ::test_HttpRequest;
 		friend class ::test_WebserviceActivationHandler;
 		friend class ::test_WebserviceActivationContext;
 		friend class HttpServer;
@@ -55,17 +58,43 @@ class HttpRequest
 
 		bool mSocketDisconnected;
 		bool mFinished;
+		bool mResponded;
+		bool mKeepAlive;
+		int mIdleTimeout;
+		bool mPipelined;
 		QByteArray mCurrentHeaderField;
 		QByteArray mCurrentHeaderValue;
+		QByteArray mPendingData;
+		QTimer mIdleTimer;
 
 		void insertHeader();
+		void parse(const QByteArray& pData);
 
 	public:
 		HttpRequest(QTcpSocket* pSocket, QObject* pParent = nullptr);
+
+		/*!
+		 * Continues on a connection that is kept alive. The data received after the
+		 * previous request is parsed first, so pipelined requests are not lost.
+		 */
+		HttpRequest(QTcpSocket* pSocket, const QByteArray& pPendingData, QObject* pParent = nullptr);
 		~HttpRequest() override;
 
 		[[nodiscard]] bool isConnected() const;
 
+		/*!
+		 * Closes the connection if no complete request is received within the timeout
+		 * in seconds. A positive timeout also allows to keep the connection alive after
+		 * the response and is announced to the client.
+		 */
+		void setIdleTimeout(int pTimeout);
+
+		/*!
+		 * Returns true if the client and the server agreed to keep the connection alive
+		 * and a response was sent.
+		 */
+		[[nodiscard]] bool isReusable() const;
+
 		[[nodiscard]] QByteArray getMethod() const;
 		[[nodiscard]] bool isUpgrade() const;
 		[[nodiscard]] QByteArray getHeader(const QByteArray& pKey) const;
@@ -80,6 +109,7 @@ class HttpRequest
 	private Q_SLOTS:
 		void onReadyRead();
 		void onSocketDisconnected();
+		void onIdleTimeout();
 
 	Q_SIGNALS:
 		void fireMessageComplete(HttpRequest* pSelf);
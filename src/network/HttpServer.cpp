@@ -5,20 +5,28 @@
 #include "HttpServer.h"
 
 #include <QLoggingCategory>
+#include <QPointer>
 #include <QTcpSocket>
 
+#include <utility>
+
 using namespace governikus;
 
 Q_DECLARE_LOGGING_CATEGORY(network)
 
 
 quint16 HttpServer::cPort = PortFile::cDefaultPort;
+int HttpServer::cMaxConnections = 32;
+int HttpServer::cIdleTimeout = 5;
 
 
 HttpServer::HttpServer(quint16 pPort)
 	: QObject()
 	, mServer(new QTcpServer())
 	, mPortFile()
+	, mMaxConnections(cMaxConnections)
+	, mIdleTimeout(cIdleTimeout)
+	, mConnectionCount(0)
 {
 	connect(mServer.data(), &QTcpServer::newConnection, this, &HttpServer::onNewConnection);
 
@@ -56,15 +64,94 @@ quint16 HttpServer::getServerPort() const
 }
 
 
+int HttpServer::getMaxConnections() const
+{
+	return mMaxConnections;
+}
+
+
+void HttpServer::setMaxConnections(int pMaxConnections)
+{
+	mMaxConnections = pMaxConnections;
+	if (mConnectionCount < mMaxConnections)
+	{
+		mServer->resumeAccepting();
+	}
+}
+
+
+int HttpServer::getConnectionCount() const
+{
+	return mConnectionCount;
+}
+
+
+int HttpServer::getIdleTimeout() const
+{
+	return mIdleTimeout;
+}
+
+
+void HttpServer::setIdleTimeout(int pIdleTimeout)
+{
+	mIdleTimeout = pIdleTimeout;
+}
+
+
 void HttpServer::onNewConnection()
 {
 	while (mServer->hasPendingConnections())
 	{
 		auto socket = mServer->nextPendingConnection();
-		socket->startTransaction();
-		auto request = new HttpRequest(socket, this);
-		connect(request, &HttpRequest::fireMessageComplete, this, &HttpServer::onMessageComplete);
+		if (mConnectionCount >= mMaxConnections)
+		{
+			qCWarning(network) << "Connection rejected, limit of" << mMaxConnections << "connections reached";
+			socket->abort();
+			socket->deleteLater();
+			continue;
+		}
+
+		++mConnectionCount;
+		connect(socket, &QObject::destroyed, this, &HttpServer::onSocketDestroyed);
+		startRequest(socket);
 	}
+
+	if (mConnectionCount >= mMaxConnections)
+	{
+		mServer->pauseAccepting();
+	}
+}
+
+
+void HttpServer::onSocketDestroyed()
+{
+	--mConnectionCount;
+	if (mConnectionCount < mMaxConnections)
+	{
+		mServer->resumeAccepting();
+	}
+}
+
+
+void HttpServer::startRequest(QTcpSocket* pSocket, const QByteArray& pPendingData)
+{
+	pSocket->startTransaction();
+	auto request = new HttpRequest(pSocket, pPendingData, this);
+	request->setIdleTimeout(mIdleTimeout);
+	connect(request, &HttpRequest::fireMessageComplete, this, &HttpServer::onMessageComplete);
+}
+
+
+void HttpServer::onRequestReleased(HttpRequest* pRequest)
+{
+	if (!pRequest->isReusable())
+	{
+		return;
+	}
+
+	const QByteArray pendingData = std::exchange(pRequest->mPendingData, QByteArray());
+	qCDebug(network) << "Keep connection alive";
+	startRequest(pRequest->take(), pendingData);
 }
 
 
@@ -76,6 +163,7 @@ bool HttpServer::checkReceiver(const QMetaMethod& pSignal, HttpRequest* pRequest
 	}
 
 	qCDebug(network) << "No registration found:" << pSignal.name();
+	pRequest->setIdleTimeout(0);
 	pRequest->send(HTTP_STATUS_SERVICE_UNAVAILABLE);
 	pRequest->deleteLater();
 	return false;
@@ -88,6 +176,7 @@ void HttpServer::onMessageComplete(HttpRequest* pRequest)
 
 	if (pRequest->isUpgrade())
 	{
+		pRequest->setIdleTimeout(0);
 		if (pRequest->getHeader(QByteArrayLiteral("upgrade")).toLower() == QByteArrayLiteral("websocket"))
 		{
 			qCDebug(network) << "Upgrade to websocket requested";
@@ -98,6 +187,15 @@ void HttpServer::onMessageComplete(HttpRequest* pRequest)
 				return;
 			}
 
+			if (pRequest->mPipelined)
+			{
+				// The handshake was already read from the socket with the previous request.
+				qCWarning(network) << "Pipelined upgrade is not supported";
+				pRequest->send(HTTP_STATUS_BAD_REQUEST);
+				pRequest->deleteLater();
+				return;
+			}
+
 			pRequest->mSocket->rollbackTransaction();
 			Q_EMIT fireNewWebSocketRequest(QSharedPointer<HttpRequest>(pRequest, &QObject::deleteLater));
 		}
@@ -117,6 +215,15 @@ void HttpServer::onMessageComplete(HttpRequest* pRequest)
 		}
 
 		pRequest->mSocket->commitTransaction();
-		Q_EMIT fireNewHttpRequest(QSharedPointer<HttpRequest>(pRequest, &QObject::deleteLater));
+
+		// The connection is reused as soon as the receivers release the request.
+		const QPointer<HttpServer> server(this);
+		Q_EMIT fireNewHttpRequest(QSharedPointer<HttpRequest>(pRequest, [server](HttpRequest* pReleased){
+				if (server)
+				{
+					server->onRequestReleased(pReleased);
+				}
+				pReleased->deleteLater();
+			}));
 	}
 }
@@ -25,11 +25,19 @@ class HttpServer
 	private:
 		QScopedPointer<QTcpServer, QScopedPointerDeleteLater> mServer;
 		PortFile mPortFile;
+		int mMaxConnections;
+		int mIdleTimeout;
+		int mConnectionCount;
 
 		bool checkReceiver(const QMetaMethod& pSignal, HttpRequest* pRequest);
+		void startRequest(QTcpSocket* pSocket, const QByteArray& pPendingData = QByteArray());
+		void onRequestReleased(HttpRequest* pRequest);
+		void onSocketDestroyed();
 
 	public:
 		static quint16 cPort;
+		static int cMaxConnections;
+		static int cIdleTimeout;
 
 		explicit HttpServer(quint16 pPort = HttpServer::cPort);
 		~HttpServer() override;
@@ -37,6 +45,20 @@ class HttpServer
 		[[nodiscard]] bool isListening() const;
 		[[nodiscard]] quint16 getServerPort() const;
 
+		/*!
+		 * New connections are not accepted while the limit of open connections is reached.
+		 */
+		[[nodiscard]] int getMaxConnections() const;
+		void setMaxConnections(int pMaxConnections);
+		[[nodiscard]] int getConnectionCount() const;
+
+		/*!
+		 * Connections are kept alive for further requests and closed if the client
+		 * is idle for the given seconds. A timeout of 0 disables keep-alive.
+		 */
+		[[nodiscard]] int getIdleTimeout() const;
+		void setIdleTimeout(int pIdleTimeout);
+
 	private Q_SLOTS:
 		void onNewConnection();
 		void onMessageComplete(HttpRequest* pRequest);
@@ -7,20 +7,29 @@
 #include "AppSettings.h"
 #include "NetworkReplyError.h"
 #include "NetworkReplyTimeout.h"
-#include "SecureStorage.h"
 #include "VersionInfo.h"
 
 #include <http_parser.h>
 #include <QCoreApplication>
+#include <QCryptographicHash>
 #include <QLoggingCategory>
 #include <QNetworkProxyFactory>
 #include <QStringBuilder>
+#include <QThread>
+
+#include <algorithm>
 
 
 using namespace governikus;
 
 Q_DECLARE_LOGGING_CATEGORY(network)
 
+namespace
+{
+const char* const PROPERTY_HANDSHAKE = "handshake";
+const int MAX_CACHED_SESSIONS = 32;
+} // namespace
+
 bool NetworkManager::mLockProxy = false;
 
 NetworkManager::NetworkManager()
@@ -28,6 +37,10 @@ NetworkManager::NetworkManager()
 	, mNetAccessManager()
 	, mApplicationExitInProgress(false)
 	, mOpenConnectionCount(0)
+	, mSessionCache(MAX_CACHED_SESSIONS)
+	, mSessionCacheHitCount(0)
+	, mSessionCacheMissCount(0)
+	, mConnectionReuseCount(0)
 {
 	connect(&mNetAccessManager, &QNetworkAccessManager::proxyAuthenticationRequired, this, &NetworkManager::fireProxyAuthenticationRequired);
 
@@ -46,6 +59,87 @@ int NetworkManager::getOpenConnectionCount() const
 }
 
 
+int NetworkManager::getSessionCacheHitCount() const
+{
+	return mSessionCacheHitCount;
+}
+
+
+int NetworkManager::getSessionCacheMissCount() const
+{
+	return mSessionCacheMissCount;
+}
+
+
+int NetworkManager::getConnectionReuseCount() const
+{
+	return mConnectionReuseCount;
+}
+
+
+QString NetworkManager::getSessionKey(const QUrl& pUrl, SecureStorage::TlsSuite pTlsSuite, const QList<QSslCertificate>& pCaCerts)
+{
+	// A session must only be resumed with the trust anchors that verified its full handshake.
+	QByteArrayList digests;
+	for (const auto& caCert : pCaCerts)
+	{
+		digests += caCert.digest(QCryptographicHash::Sha256);
+	}
+	std::sort(digests.begin(), digests.end());
+	const auto& caHash = QCryptographicHash::hash(digests.join(), QCryptographicHash::Sha256).toHex();
+
+	return QStringLiteral("%1:%2/%3/%4").arg(pUrl.host()).arg(pUrl.port(443)).arg(static_cast<int>(pTlsSuite)).arg(QString::fromLatin1(caHash));
+}
+
+
+void NetworkManager::applySession(QSslConfiguration& pConfig, const QString& pSessionKey, const QByteArray& pSslSession)
+{
+	Q_ASSERT(QThread::currentThread() == thread());
+
+	if (!pSslSession.isEmpty())
+	{
+		pConfig.setSessionTicket(pSslSession);
+		return;
+	}
+
+	const auto* cachedSession = mSessionCache.object(pSessionKey);
+	if (cachedSession == nullptr)
+	{
+		++mSessionCacheMissCount;
+		return;
+	}
+
+	qCDebug(network) << "Resume cached TLS session for" << pSessionKey;
+	++mSessionCacheHitCount;
+	pConfig.setSessionTicket(*cachedSession);
+}
+
+
+void NetworkManager::onSessionReplyFinished(const QNetworkReply* pReply, const QString& pSessionKey)
+{
+	Q_ASSERT(QThread::currentThread() == thread());
+
+	if (pReply->error() != QNetworkReply::NoError)
+	{
+		// Never resume a session of a connection that failed or was
+		// aborted, e.g. because of an untrusted certificate.
+		mSessionCache.remove(pSessionKey);
+		return;
+	}
+
+	if (!pReply->property(PROPERTY_HANDSHAKE).toBool())
+	{
+		++mConnectionReuseCount;
+	}
+
+	const auto& session = pReply->sslConfiguration().sessionTicket();
+	if (!session.isEmpty())
+	{
+		mSessionCache.insert(pSessionKey, new QByteArray(session));
+	}
+}
+
+
 void NetworkManager::clearConnections()
 {
 	mNetAccessManager.clearConnectionCache();
@@ -73,11 +167,21 @@ QNetworkReply* NetworkManager::paos(QNetworkRequest& pRequest,
 
 	SecureStorage::TlsSuite tlsSuite = pUsePsk ? SecureStorage::TlsSuite::PSK : SecureStorage::TlsSuite::DEFAULT;
 	auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig(tlsSuite).getConfiguration();
-	cfg.setSessionTicket(pSslSession);
+
+	// PSK sessions are bound to the identity of a single TcToken and are never cached.
+	const QString& sessionKey = pUsePsk ? QString() : getSessionKey(pRequest.url(), tlsSuite);
+	if (pUsePsk)
+	{
+		cfg.setSessionTicket(pSslSession);
+	}
+	else
+	{
+		applySession(cfg, sessionKey, pSslSession);
+	}
 	pRequest.setSslConfiguration(cfg);
 
 	QNetworkReply* response = mNetAccessManager.post(pRequest, pData);
-	trackConnection(response, pTimeoutInMilliSeconds);
+	trackConnection(response, pTimeoutInMilliSeconds, sessionKey);
 	return response;
 }
 
@@ -94,12 +198,13 @@ QNetworkReply* NetworkManager::get(QNetworkRequest& pRequest,
 
 	pRequest.setHeader(QNetworkRequest::UserAgentHeader, getUserAgentHeader());
 	auto cfg = Env::getSingleton<SecureStorage>()->getTlsConfig().getConfiguration();
-	cfg.setSessionTicket(pSslSession);
+	const QString& sessionKey = getSessionKey(pRequest.url(), SecureStorage::TlsSuite::DEFAULT, pCaCerts);
+	applySession(cfg, sessionKey, pSslSession);
 	cfg.setCaCertificates(pCaCerts);
 	pRequest.setSslConfiguration(cfg);
 
 	QNetworkReply* response = mNetAccessManager.get(pRequest);
-	trackConnection(response, pTimeoutInMilliSeconds);
+	trackConnection(response, pTimeoutInMilliSeconds, sessionKey);
 	return response;
 }
 
@@ -147,6 +252,7 @@ QString NetworkManager::getUserAgentHeader() const
 void NetworkManager::onShutdown()
 {
 	mApplicationExitInProgress = true;
+	mSessionCache.clear();
 	mNetAccessManager.clearAccessCache();
 	mNetAccessManager.clearConnectionCache();
 	Q_EMIT fireShutdown();
@@ -243,7 +349,7 @@ GlobalStatus NetworkManager::toStatus(const QSharedPointer<const QNetworkReply>&
 }
 
 
-void NetworkManager::trackConnection(QNetworkReply* pResponse, const int pTimeoutInMilliSeconds)
+void NetworkManager::trackConnection(QNetworkReply* pResponse, const int pTimeoutInMilliSeconds, const QString& pSessionKey)
 {
 	Q_ASSERT(pResponse);
 
@@ -255,6 +361,17 @@ void NetworkManager::trackConnection(QNetworkReply* pResponse, const int pTimeou
 				--mOpenConnectionCount;
 			});
 
+		if (!pSessionKey.isEmpty())
+		{
+			// QNetworkReply::encrypted is only emitted if a new connection was established.
+			connect(pResponse, &QNetworkReply::encrypted, this, [pResponse] {
+					pResponse->setProperty(PROPERTY_HANDSHAKE, true);
+				});
+			connect(pResponse, &QNetworkReply::finished, this, [this, pResponse, pSessionKey] {
+					onSessionReplyFinished(pResponse, pSessionKey);
+				});
+		}
+
 		NetworkReplyTimeout::setTimeout(pResponse, pTimeoutInMilliSeconds);
 	}
 }
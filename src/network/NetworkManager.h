@@ -8,16 +8,21 @@
 
 #include "Env.h"
 #include "GlobalStatus.h"
+#include "SecureStorage.h"
 
 #include <QAtomicInt>
 #include <QAuthenticator>
+#include <QCache>
 #include <QDebug>
+#include <QHash>
 #include <QMessageLogger>
 #include <QNetworkAccessManager>
 #include <QNetworkProxy>
 #include <QNetworkReply>
 #include <QSsl>
 
+class test_NetworkManager;
+
 namespace governikus
 {
 
@@ -26,6 +31,7 @@ class NetworkManager
 {
 	Q_OBJECT
 	friend class Env;
+	friend class ::test_NetworkManager;
 
 	private:
 		static bool mLockProxy;
@@ -33,8 +39,21 @@ class NetworkManager
 		QNetworkAccessManager mNetAccessManager;
 		bool mApplicationExitInProgress;
 		QAtomicInt mOpenConnectionCount;
-
-		void trackConnection(QNetworkReply* pResponse, const int pTimeoutInMilliSeconds);
+		/*!
+		 * Session tickets by host, port, TLS suite and trust anchors. The least recently used
+		 * ticket is dropped if the cache is full. Like QNetworkAccessManager this cache is not
+		 * guarded and must only be used from the thread of the NetworkManager.
+		 */
+		QCache<QString, QByteArray> mSessionCache;
+		QAtomicInt mSessionCacheHitCount;
+		QAtomicInt mSessionCacheMissCount;
+		QAtomicInt mConnectionReuseCount;
+
+		void trackConnection(QNetworkReply* pResponse, const int pTimeoutInMilliSeconds, const QString& pSessionKey = QString());
+		void applySession(QSslConfiguration& pConfig, const QString& pSessionKey, const QByteArray& pSslSession);
+		void onSessionReplyFinished(const QNetworkReply* pReply, const QString& pSessionKey);
+
+		[[nodiscard]] static QString getSessionKey(const QUrl& pUrl, SecureStorage::TlsSuite pTlsSuite, const QList<QSslCertificate>& pCaCerts = QList<QSslCertificate>());
 
 		[[nodiscard]] QString getUserAgentHeader() const;
 
@@ -92,6 +111,19 @@ class NetworkManager
 
 		int getOpenConnectionCount() const;
 
+		/*!
+		 * Number of requests that found a TLS session ticket for their host and
+		 * TLS configuration in the cache, i.e. could resume instead of doing a full handshake.
+		 */
+		int getSessionCacheHitCount() const;
+		int getSessionCacheMissCount() const;
+
+		/*!
+		 * Number of finished requests that were sent over an already established
+		 * connection without any TLS handshake.
+		 */
+		int getConnectionReuseCount() const;
+
 	Q_SIGNALS:
 		void fireProxyAuthenticationRequired(const QNetworkProxy& pProxy, QAuthenticator* pAuthenticator);
 		void fireShutdown();
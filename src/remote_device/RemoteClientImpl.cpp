@@ -8,8 +8,6 @@
 #include "messages/Discovery.h"
 #include "RemoteConnectorImpl.h"
 
-#include <QJsonDocument>
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 Q_DECLARE_LOGGING_CATEGORY(remote_device)
@@ -27,9 +25,13 @@ template<> RemoteClient* createNewObject<RemoteClient*>()
 } // namespace governikus
 
 
+const int RemoteClientImpl::DISCOVERY_CACHE_SIZE = 256;
+
+
 RemoteClientImpl::RemoteClientImpl()
 	: mDatagramHandler()
 	, mRemoteDeviceList(Env::create<RemoteDeviceList*>())
+	, mDiscoveryCache()
 	, mErrorCounter()
 	, mRemoteConnectorThread()
 	, mRemoteConnector()
@@ -102,7 +104,17 @@ QSharedPointer<RemoteDeviceListEntry> RemoteClientImpl::mapToAndTakeRemoteConnec
 
 void RemoteClientImpl::onNewMessage(const QByteArray& pData, const QHostAddress& pAddress)
 {
-	QJsonObject obj;
+	// Devices repeat the same announcement every second, so the descriptor of
+	// a known datagram from the same sender is taken as is.
+	const QByteArray cacheKey = pAddress.toString().toUtf8() + '\n' + pData;
+	const auto cached = mDiscoveryCache.constFind(cacheKey);
+	if (cached != mDiscoveryCache.constEnd())
+	{
+		mRemoteDeviceList->update(cached.value());
+		return;
+	}
+
+	RemoteMessageObject obj;
 	{
 		obj = RemoteMessage::parseByteArray(pData);
 	}
@@ -121,6 +133,12 @@ void RemoteClientImpl::onNewMessage(const QByteArray& pData, const QHostAddress&
 		return;
 	}
 
+	if (mDiscoveryCache.size() >= DISCOVERY_CACHE_SIZE)
+	{
+		mDiscoveryCache.clear();
+	}
+	mDiscoveryCache.insert(cacheKey, remoteDeviceDescriptor);
+
 	mRemoteDeviceList->update(remoteDeviceDescriptor);
 }
 
@@ -162,15 +180,7 @@ void RemoteClientImpl::onRemoteDispatcherError(const RemoteDeviceDescriptor& pRe
 		{
 			qCCritical(remote_device) << "Remote device refused connection seven times, removing certificate with fingerprint:" << pRemoteDeviceDescriptor.getIfdId();
 			RemoteServiceSettings& settings = Env::getSingleton<AppSettings>()->getRemoteServiceSettings();
-			QString deviceNameEscaped;
-			const auto& infos = settings.getRemoteInfos();
-			for (const auto& remoteInfo : infos)
-			{
-				if (remoteInfo.getFingerprint() == pRemoteDeviceDescriptor.getIfdId())
-				{
-					deviceNameEscaped = remoteInfo.getNameEscaped();
-				}
-			}
+			const QString deviceNameEscaped = settings.getRemoteInfo(pRemoteDeviceDescriptor.getIfdId()).getNameEscaped();
 			settings.removeTrustedCertificate(pRemoteDeviceDescriptor.getIfdId());
 			mErrorCounter[pRemoteDeviceDescriptor.getIfdId()] = 0;
 			if (!deviceNameEscaped.isEmpty())
@@ -205,6 +215,7 @@ void RemoteClientImpl::startDetection()
 void RemoteClientImpl::stopDetection()
 {
 	mDatagramHandler.reset();
+	mDiscoveryCache.clear();
 	mRemoteDeviceList->clear();
 	Q_EMIT fireDetectionChanged();
 }
@@ -262,16 +273,13 @@ QStringList RemoteClientImpl::getConnectedDeviceIDs() const
 QVector<RemoteServiceSettings::RemoteInfo> RemoteClientImpl::getConnectedDeviceInfos()
 {
 	const RemoteServiceSettings& settings = Env::getSingleton<AppSettings>()->getRemoteServiceSettings();
-	auto remoteInfos = settings.getRemoteInfos();
 	QVector<RemoteServiceSettings::RemoteInfo> result;
-	for (const auto& info : remoteInfos)
+	for (const auto& id : qAsConst(mConnectedDeviceIds))
 	{
-		for (const auto& id : qAsConst(mConnectedDeviceIds))
+		const auto& info = settings.getRemoteInfo(id);
+		if (!info.getFingerprint().isEmpty())
 		{
-			if (info.getFingerprint() == id)
-			{
-				result.append(info);
-			}
+			result.append(info);
 		}
 	}
 	return result;
@@ -13,6 +13,8 @@
 #include "RemoteConnector.h"
 #include "RemoteDeviceList.h"
 
+#include <QByteArray>
+#include <QHash>
 #include <QObject>
 #include <QPointer>
 #include <QThread>
@@ -32,8 +34,11 @@ class RemoteClientImpl
 		friend ::test_RemoteClient;
 		friend RemoteClient* createNewObject<RemoteClient*>();
 
+		static const int DISCOVERY_CACHE_SIZE;
+
 		QSharedPointer<DatagramHandler> mDatagramHandler;
 		QScopedPointer<RemoteDeviceList> mRemoteDeviceList;
+		QHash<QByteArray, RemoteDeviceDescriptor> mDiscoveryCache;
 		QMap<QString, int> mErrorCounter;
 
 		QThread mRemoteConnectorThread;
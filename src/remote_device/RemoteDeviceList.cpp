@@ -140,6 +140,7 @@ RemoteDeviceListImpl::RemoteDeviceListImpl(int pCheckInterval, int pReaderRespon
 	, mTimer()
 	, mReaderResponsiveTimeout(pReaderResponsiveTimeout)
 	, mResponsiveList()
+	, mResponsiveIndex()
 {
 	connect(&mTimer, &QTimer::timeout, this, &RemoteDeviceListImpl::onProcessUnresponsiveRemoteReaders);
 	pCheckInterval = pCheckInterval / 2 - 1;  // Nyquist-Shannon sampling theorem. Enable smooth UI updates.
@@ -155,20 +156,19 @@ RemoteDeviceListImpl::~RemoteDeviceListImpl()
 
 void RemoteDeviceListImpl::update(const RemoteDeviceDescriptor& pDescriptor)
 {
-	for (const QSharedPointer<RemoteDeviceListEntry>& entry : qAsConst(mResponsiveList))
+	const auto& entry = mResponsiveIndex.value(pDescriptor.getIfdId());
+	if (entry)
 	{
-		if (entry->containsEquivalent(pDescriptor))
-		{
-			entry->setLastSeenToNow();
-			entry->setRemoteDeviceDescriptor(pDescriptor);
-			Q_EMIT fireDeviceUpdated(entry);
+		entry->setLastSeenToNow();
+		entry->setRemoteDeviceDescriptor(pDescriptor);
+		Q_EMIT fireDeviceUpdated(entry);
 
-			return;
-		}
+		return;
 	}
 
 	const auto& newDevice = QSharedPointer<RemoteDeviceListEntry>::create(pDescriptor);
 	mResponsiveList += newDevice;
+	mResponsiveIndex.insert(pDescriptor.getIfdId(), newDevice);
 
 	if (!mTimer.isActive())
 	{
@@ -183,6 +183,7 @@ void RemoteDeviceListImpl::clear()
 {
 	decltype(mResponsiveList) removedDevices;
 	mResponsiveList.swap(removedDevices);
+	mResponsiveIndex.clear();
 	for (const auto& entry : qAsConst(removedDevices))
 	{
 		Q_EMIT fireDeviceVanished(entry);
@@ -206,6 +207,7 @@ void RemoteDeviceListImpl::onProcessUnresponsiveRemoteReaders()
 		if (entry->getLastSeen() < threshold)
 		{
 			i.remove();
+			mResponsiveIndex.remove(entry->getRemoteDeviceDescriptor().getIfdId());
 			Q_EMIT fireDeviceVanished(entry);
 			continue;
 		}
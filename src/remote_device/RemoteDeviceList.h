@@ -8,6 +8,7 @@
 
 #include "RemoteDeviceDescriptor.h"
 
+#include <QHash>
 #include <QTime>
 #include <QTimer>
 
@@ -71,6 +72,7 @@ class RemoteDeviceListImpl
 		QTimer mTimer;
 		const int mReaderResponsiveTimeout;
 		QVector<QSharedPointer<RemoteDeviceListEntry>> mResponsiveList;
+		QHash<QString, QSharedPointer<RemoteDeviceListEntry>> mResponsiveIndex;
 
 	private Q_SLOTS:
 		void onProcessUnresponsiveRemoteReaders();
@@ -28,7 +28,7 @@ class RemoteDispatcher
 	private:
 		const QSharedPointer<DataChannel> mDataChannel;
 
-		virtual bool processContext(RemoteCardMessageType pMsgType, const QJsonObject& pMsgObject) = 0;
+		virtual bool processContext(RemoteCardMessageType pMsgType, const RemoteMessageObject& pMsgObject) = 0;
 
 	private Q_SLOTS:
 		void onReceived(const QByteArray& pDataBlock);
@@ -50,7 +50,7 @@ class RemoteDispatcher
 		Q_INVOKABLE virtual void send(const QSharedPointer<const RemoteMessage>& pMessage);
 
 	Q_SIGNALS:
-		void fireReceived(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void fireReceived(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject, const QString& pId);
 		void fireClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 };
 
@@ -36,11 +36,12 @@ INIT_FUNCTION([] {
 
 RemoteDispatcherClient::RemoteDispatcherClient(IfdVersion::Version pVersion, const QSharedPointer<DataChannel>& pDataChannel)
 	: RemoteDispatcher(pVersion, pDataChannel)
+	, mBatchTransmitSupported(false)
 {
 }
 
 
-bool RemoteDispatcherClient::processContext(RemoteCardMessageType pMsgType, const QJsonObject& pMsgObject)
+bool RemoteDispatcherClient::processContext(RemoteCardMessageType pMsgType, const RemoteMessageObject& pMsgObject)
 {
 	if (pMsgType != RemoteCardMessageType::IFDEstablishContextResponse)
 	{
@@ -55,7 +56,8 @@ bool RemoteDispatcherClient::processContext(RemoteCardMessageType pMsgType, cons
 	else
 	{
 		mContextHandle = establishContextResponse.getContextHandle();
-		qCDebug(remote_device) << "Received new ContextHandle:" << mContextHandle;
+		mBatchTransmitSupported = establishContextResponse.isBatchTransmitSupported();
+		qCDebug(remote_device) << "Received new ContextHandle:" << mContextHandle << "| batch transmit:" << mBatchTransmitSupported;
 		Q_EMIT fireContextEstablished(establishContextResponse.getIfdName(), getId());
 	}
 	return true;
@@ -70,3 +72,9 @@ void RemoteDispatcherClient::sendEstablishContext()
 	const QSharedPointer<const IfdEstablishContext>& establishContext = QSharedPointer<IfdEstablishContext>::create(mVersion, settings.getServerName());
 	send(establishContext);
 }
+
+
+bool RemoteDispatcherClient::isBatchTransmitSupported() const
+{
+	return mBatchTransmitSupported;
+}
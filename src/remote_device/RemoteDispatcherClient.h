@@ -18,12 +18,15 @@ class RemoteDispatcherClient
 	Q_OBJECT
 
 	private:
-		bool processContext(RemoteCardMessageType pMsgType, const QJsonObject& pMsgObject) override;
+		bool mBatchTransmitSupported;
+
+		bool processContext(RemoteCardMessageType pMsgType, const RemoteMessageObject& pMsgObject) override;
 
 	public:
 		RemoteDispatcherClient(IfdVersion::Version pVersion, const QSharedPointer<DataChannel>& pDataChannel);
 
 		Q_INVOKABLE virtual void sendEstablishContext();
+		[[nodiscard]] bool isBatchTransmitSupported() const;
 
 	Q_SIGNALS:
 		void fireContextEstablished(const QString& pIfdName, const QString& pId);
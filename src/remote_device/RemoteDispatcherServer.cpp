@@ -42,7 +42,7 @@ RemoteDispatcherServer::RemoteDispatcherServer(const QSharedPointer<DataChannel>
 }
 
 
-void RemoteDispatcherServer::createAndSendContext(const QJsonObject& pMessageObject)
+void RemoteDispatcherServer::createAndSendContext(const RemoteMessageObject& pMessageObject)
 {
 	ECardApiResult::Minor fail = ECardApiResult::Minor::null;
 
@@ -78,7 +78,7 @@ void RemoteDispatcherServer::createAndSendContext(const QJsonObject& pMessageObj
 }
 
 
-bool RemoteDispatcherServer::processContext(RemoteCardMessageType pMsgType, const QJsonObject& pMsgObject)
+bool RemoteDispatcherServer::processContext(RemoteCardMessageType pMsgType, const RemoteMessageObject& pMsgObject)
 {
 	if (pMsgType != RemoteCardMessageType::IFDEstablishContext)
 	{
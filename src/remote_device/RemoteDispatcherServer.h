@@ -17,8 +17,8 @@ class RemoteDispatcherServer
 	Q_OBJECT
 
 	private:
-		void createAndSendContext(const QJsonObject& pMessageObject);
-		bool processContext(RemoteCardMessageType pMsgType, const QJsonObject& pMsgObject) override;
+		void createAndSendContext(const RemoteMessageObject& pMessageObject);
+		bool processContext(RemoteCardMessageType pMsgType, const RemoteMessageObject& pMsgObject) override;
 
 	public:
 		explicit RemoteDispatcherServer(const QSharedPointer<DataChannel>& pDataChannel);
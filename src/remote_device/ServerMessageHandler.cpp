@@ -26,6 +26,8 @@
 
 #include <QLoggingCategory>
 
+#include <algorithm>
+
 
 Q_DECLARE_LOGGING_CATEGORY(remote_device)
 
@@ -65,9 +67,9 @@ ServerMessageHandlerImpl::ServerMessageHandlerImpl(const QSharedPointer<DataChan
 }
 
 
-void ServerMessageHandlerImpl::handleIfdGetStatus(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdGetStatus(const RemoteMessageObject& pMessageObject)
 {
-	const IfdGetStatus ifdGetStatus(pJsonObject);
+	const IfdGetStatus ifdGetStatus(pMessageObject);
 
 	if (!ifdGetStatus.getSlotName().isEmpty())
 	{
@@ -99,9 +101,9 @@ void ServerMessageHandlerImpl::handleIfdGetStatus(const QJsonObject& pJsonObject
 }
 
 
-void ServerMessageHandlerImpl::handleIfdConnect(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdConnect(const RemoteMessageObject& pMessageObject)
 {
-	const IfdConnect ifdConnect(pJsonObject);
+	const IfdConnect ifdConnect(pMessageObject);
 
 	const auto& info = mReaderManager->getReaderInfo(ifdConnect.getSlotName());
 	if (!info.isConnected())
@@ -173,9 +175,9 @@ QString ServerMessageHandlerImpl::slotHandleForReaderName(const QString& pReader
 }
 
 
-void ServerMessageHandlerImpl::handleIfdDisconnect(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdDisconnect(const RemoteMessageObject& pMessageObject)
 {
-	const IfdDisconnect ifdDisconnect(pJsonObject);
+	const IfdDisconnect ifdDisconnect(pMessageObject);
 	const QString& slotHandle = ifdDisconnect.getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -193,9 +195,9 @@ void ServerMessageHandlerImpl::handleIfdDisconnect(const QJsonObject& pJsonObjec
 }
 
 
-void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdTransmit(const RemoteMessageObject& pMessageObject)
 {
-	const IfdTransmit ifdTransmit(pJsonObject);
+	const IfdTransmit ifdTransmit(pMessageObject);
 	const QString& slotHandle = ifdTransmit.getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -214,10 +216,20 @@ void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
 		cardConnection->setProgressMessage(progressMessage);
 	}
 
-	const auto& commandApdu = ifdTransmit.getInputApdu();
+	const auto& inputApduInfos = ifdTransmit.getInputApduInfos();
+	if (inputApduInfos.isEmpty())
+	{
+		qCWarning(remote_device) << "Missing command APDU for" << slotHandle;
+		const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, QByteArray(), ECardApiResult::Minor::AL_Unknown_Error);
+		mRemoteDispatcher->send(response);
+		return;
+	}
 
 	const bool pinPadMode = Env::getSingleton<AppSettings>()->getRemoteServiceSettings().getPinPadMode();
-	if (pinPadMode && CommandApdu::isSecureMessaging(commandApdu))
+	const bool secureMessaging = std::any_of(inputApduInfos.constBegin(), inputApduInfos.constEnd(), [](const InputAPDUInfo& pInputApduInfo){
+			return CommandApdu::isSecureMessaging(pInputApduInfo.getInputApdu().getBuffer());
+		});
+	if (pinPadMode && secureMessaging)
 	{
 		const bool stopped = cardConnection->stopSecureMessaging();
 		if (stopped)
@@ -227,15 +239,14 @@ void ServerMessageHandlerImpl::handleIfdTransmit(const QJsonObject& pJsonObject)
 		}
 	}
 
-	qCDebug(remote_device) << "Transmit card APDU for" << slotHandle;
-	InputAPDUInfo inputApduInfo(commandApdu);
-	cardConnection->callTransmitCommand(this, &ServerMessageHandlerImpl::onTransmitCardCommandDone, {inputApduInfo}, slotHandle);
+	qCDebug(remote_device) << "Transmit" << inputApduInfos.size() << "card APDU(s) for" << slotHandle;
+	cardConnection->callTransmitCommand(this, &ServerMessageHandlerImpl::onTransmitCardCommandDone, inputApduInfos, slotHandle);
 }
 
 
-void ServerMessageHandlerImpl::handleIfdEstablishPaceChannel(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdEstablishPaceChannel(const RemoteMessageObject& pMessageObject)
 {
-	const auto& ifdEstablishPaceChannel = QSharedPointer<IfdEstablishPaceChannel>::create(pJsonObject);
+	const auto& ifdEstablishPaceChannel = QSharedPointer<IfdEstablishPaceChannel>::create(pMessageObject);
 	const QString& slotHandle = ifdEstablishPaceChannel->getSlotHandle();
 
 	if (!mCardConnections.contains(slotHandle))
@@ -283,9 +294,9 @@ void ServerMessageHandlerImpl::sendEstablishPaceChannelResponse(const QString& p
 }
 
 
-void ServerMessageHandlerImpl::handleIfdModifyPIN(const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::handleIfdModifyPIN(const RemoteMessageObject& pMessageObject)
 {
-	const auto& ifdModifyPin = QSharedPointer<IfdModifyPin>::create(pJsonObject);
+	const auto& ifdModifyPin = QSharedPointer<IfdModifyPin>::create(pMessageObject);
 	const QString slotHandle = ifdModifyPin->getSlotHandle();
 	const bool pinPadMode = Env::getSingleton<AppSettings>()->getRemoteServiceSettings().getPinPadMode();
 	if (!pinPadMode)
@@ -353,22 +364,29 @@ void ServerMessageHandlerImpl::onTransmitCardCommandDone(QSharedPointer<BaseCard
 	auto transmitCommand = pCommand.staticCast<TransmitCommand>();
 	const QString& slotHandle = transmitCommand->getSlotHandle();
 
-	if (transmitCommand->getReturnCode() != CardReturnCode::OK)
+	// A batch stops at the first unacceptable status code or failure. The client evaluates the responses up to that point.
+	QByteArrayList responseApdus;
+	for (const auto& responseApduAsHex : transmitCommand->getOutputApduAsHex())
 	{
-		qCWarning(remote_device) << "Card transmit for" << slotHandle << "failed" << transmitCommand->getReturnCode();
-		const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, QByteArray(), ECardApiResult::Minor::AL_Unknown_Error);
-		mRemoteDispatcher->send(response);
-		return;
+		responseApdus += QByteArray::fromHex(responseApduAsHex);
+	}
+	if (responseApdus.isEmpty())
+	{
+		responseApdus += QByteArray();
 	}
 
-	QByteArray responseApdu;
-	Q_ASSERT(transmitCommand->getOutputApduAsHex().size() == 1); // may not happen, see TransmitCommand
-	if (transmitCommand->getOutputApduAsHex().size() == 1)
+	const auto returnCode = transmitCommand->getReturnCode();
+	if (returnCode != CardReturnCode::OK && returnCode != CardReturnCode::UNEXPECTED_TRANSMIT_STATUS)
 	{
-		responseApdu = QByteArray::fromHex(transmitCommand->getOutputApduAsHex().first());
+		qCWarning(remote_device) << "Card transmit for" << slotHandle << "failed" << returnCode << "after" << transmitCommand->getOutputApduAsHex().size() << "response APDU(s)";
+		const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, responseApdus, ECardApiResult::Minor::AL_Unknown_Error);
+		mRemoteDispatcher->send(response);
+		return;
 	}
-	qCInfo(remote_device) << "Card transmit succeeded" << slotHandle;
-	const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, responseApdu);
+
+	Q_ASSERT(!transmitCommand->getOutputApduAsHex().isEmpty()); // may not happen, see TransmitCommand
+	qCInfo(remote_device) << "Card transmit succeeded" << slotHandle << "with" << responseApdus.size() << "response APDU(s)";
+	const auto& response = QSharedPointer<IfdTransmitResponse>::create(slotHandle, responseApdus);
 	mRemoteDispatcher->send(response);
 }
 
@@ -381,7 +399,7 @@ void ServerMessageHandlerImpl::onClosed()
 }
 
 
-void ServerMessageHandlerImpl::onRemoteMessage(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject)
+void ServerMessageHandlerImpl::onRemoteMessage(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject)
 {
 	switch (pMessageType)
 	{
@@ -408,27 +426,27 @@ void ServerMessageHandlerImpl::onRemoteMessage(RemoteCardMessageType pMessageTyp
 		}
 
 		case RemoteCardMessageType::IFDGetStatus:
-			handleIfdGetStatus(pJsonObject);
+			handleIfdGetStatus(pMessageObject);
 			break;
 
 		case RemoteCardMessageType::IFDConnect:
-			handleIfdConnect(pJsonObject);
+			handleIfdConnect(pMessageObject);
 			break;
 
 		case RemoteCardMessageType::IFDTransmit:
-			handleIfdTransmit(pJsonObject);
+			handleIfdTransmit(pMessageObject);
 			break;
 
 		case RemoteCardMessageType::IFDDisconnect:
-			handleIfdDisconnect(pJsonObject);
+			handleIfdDisconnect(pMessageObject);
 			break;
 
 		case RemoteCardMessageType::IFDEstablishPACEChannel:
-			handleIfdEstablishPaceChannel(pJsonObject);
+			handleIfdEstablishPaceChannel(pMessageObject);
 			break;
 
 		case RemoteCardMessageType::IFDModifyPIN:
-			handleIfdModifyPIN(pJsonObject);
+			handleIfdModifyPIN(pMessageObject);
 			break;
 	}
 }
@@ -57,18 +57,18 @@ class ServerMessageHandlerImpl
 
 		[[nodiscard]] QString slotHandleForReaderName(const QString& pReaderName) const;
 
-		void handleIfdGetStatus(const QJsonObject& pJsonObject);
-		void handleIfdConnect(const QJsonObject& pJsonObject);
-		void handleIfdDisconnect(const QJsonObject& pJsonObject);
-		void handleIfdTransmit(const QJsonObject& pJsonObject);
-		void handleIfdEstablishPaceChannel(const QJsonObject& pJsonObject);
-		void handleIfdModifyPIN(const QJsonObject& pJsonObject);
+		void handleIfdGetStatus(const RemoteMessageObject& pMessageObject);
+		void handleIfdConnect(const RemoteMessageObject& pMessageObject);
+		void handleIfdDisconnect(const RemoteMessageObject& pMessageObject);
+		void handleIfdTransmit(const RemoteMessageObject& pMessageObject);
+		void handleIfdEstablishPaceChannel(const RemoteMessageObject& pMessageObject);
+		void handleIfdModifyPIN(const RemoteMessageObject& pMessageObject);
 
 	private Q_SLOTS:
 		void onCreateCardConnectionCommandDone(QSharedPointer<CreateCardConnectionCommand> pCommand);
 		void onTransmitCardCommandDone(QSharedPointer<BaseCardCommand> pCommand);
 		void onClosed();
-		void onRemoteMessage(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject);
+		void onRemoteMessage(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject);
 		void onReaderChanged(const ReaderInfo& pInfo);
 		void onReaderRemoved(const ReaderInfo& pInfo);
 
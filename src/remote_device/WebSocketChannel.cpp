@@ -4,6 +4,7 @@
 
 #include "WebSocketChannel.h"
 
+#include "messages/RemoteMessage.h"
 #include "RemoteServiceSettings.h"
 
 #include <QLoggingCategory>
@@ -41,6 +42,7 @@ WebSocketChannel::WebSocketChannel(const QSharedPointer<QWebSocket>& pConnection
 	if (mConnection)
 	{
 		connect(mConnection.data(), &QWebSocket::textMessageReceived, this, &WebSocketChannel::onReceived);
+		connect(mConnection.data(), &QWebSocket::binaryMessageReceived, this, &WebSocketChannel::onBinaryReceived);
 		connect(mConnection.data(), &QWebSocket::disconnected, this, &WebSocketChannel::onDisconnected);
 		connect(&mPingTimer, &QTimer::timeout, this, &WebSocketChannel::onPingScheduled);
 		connect(mConnection.data(), &QWebSocket::pong, this, &WebSocketChannel::onPongReceived);
@@ -60,6 +62,7 @@ WebSocketChannel::~WebSocketChannel()
 	if (mConnection)
 	{
 		disconnect(mConnection.data(), &QWebSocket::textMessageReceived, this, &WebSocketChannel::onReceived);
+		disconnect(mConnection.data(), &QWebSocket::binaryMessageReceived, this, &WebSocketChannel::onBinaryReceived);
 		disconnect(mConnection.data(), &QWebSocket::disconnected, this, &WebSocketChannel::onDisconnected);
 		disconnect(mConnection.data(), &QWebSocket::pong, this, &WebSocketChannel::onPongReceived);
 		disconnect(&mPingTimer, &QTimer::timeout, this, &WebSocketChannel::onPingScheduled);
@@ -72,6 +75,12 @@ void WebSocketChannel::send(const QByteArray& pDataBlock)
 {
 	if (mConnection)
 	{
+		if (RemoteMessage::isBinary(pDataBlock))
+		{
+			mConnection->sendBinaryMessage(pDataBlock);
+			return;
+		}
+
 		mConnection->sendTextMessage(QString::fromUtf8(pDataBlock));
 	}
 }
@@ -106,6 +115,12 @@ void WebSocketChannel::onReceived(const QString& pMessage)
 }
 
 
+void WebSocketChannel::onBinaryReceived(const QByteArray& pMessage)
+{
+	Q_EMIT fireReceived(pMessage);
+}
+
+
 void WebSocketChannel::onDisconnected()
 {
 	mPingTimer.stop();
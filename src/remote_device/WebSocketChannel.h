@@ -37,6 +37,7 @@ class WebSocketChannel
 
 	private Q_SLOTS:
 		void onReceived(const QString& pMessage);
+		void onBinaryReceived(const QByteArray& pMessage);
 		void onDisconnected();
 		void onPingScheduled();
 		void onPongReceived();
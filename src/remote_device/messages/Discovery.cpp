@@ -8,8 +8,6 @@
 #include "Initializer.h"
 #include "RemoteServiceSettings.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -35,7 +33,7 @@ INIT_FUNCTION([] {
 		})
 
 
-void Discovery::parseSupportedApi(const QJsonObject& pMessageObject)
+void Discovery::parseSupportedApi(const RemoteMessageObject& pMessageObject)
 {
 	if (!pMessageObject.contains(SUPPORTED_API()))
 	{
@@ -43,28 +41,26 @@ void Discovery::parseSupportedApi(const QJsonObject& pMessageObject)
 		return;
 	}
 
-	const auto& value = pMessageObject.value(SUPPORTED_API());
-	if (!value.isArray())
+	if (!pMessageObject.isArray(SUPPORTED_API()))
 	{
 		invalidType(SUPPORTED_API(), QLatin1String("array"));
 		return;
 	}
 
-	const auto& array = value.toArray();
-	for (const auto& entry : array)
+	QStringList supportedApis;
+	if (!pMessageObject.toStringList(SUPPORTED_API(), supportedApis))
 	{
-		if (entry.isString())
-		{
-			mSupportedApis += IfdVersion(entry.toString()).getVersion();
-			continue;
-		}
-
 		invalidType(SUPPORTED_API(), QLatin1String("string array"));
 	}
+
+	for (const auto& entry : qAsConst(supportedApis))
+	{
+		mSupportedApis += IfdVersion(entry).getVersion();
+	}
 }
 
 
-void Discovery::parseIfdId(const QJsonObject& pMessageObject)
+void Discovery::parseIfdId(const RemoteMessageObject& pMessageObject)
 {
 	mIfdId = getStringValue(pMessageObject, IFD_ID());
 	if (isIncomplete())
@@ -108,19 +104,18 @@ void Discovery::parseIfdId(const QJsonObject& pMessageObject)
 }
 
 
-void Discovery::parsePairing(const QJsonObject& pMessageObject)
+void Discovery::parsePairing(const RemoteMessageObject& pMessageObject)
 {
 	QVector<IfdVersion::Version> sorted(mSupportedApis);
 	std::sort(sorted.rbegin(), sorted.rend());
 
 	if (sorted.isEmpty() || sorted.first() < IfdVersion::Version::v2)
 	{
-		const auto& pairing = pMessageObject.value(PAIRING());
-		if (pMessageObject.contains(PAIRING()) && !pairing.isBool())
+		if (pMessageObject.contains(PAIRING()) && !pMessageObject.isBool(PAIRING()))
 		{
 			invalidType(PAIRING(), QLatin1String("boolean"));
 		}
-		mPairing = pairing.toBool();
+		mPairing = pMessageObject.toBool(PAIRING());
 		return;
 	}
 
@@ -139,7 +134,7 @@ Discovery::Discovery(const QString& pIfdName, const QString& pIfdId, quint16 pPo
 }
 
 
-Discovery::Discovery(const QJsonObject& pMessageObject)
+Discovery::Discovery(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(RemoteCardMessageType::UNDEFINED)
 	, mIfdName()
 	, mIfdId()
@@ -203,23 +198,24 @@ bool Discovery::getPairing() const
 
 QByteArray Discovery::toByteArray(const IfdVersion& pIfdVersion, const QString&) const
 {
-	QJsonObject result;
+	// Discovery messages are broadcasted as JSON text with every version
+	RemoteMessageObject result;
 
-	result[MSG_TYPE()] = QStringLiteral("REMOTE_IFD");
-	result[IFD_NAME()] = mIfdName;
-	result[IFD_ID()] = mIfdId;
-	result[PORT()] = mPort;
+	result.insert(MSG_TYPE(), QStringLiteral("REMOTE_IFD"));
+	result.insert(IFD_NAME(), mIfdName);
+	result.insert(IFD_ID(), mIfdId);
+	result.insert(PORT(), static_cast<int>(mPort));
 
-	QJsonArray levels;
+	QStringList levels;
 	for (const auto& level : qAsConst(mSupportedApis))
 	{
 		levels += IfdVersion(level).toString();
 	}
-	result[SUPPORTED_API()] = levels;
+	result.insert(SUPPORTED_API(), levels);
 
 	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
 	{
-		result[PAIRING()] = mPairing;
+		result.insert(PAIRING(), mPairing);
 	}
 
 	return RemoteMessage::toByteArray(result);
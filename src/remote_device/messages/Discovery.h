@@ -22,13 +22,13 @@ class Discovery
 		QVector<IfdVersion::Version> mSupportedApis;
 		bool mPairing;
 
-		void parseSupportedApi(const QJsonObject& pMessageObject);
-		void parseIfdId(const QJsonObject& pMessageObject);
-		void parsePairing(const QJsonObject& pMessageObject);
+		void parseSupportedApi(const RemoteMessageObject& pMessageObject);
+		void parseIfdId(const RemoteMessageObject& pMessageObject);
+		void parsePairing(const RemoteMessageObject& pMessageObject);
 
 	public:
 		Discovery(const QString& pIfdName, const QString& pIfdId, quint16 pPort, const QVector<IfdVersion::Version>& pSupportedApis);
-		explicit Discovery(const QJsonObject& pMessageObject);
+		explicit Discovery(const RemoteMessageObject& pMessageObject);
 		~Discovery() override;
 
 		[[nodiscard]] const QString& getIfdName() const;
@@ -5,7 +5,6 @@
 
 #include "IfdConnect.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -30,7 +29,7 @@ IfdConnect::IfdConnect(const QString& pSlotName, bool pExclusive)
 }
 
 
-IfdConnect::IfdConnect(const QJsonObject& pMessageObject)
+IfdConnect::IfdConnect(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotName()
 	, mExclusive(true)
@@ -57,12 +56,12 @@ bool IfdConnect::isExclusive() const
 }
 
 
-QByteArray IfdConnect::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdConnect::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_NAME()] = mSlotName;
-	result[EXCLUSIVE()] = mExclusive;
+	result.insert(SLOT_NAME(), mSlotName);
+	result.insert(EXCLUSIVE(), mExclusive);
 
 	return RemoteMessage::toByteArray(result);
 }
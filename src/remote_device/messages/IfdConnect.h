@@ -18,7 +18,7 @@ class IfdConnect
 
 	public:
 		IfdConnect(const QString& pSlotName, bool pExclusive = true);
-		explicit IfdConnect(const QJsonObject& pMessageObject);
+		explicit IfdConnect(const RemoteMessageObject& pMessageObject);
 		~IfdConnect() override = default;
 
 		[[nodiscard]] const QString& getSlotName() const;
@@ -5,7 +5,6 @@
 
 #include "IfdConnectResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,12 +27,12 @@ IfdConnectResponse::IfdConnectResponse(const QString& pSlotHandle, ECardApiResul
 }
 
 
-IfdConnectResponse::IfdConnectResponse(const QJsonObject& pMessageObject)
+IfdConnectResponse::IfdConnectResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
-	mError = pMessageObject.value(QLatin1String("error")).toString();
+	mError = pMessageObject.toString(QLatin1String("error"));
 
 	if (getType() != RemoteCardMessageType::IFDConnectResponse)
 	{
@@ -48,11 +47,11 @@ const QString& IfdConnectResponse::getSlotHandle() const
 }
 
 
-QByteArray IfdConnectResponse::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdConnectResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -5,7 +5,6 @@
 
 #include "IfdDisconnect.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDisconnect::IfdDisconnect(const QString& pSlotHandle)
 }
 
 
-IfdDisconnect::IfdDisconnect(const QJsonObject& pMessageObject)
+IfdDisconnect::IfdDisconnect(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotHandle()
 {
@@ -47,11 +46,11 @@ const QString& IfdDisconnect::getSlotHandle() const
 }
 
 
-QByteArray IfdDisconnect::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdDisconnect::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
 	return RemoteMessage::toByteArray(result);
 }
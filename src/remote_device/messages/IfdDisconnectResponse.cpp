@@ -5,7 +5,6 @@
 
 #include "IfdDisconnectResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdDisconnectResponse::IfdDisconnectResponse(const QString& pSlotHandle, ECardAp
 }
 
 
-IfdDisconnectResponse::IfdDisconnectResponse(const QJsonObject& pMessageObject)
+IfdDisconnectResponse::IfdDisconnectResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -47,11 +46,11 @@ const QString& IfdDisconnectResponse::getSlotHandle() const
 }
 
 
-QByteArray IfdDisconnectResponse::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdDisconnectResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -5,7 +5,6 @@
 
 #include "IfdError.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdError::IfdError(const QString& pSlotHandle, ECardApiResult::Minor pResultMino
 }
 
 
-IfdError::IfdError(const QJsonObject& pMessageObject)
+IfdError::IfdError(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
 {
@@ -47,11 +46,11 @@ const QString& IfdError::getSlotHandle() const
 }
 
 
-QByteArray IfdError::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdError::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -17,7 +17,7 @@ class IfdError
 
 	public:
 		IfdError(const QString& pSlotHandle, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdError(const QJsonObject& pMessageObject);
+		explicit IfdError(const RemoteMessageObject& pMessageObject);
 		~IfdError() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
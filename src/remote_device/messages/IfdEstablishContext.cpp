@@ -5,7 +5,6 @@
 
 #include "IfdEstablishContext.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -30,7 +29,7 @@ IfdEstablishContext::IfdEstablishContext(const IfdVersion& pProtocol, const QStr
 }
 
 
-IfdEstablishContext::IfdEstablishContext(const QJsonObject& pMessageObject)
+IfdEstablishContext::IfdEstablishContext(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mProtocolRaw(getStringValue(pMessageObject, PROTOCOL()))
 	, mProtocol(IfdVersion(mProtocolRaw))
@@ -61,12 +60,12 @@ const QString& IfdEstablishContext::getUdName() const
 }
 
 
-QByteArray IfdEstablishContext::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdEstablishContext::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[PROTOCOL()] = mProtocol.toString();
-	result[UD_NAME()] = mUdName;
+	result.insert(PROTOCOL(), mProtocol.toString());
+	result.insert(UD_NAME(), mUdName);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -8,7 +8,6 @@
 #include "IfdVersion.h"
 #include "RemoteMessage.h"
 
-#include <QJsonObject>
 #include <QString>
 
 
@@ -24,7 +23,7 @@ class IfdEstablishContext
 
 	public:
 		IfdEstablishContext(const IfdVersion& pProtocol, const QString& pUdName);
-		explicit IfdEstablishContext(const QJsonObject& pMessageObject);
+		explicit IfdEstablishContext(const RemoteMessageObject& pMessageObject);
 		~IfdEstablishContext() override = default;
 
 		[[nodiscard]] const IfdVersion& getProtocol() const;
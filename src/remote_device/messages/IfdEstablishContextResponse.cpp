@@ -5,7 +5,6 @@
 
 #include "IfdEstablishContextResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -17,21 +16,29 @@ using namespace governikus;
 namespace
 {
 VALUE_NAME(IFD_NAME, "IFDName")
+VALUE_NAME(BATCH_TRANSMIT, "BatchTransmit")
 } // namespace
 
 IfdEstablishContextResponse::IfdEstablishContextResponse(const QString& pIfdName, ECardApiResult::Minor pResultMinor)
 	: RemoteMessageResponse(RemoteCardMessageType::IFDEstablishContextResponse, pResultMinor)
 	, mIfdName(pIfdName)
+	, mBatchTransmit(true)
 {
 }
 
 
-IfdEstablishContextResponse::IfdEstablishContextResponse(const QJsonObject& pMessageObject)
+IfdEstablishContextResponse::IfdEstablishContextResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mIfdName()
+	, mBatchTransmit(false)
 {
 	mIfdName = getStringValue(pMessageObject, IFD_NAME());
 
+	if (pMessageObject.contains(BATCH_TRANSMIT()))
+	{
+		mBatchTransmit = getBoolValue(pMessageObject, BATCH_TRANSMIT());
+	}
+
 	if (getType() != RemoteCardMessageType::IFDEstablishContextResponse)
 	{
 		markIncomplete(QStringLiteral("The value of msg should be IFDEstablishContextResponse"));
@@ -39,11 +46,15 @@ IfdEstablishContextResponse::IfdEstablishContextResponse(const QJsonObject& pMes
 }
 
 
-QByteArray IfdEstablishContextResponse::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdEstablishContextResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[IFD_NAME()] = mIfdName;
+	result.insert(IFD_NAME(), mIfdName);
+	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
+	{
+		result.insert(BATCH_TRANSMIT(), mBatchTransmit);
+	}
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -53,3 +64,9 @@ const QString& IfdEstablishContextResponse::getIfdName() const
 {
 	return mIfdName;
 }
+
+
+bool IfdEstablishContextResponse::isBatchTransmitSupported() const
+{
+	return mBatchTransmit;
+}
@@ -6,7 +6,6 @@
 
 #include "RemoteMessageResponse.h"
 
-#include <QJsonObject>
 #include <QString>
 
 
@@ -17,13 +16,20 @@ class IfdEstablishContextResponse
 {
 	private:
 		QString mIfdName;
+		bool mBatchTransmit;
 
 	public:
 		IfdEstablishContextResponse(const QString& pIfdName, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdEstablishContextResponse(const QJsonObject& pMessageObject);
+		explicit IfdEstablishContextResponse(const RemoteMessageObject& pMessageObject);
 		~IfdEstablishContextResponse() override = default;
 
 		[[nodiscard]] const QString& getIfdName() const;
+
+		/*!
+		 * Returns true if the server accepts several CommandAPDUs in one IFDTransmit.
+		 * The optional field is sent with IFDInterface_WebSocket_v2 and later.
+		 */
+		[[nodiscard]] bool isBatchTransmitSupported() const;
 		[[nodiscard]] QByteArray toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const override;
 };
 
@@ -4,7 +4,6 @@
 
 #include "IfdEstablishPaceChannel.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -22,17 +21,16 @@ VALUE_NAME(PREFERRED_PIN_LENGTH, "PreferredPinLength")
 } // namespace
 
 
-void IfdEstablishPaceChannel::parseInputData(const QJsonObject& pMessageObject)
+void IfdEstablishPaceChannel::parseInputData(const RemoteMessageObject& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
-	const QString& inputData = getStringValue(pMessageObject, INPUT_DATA());
+	const QByteArray& input = getByteArrayValue(pMessageObject, INPUT_DATA());
 	if (isIncomplete())
 	{
 		return;
 	}
 
-	const auto& input = QByteArray::fromHex(inputData.toUtf8());
 	if (v0Supported && EstablishPaceChannel::isCcid(input))
 	{
 		if (!mInputData.fromCcid(input))
@@ -67,7 +65,7 @@ IfdEstablishPaceChannel::IfdEstablishPaceChannel(const QString& pSlotHandle, con
 }
 
 
-IfdEstablishPaceChannel::IfdEstablishPaceChannel(const QJsonObject& pMessageObject)
+IfdEstablishPaceChannel::IfdEstablishPaceChannel(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotHandle()
 	, mInputData()
@@ -109,20 +107,20 @@ int IfdEstablishPaceChannel::getPreferredPinLength() const
 
 QByteArray IfdEstablishPaceChannel::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
 	{
-		result[INPUT_DATA()] = QString::fromLatin1(mInputData.createInputData().toHex());
+		result.insertBinary(INPUT_DATA(), mInputData.createInputData());
 		if (mPreferredPinLength > 0)
 		{
-			result[PREFERRED_PIN_LENGTH()] = mPreferredPinLength;
+			result.insert(PREFERRED_PIN_LENGTH(), mPreferredPinLength);
 		}
 	}
 	else
 	{
-		result[INPUT_DATA()] = QString::fromLatin1(mInputData.createCommandDataCcid().toHex());
+		result.insertBinary(INPUT_DATA(), mInputData.createCommandDataCcid());
 	}
 
 	return RemoteMessage::toByteArray(result);
@@ -19,11 +19,11 @@ class IfdEstablishPaceChannel
 		EstablishPaceChannel mInputData;
 		int mPreferredPinLength;
 
-		void parseInputData(const QJsonObject& pMessageObject);
+		void parseInputData(const RemoteMessageObject& pMessageObject);
 
 	public:
 		IfdEstablishPaceChannel(const QString& pSlotHandle, const EstablishPaceChannel& pInputData, int pPreferredPinLength);
-		explicit IfdEstablishPaceChannel(const QJsonObject& pMessageObject);
+		explicit IfdEstablishPaceChannel(const RemoteMessageObject& pMessageObject);
 		~IfdEstablishPaceChannel() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
@@ -4,7 +4,6 @@
 
 #include "IfdEstablishPaceChannelResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -22,21 +21,21 @@ VALUE_NAME(OUTPUT_DATA, "OutputData")
 } // namespace
 
 
-void IfdEstablishPaceChannelResponse::parseOutputData(const QJsonObject& pMessageObject)
+void IfdEstablishPaceChannelResponse::parseOutputData(const RemoteMessageObject& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 	const bool v2Received = pMessageObject.contains(RESULT_CODE());
 
 	if (!v0Supported || v2Received)
 	{
-		const QString& resultCode = getStringValue(pMessageObject, RESULT_CODE());
-		if (!isIncomplete() && !mOutputData.parseResultCode(QByteArray::fromHex(resultCode.toUtf8())))
+		const QByteArray& resultCode = getByteArrayValue(pMessageObject, RESULT_CODE());
+		if (!isIncomplete() && !mOutputData.parseResultCode(resultCode))
 		{
 			markIncomplete(QStringLiteral("The value of ResultCode should be as defined in the result value table of [PC/SC], Part 10 AMD1, section 2.5.12"));
 		}
 	}
 
-	const QString& outputData = getStringValue(pMessageObject, OUTPUT_DATA());
+	const QByteArray& outputData = getByteArrayValue(pMessageObject, OUTPUT_DATA());
 	if (isIncomplete())
 	{
 		return;
@@ -44,7 +43,7 @@ void IfdEstablishPaceChannelResponse::parseOutputData(const QJsonObject& pMessag
 
 	if (!v0Supported || v2Received)
 	{
-		if (!mOutputData.parseOutputData(QByteArray::fromHex(outputData.toUtf8())))
+		if (!mOutputData.parseOutputData(outputData))
 		{
 			markIncomplete(QStringLiteral("The value of OutputData should be as defined in the result value table of [PC/SC], Part 10 AMD1, section 2.6.16"));
 		}
@@ -52,7 +51,7 @@ void IfdEstablishPaceChannelResponse::parseOutputData(const QJsonObject& pMessag
 		return;
 	}
 
-	if (!mOutputData.parseFromCcid(QByteArray::fromHex(outputData.toUtf8())))
+	if (!mOutputData.parseFromCcid(outputData))
 	{
 		markIncomplete(QStringLiteral("The value of OutputData should be as defined in TR-03119 section D.3"));
 	}
@@ -67,7 +66,7 @@ IfdEstablishPaceChannelResponse::IfdEstablishPaceChannelResponse(const QString&
 }
 
 
-IfdEstablishPaceChannelResponse::IfdEstablishPaceChannelResponse(const QJsonObject& pMessageObject)
+IfdEstablishPaceChannelResponse::IfdEstablishPaceChannelResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
 	, mOutputData()
@@ -97,17 +96,17 @@ const EstablishPaceChannelOutput& IfdEstablishPaceChannelResponse::getOutputData
 
 QByteArray IfdEstablishPaceChannelResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
 	{
-		result[RESULT_CODE()] = QString::fromLatin1(mOutputData.toResultCode().toHex());
-		result[OUTPUT_DATA()] = QString::fromLatin1(mOutputData.toOutputData().toHex());
+		result.insertBinary(RESULT_CODE(), mOutputData.toResultCode());
+		result.insertBinary(OUTPUT_DATA(), mOutputData.toOutputData());
 	}
 	else
 	{
-		result[OUTPUT_DATA()] = QString::fromLatin1(mOutputData.toCcid().toHex());
+		result.insertBinary(OUTPUT_DATA(), mOutputData.toCcid());
 	}
 
 	return RemoteMessage::toByteArray(result);
@@ -17,11 +17,11 @@ class IfdEstablishPaceChannelResponse
 		QString mSlotHandle;
 		EstablishPaceChannelOutput mOutputData;
 
-		void parseOutputData(const QJsonObject& pMessageObject);
+		void parseOutputData(const RemoteMessageObject& pMessageObject);
 
 	public:
 		IfdEstablishPaceChannelResponse(const QString& pSlotHandle, const EstablishPaceChannelOutput& pOutputData, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdEstablishPaceChannelResponse(const QJsonObject& pMessageObject);
+		explicit IfdEstablishPaceChannelResponse(const RemoteMessageObject& pMessageObject);
 		~IfdEstablishPaceChannelResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
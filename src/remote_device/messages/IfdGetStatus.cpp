@@ -5,7 +5,6 @@
 
 #include "IfdGetStatus.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -28,7 +27,7 @@ IfdGetStatus::IfdGetStatus(const QString& pSlotName)
 }
 
 
-IfdGetStatus::IfdGetStatus(const QJsonObject& pMessageObject)
+IfdGetStatus::IfdGetStatus(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotName()
 {
@@ -47,11 +46,11 @@ const QString& IfdGetStatus::getSlotName() const
 }
 
 
-QByteArray IfdGetStatus::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdGetStatus::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_NAME()] = mSlotName;
+	result.insert(SLOT_NAME(), mSlotName);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -4,7 +4,6 @@
 
 #include "IfdModifyPin.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -29,15 +28,14 @@ IfdModifyPin::IfdModifyPin(const QString& pSlotHandle, const QByteArray& pInputD
 }
 
 
-IfdModifyPin::IfdModifyPin(const QJsonObject& pMessageObject)
+IfdModifyPin::IfdModifyPin(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotHandle()
 	, mInputData()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	const QString& inputData = getStringValue(pMessageObject, INPUT_DATA());
-	mInputData = QByteArray::fromHex(inputData.toUtf8());
+	mInputData = getByteArrayValue(pMessageObject, INPUT_DATA());
 
 	if (getType() != RemoteCardMessageType::IFDModifyPIN)
 	{
@@ -58,12 +56,12 @@ const QByteArray& IfdModifyPin::getInputData() const
 }
 
 
-QByteArray IfdModifyPin::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdModifyPin::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
-	result[INPUT_DATA()] = QString::fromLatin1(mInputData.toHex());
+	result.insert(SLOT_HANDLE(), mSlotHandle);
+	result.insertBinary(INPUT_DATA(), mInputData);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -19,7 +19,7 @@ class IfdModifyPin
 
 	public:
 		IfdModifyPin(const QString& pSlotHandle = QString(), const QByteArray& pInputData = QByteArray());
-		explicit IfdModifyPin(const QJsonObject& pMessageObject);
+		explicit IfdModifyPin(const RemoteMessageObject& pMessageObject);
 		~IfdModifyPin() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
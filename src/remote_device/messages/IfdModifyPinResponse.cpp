@@ -4,7 +4,6 @@
 
 #include "IfdModifyPinResponse.h"
 
-#include <QJsonObject>
 #include <QLoggingCategory>
 
 
@@ -29,15 +28,14 @@ IfdModifyPinResponse::IfdModifyPinResponse(const QString& pSlotHandle, const QBy
 }
 
 
-IfdModifyPinResponse::IfdModifyPinResponse(const QJsonObject& pMessageObject)
+IfdModifyPinResponse::IfdModifyPinResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
 	, mOutputData()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
-	const QString& inputData = getStringValue(pMessageObject, OUTPUT_DATA());
-	mOutputData = QByteArray::fromHex(inputData.toUtf8());
+	mOutputData = getByteArrayValue(pMessageObject, OUTPUT_DATA());
 
 	if (getType() != RemoteCardMessageType::IFDModifyPINResponse)
 	{
@@ -94,12 +92,12 @@ CardReturnCode IfdModifyPinResponse::getReturnCode() const
 }
 
 
-QByteArray IfdModifyPinResponse::toByteArray(const IfdVersion&, const QString& pContextHandle) const
+QByteArray IfdModifyPinResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
-	result[OUTPUT_DATA()] = QString::fromLatin1(mOutputData.toHex());
+	result.insert(SLOT_HANDLE(), mSlotHandle);
+	result.insertBinary(OUTPUT_DATA(), mOutputData);
 
 	return RemoteMessage::toByteArray(result);
 }
@@ -33,18 +33,18 @@ VALUE_NAME(EF_DIR, "EFDIR")
 } // namespace
 
 
-QJsonValue IfdStatus::createPaceCapabilities() const
+RemoteMessageObject IfdStatus::createPaceCapabilities(const IfdVersion& pIfdVersion) const
 {
-	QJsonObject result;
-	result[PIN_CAP_PACE()] = mHasPinPad;
-	result[PIN_CAP_EID()] = false;
-	result[PIN_CAP_ESIGN()] = false;
-	result[PIN_CAP_DESTROY()] = false;
+	RemoteMessageObject result(pIfdVersion);
+	result.insert(PIN_CAP_PACE(), mHasPinPad);
+	result.insert(PIN_CAP_EID(), false);
+	result.insert(PIN_CAP_ESIGN(), false);
+	result.insert(PIN_CAP_DESTROY(), false);
 	return result;
 }
 
 
-void IfdStatus::parsePinPad(const QJsonObject& pMessageObject)
+void IfdStatus::parsePinPad(const RemoteMessageObject& pMessageObject)
 {
 	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
 
@@ -52,10 +52,9 @@ void IfdStatus::parsePinPad(const QJsonObject& pMessageObject)
 	if (v0Supported && pMessageObject.contains(PIN_CAPABILITIES()))
 	{
 		pinPadFound = true;
-		QJsonValue value = pMessageObject.value(PIN_CAPABILITIES());
-		if (value.isObject())
+		if (pMessageObject.isObject(PIN_CAPABILITIES()))
 		{
-			QJsonObject object = value.toObject();
+			const RemoteMessageObject& object = pMessageObject.toObject(PIN_CAPABILITIES());
 			mHasPinPad = getBoolValue(object, PIN_CAP_PACE());
 			Q_UNUSED(getBoolValue(object, PIN_CAP_EID()))
 			Q_UNUSED(getBoolValue(object, PIN_CAP_ESIGN()))
@@ -92,7 +91,7 @@ IfdStatus::IfdStatus(const ReaderInfo& pReaderInfo)
 }
 
 
-IfdStatus::IfdStatus(const QJsonObject& pMessageObject)
+IfdStatus::IfdStatus(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotName()
 	, mHasPinPad(false)
@@ -152,22 +151,22 @@ bool IfdStatus::getCardAvailable() const
 
 QByteArray IfdStatus::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_NAME()] = mSlotName;
+	result.insert(SLOT_NAME(), mSlotName);
 	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
 	{
-		result[PIN_PAD()] = mHasPinPad;
+		result.insert(PIN_PAD(), mHasPinPad);
 	}
 	else
 	{
-		result[PIN_CAPABILITIES()] = createPaceCapabilities();
+		result.insert(PIN_CAPABILITIES(), createPaceCapabilities(pIfdVersion));
 	}
-	result[MAX_APDU_LENGTH()] = mMaxApduLength;
-	result[CONNECTED_READER()] = mConnectedReader;
-	result[CARD_AVAILABLE()] = mCardAvailable;
-	result[EF_ATR()] = QJsonValue();
-	result[EF_DIR()] = QJsonValue();
+	result.insert(MAX_APDU_LENGTH(), mMaxApduLength);
+	result.insert(CONNECTED_READER(), mConnectedReader);
+	result.insert(CARD_AVAILABLE(), mCardAvailable);
+	result.insertNull(EF_ATR());
+	result.insertNull(EF_DIR());
 
 	return RemoteMessage::toByteArray(result);
 }
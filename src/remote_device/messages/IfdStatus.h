@@ -7,8 +7,6 @@
 #include "ReaderInfo.h"
 #include "RemoteMessage.h"
 
-#include <QJsonObject>
-
 
 namespace governikus
 {
@@ -24,12 +22,12 @@ class IfdStatus
 		bool mConnectedReader;
 		bool mCardAvailable;
 
-		[[nodiscard]] QJsonValue createPaceCapabilities() const;
-		void parsePinPad(const QJsonObject& pMessageObject);
+		[[nodiscard]] RemoteMessageObject createPaceCapabilities(const IfdVersion& pIfdVersion) const;
+		void parsePinPad(const RemoteMessageObject& pMessageObject);
 
 	public:
 		explicit IfdStatus(const ReaderInfo& pReaderInfo);
-		explicit IfdStatus(const QJsonObject& pMessageObject);
+		explicit IfdStatus(const RemoteMessageObject& pMessageObject);
 		~IfdStatus() override = default;
 
 		[[nodiscard]] const QString& getSlotName() const;
@@ -5,13 +5,6 @@
 
 #include "IfdTransmit.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
-#include <QLoggingCategory>
-
-
-Q_DECLARE_LOGGING_CATEGORY(remote_device)
-
 
 using namespace governikus;
 
@@ -26,45 +19,71 @@ VALUE_NAME(ACCEPTABLE_STATUS_CODES, "AcceptableStatusCodes")
 } // namespace
 
 
-void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
+void IfdTransmit::parseAcceptableStatusCodes(const RemoteMessageObject& pCommandApdu, InputAPDUInfo& pInputApduInfo)
+{
+	if (!pCommandApdu.contains(ACCEPTABLE_STATUS_CODES()) || pCommandApdu.isNull(ACCEPTABLE_STATUS_CODES()))
+	{
+		return;
+	}
+
+	if (pCommandApdu.isString(ACCEPTABLE_STATUS_CODES()))
+	{
+		pInputApduInfo.addAcceptableStatusCode(pCommandApdu.toString(ACCEPTABLE_STATUS_CODES()).toLatin1());
+		return;
+	}
+
+	QStringList statusCodes;
+	if (!pCommandApdu.toStringList(ACCEPTABLE_STATUS_CODES(), statusCodes))
+	{
+		invalidType(ACCEPTABLE_STATUS_CODES(), QLatin1String("string array"));
+		return;
+	}
+
+	for (const auto& statusCode : qAsConst(statusCodes))
+	{
+		pInputApduInfo.addAcceptableStatusCode(statusCode.toLatin1());
+	}
+}
+
+
+void IfdTransmit::parseCommandApdus(const RemoteMessageObject& pMessageObject)
 {
-	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
+	if (!pMessageObject.isArray(COMMAND_APDUS()))
+	{
+		invalidType(COMMAND_APDUS(), QLatin1String("array"));
+		return;
+	}
+
+	QVector<RemoteMessageObject> commandApdus;
+	if (!pMessageObject.toObjectList(COMMAND_APDUS(), commandApdus) || commandApdus.isEmpty())
+	{
+		invalidType(COMMAND_APDUS(), QLatin1String("object array"));
+		return;
+	}
+
+	for (const auto& commandApdu : qAsConst(commandApdus))
+	{
+		InputAPDUInfo inputApduInfo(getByteArrayValue(commandApdu, INPUT_APDU()));
+		parseAcceptableStatusCodes(commandApdu, inputApduInfo);
+		mInputApduInfos += inputApduInfo;
+	}
+}
 
+
+void IfdTransmit::parseInputApdu(const RemoteMessageObject& pMessageObject)
+{
+	// CommandAPDUs is used by IFDInterface_WebSocket_v0 and by clients that received BatchTransmit
 	bool inputApduFound = false;
-	if (v0Supported && pMessageObject.contains(COMMAND_APDUS()))
+	if (pMessageObject.contains(COMMAND_APDUS()))
 	{
 		inputApduFound = true;
-		const auto& value = pMessageObject.value(COMMAND_APDUS());
-		if (value.isArray())
-		{
-			const auto& entry = value.toArray().at(0);
-			if (entry.isObject())
-			{
-				const QJsonObject& commandApdu = entry.toObject();
-				const QString& inputApdu = getStringValue(commandApdu, INPUT_APDU());
-				mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
-			}
-			else
-			{
-				invalidType(COMMAND_APDUS(), QLatin1String("object array"));
-			}
-
-			if (value.toArray().size() > 1)
-			{
-				qCDebug(remote_device) << "Only using the first CommandAPDU. Command chaining ist not supported yet";
-			}
-		}
-		else
-		{
-			invalidType(COMMAND_APDUS(), QLatin1String("array"));
-		}
+		parseCommandApdus(pMessageObject);
 	}
 
-	if (!v0Supported || pMessageObject.contains(INPUT_APDU()))
+	if (pMessageObject.contains(INPUT_APDU()))
 	{
 		inputApduFound = true;
-		const QString& inputApdu = getStringValue(pMessageObject, INPUT_APDU());
-		mInputApdu = QByteArray::fromHex(inputApdu.toUtf8());
+		mInputApduInfos = {InputAPDUInfo(getByteArrayValue(pMessageObject, INPUT_APDU()))};
 	}
 
 	if (!inputApduFound)
@@ -78,16 +97,26 @@ void IfdTransmit::parseInputApdu(const QJsonObject& pMessageObject)
 IfdTransmit::IfdTransmit(const QString& pSlotHandle, const QByteArray& pInputApdu, const QString& pDisplayText)
 	: RemoteMessage(RemoteCardMessageType::IFDTransmit)
 	, mSlotHandle(pSlotHandle)
-	, mInputApdu(pInputApdu)
+	, mInputApduInfos({InputAPDUInfo(pInputApdu)})
+	, mDisplayText(pDisplayText)
+{
+}
+
+
+IfdTransmit::IfdTransmit(const QString& pSlotHandle, const QVector<InputAPDUInfo>& pInputApduInfos, const QString& pDisplayText)
+	: RemoteMessage(RemoteCardMessageType::IFDTransmit)
+	, mSlotHandle(pSlotHandle)
+	, mInputApduInfos(pInputApduInfos)
 	, mDisplayText(pDisplayText)
 {
+	Q_ASSERT(!mInputApduInfos.isEmpty());
 }
 
 
-IfdTransmit::IfdTransmit(const QJsonObject& pMessageObject)
+IfdTransmit::IfdTransmit(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mSlotHandle()
-	, mInputApdu()
+	, mInputApduInfos()
 	, mDisplayText()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
@@ -112,9 +141,20 @@ const QString& IfdTransmit::getSlotHandle() const
 }
 
 
-const QByteArray& IfdTransmit::getInputApdu() const
+QByteArray IfdTransmit::getInputApdu() const
 {
-	return mInputApdu;
+	if (mInputApduInfos.isEmpty())
+	{
+		return QByteArray();
+	}
+
+	return mInputApduInfos.first().getInputApdu().getBuffer();
+}
+
+
+const QVector<InputAPDUInfo>& IfdTransmit::getInputApduInfos() const
+{
+	return mInputApduInfos;
 }
 
 
@@ -126,26 +166,56 @@ const QString& IfdTransmit::getDisplayText() const
 
 QByteArray IfdTransmit::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
-	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
+	// Batches are only created by RemoteCard if the server announced BatchTransmit
+	const bool isBatch = mInputApduInfos.size() > 1 || (!mInputApduInfos.isEmpty() && !mInputApduInfos.first().getAcceptableStatusCodes().isEmpty());
+	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2 && isBatch)
+	{
+		QVector<RemoteMessageObject> commandApdus;
+		for (const auto& inputApduInfo : mInputApduInfos)
+		{
+			RemoteMessageObject commandApdu(pIfdVersion);
+			commandApdu.insertBinary(INPUT_APDU(), inputApduInfo.getInputApdu().getBuffer());
+
+			QStringList statusCodes;
+			for (const auto& statusCode : inputApduInfo.getAcceptableStatusCodes())
+			{
+				statusCodes += QString::fromLatin1(statusCode);
+			}
+			if (statusCodes.isEmpty())
+			{
+				commandApdu.insertNull(ACCEPTABLE_STATUS_CODES());
+			}
+			else
+			{
+				commandApdu.insert(ACCEPTABLE_STATUS_CODES(), statusCodes);
+			}
+			commandApdus += commandApdu;
+		}
+		result.insert(COMMAND_APDUS(), commandApdus);
+
+		if (!mDisplayText.isNull())
+		{
+			result.insert(DISPLAY_TEXT(), mDisplayText);
+		}
+	}
+	else if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
 	{
-		result[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
+		result.insertBinary(INPUT_APDU(), getInputApdu());
 		if (!mDisplayText.isNull())
 		{
-			result[DISPLAY_TEXT()] = mDisplayText;
+			result.insert(DISPLAY_TEXT(), mDisplayText);
 		}
 	}
 	else
 	{
-		QJsonArray commandApdus;
-		QJsonObject commandApdu;
-		commandApdu[INPUT_APDU()] = QString::fromLatin1(mInputApdu.toHex());
-		commandApdu[ACCEPTABLE_STATUS_CODES()] = QJsonValue();
-		commandApdus += commandApdu;
-		result[COMMAND_APDUS()] = commandApdus;
+		RemoteMessageObject commandApdu(pIfdVersion);
+		commandApdu.insertBinary(INPUT_APDU(), getInputApdu());
+		commandApdu.insertNull(ACCEPTABLE_STATUS_CODES());
+		result.insert(COMMAND_APDUS(), QVector<RemoteMessageObject>({commandApdu}));
 	}
 
 	return RemoteMessage::toByteArray(result);
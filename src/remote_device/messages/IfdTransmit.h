@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include "InputAPDUInfo.h"
 #include "RemoteMessage.h"
 
 #include <QByteArray>
+#include <QVector>
 
 
 namespace governikus
@@ -16,18 +18,22 @@ class IfdTransmit
 {
 	private:
 		QString mSlotHandle;
-		QByteArray mInputApdu;
+		QVector<InputAPDUInfo> mInputApduInfos;
 		QString mDisplayText;
 
-		void parseInputApdu(const QJsonObject& pMessageObject);
+		void parseInputApdu(const RemoteMessageObject& pMessageObject);
+		void parseCommandApdus(const RemoteMessageObject& pMessageObject);
+		void parseAcceptableStatusCodes(const RemoteMessageObject& pCommandApdu, InputAPDUInfo& pInputApduInfo);
 
 	public:
 		IfdTransmit(const QString& pSlotHandle, const QByteArray& pInputApdu, const QString& pDisplayText = QString());
-		explicit IfdTransmit(const QJsonObject& pMessageObject);
+		IfdTransmit(const QString& pSlotHandle, const QVector<InputAPDUInfo>& pInputApduInfos, const QString& pDisplayText = QString());
+		explicit IfdTransmit(const RemoteMessageObject& pMessageObject);
 		~IfdTransmit() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
-		[[nodiscard]] const QByteArray& getInputApdu() const;
+		[[nodiscard]] QByteArray getInputApdu() const;
+		[[nodiscard]] const QVector<InputAPDUInfo>& getInputApduInfos() const;
 		[[nodiscard]] const QString& getDisplayText() const;
 		[[nodiscard]] QByteArray toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const override;
 };
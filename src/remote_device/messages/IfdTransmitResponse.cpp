@@ -5,13 +5,6 @@
 
 #include "IfdTransmitResponse.h"
 
-#include <QJsonArray>
-#include <QJsonObject>
-#include <QLoggingCategory>
-
-
-Q_DECLARE_LOGGING_CATEGORY(remote_device)
-
 
 using namespace governikus;
 
@@ -24,30 +17,19 @@ VALUE_NAME(RESPONSE_APDUS, "ResponseAPDUs")
 } // namespace
 
 
-void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
+void IfdTransmitResponse::parseResponseApdu(const RemoteMessageObject& pMessageObject)
 {
-	const bool v0Supported = IfdVersion(IfdVersion::Version::v0).isSupported();
-
+	// ResponseAPDUs is used by IFDInterface_WebSocket_v0 and by servers that announced BatchTransmit
 	bool responseApduFound = false;
-	if (v0Supported && pMessageObject.contains(RESPONSE_APDUS()))
+	if (pMessageObject.contains(RESPONSE_APDUS()))
 	{
 		responseApduFound = true;
-		const auto& value = pMessageObject.value(RESPONSE_APDUS());
-		if (value.isArray())
+		if (pMessageObject.isArray(RESPONSE_APDUS()))
 		{
-			const auto& inputApduValue = value.toArray().at(0);
-			if (inputApduValue.isString())
-			{
-				mResponseApdu = QByteArray::fromHex(inputApduValue.toString().toUtf8());
-			}
-			else
+			if (!pMessageObject.toBinaryList(RESPONSE_APDUS(), mResponseApdus) || mResponseApdus.isEmpty())
 			{
 				invalidType(RESPONSE_APDUS(), QLatin1String("string array"));
-			}
-
-			if (value.toArray().size() > 1)
-			{
-				qCDebug(remote_device) << "Only using the first ResponseAPDU. Command chaining ist not supported yet";
+				mResponseApdus.clear();
 			}
 		}
 		else
@@ -56,11 +38,10 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 		}
 	}
 
-	if (!v0Supported || pMessageObject.contains(RESPONSE_APDU()))
+	if (pMessageObject.contains(RESPONSE_APDU()))
 	{
 		responseApduFound = true;
-		const QString& responseApdu = getStringValue(pMessageObject, RESPONSE_APDU());
-		mResponseApdu = QByteArray::fromHex(responseApdu.toUtf8());
+		mResponseApdus = QByteArrayList({getByteArrayValue(pMessageObject, RESPONSE_APDU())});
 	}
 
 	if (!responseApduFound)
@@ -74,15 +55,23 @@ void IfdTransmitResponse::parseResponseApdu(const QJsonObject& pMessageObject)
 IfdTransmitResponse::IfdTransmitResponse(const QString& pSlotHandle, const QByteArray& pResponseApdu, ECardApiResult::Minor pResultMinor)
 	: RemoteMessageResponse(RemoteCardMessageType::IFDTransmitResponse, pResultMinor)
 	, mSlotHandle(pSlotHandle)
-	, mResponseApdu(pResponseApdu)
+	, mResponseApdus({pResponseApdu})
+{
+}
+
+
+IfdTransmitResponse::IfdTransmitResponse(const QString& pSlotHandle, const QByteArrayList& pResponseApdus, ECardApiResult::Minor pResultMinor)
+	: RemoteMessageResponse(RemoteCardMessageType::IFDTransmitResponse, pResultMinor)
+	, mSlotHandle(pSlotHandle)
+	, mResponseApdus(pResponseApdus)
 {
 }
 
 
-IfdTransmitResponse::IfdTransmitResponse(const QJsonObject& pMessageObject)
+IfdTransmitResponse::IfdTransmitResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessageResponse(pMessageObject)
 	, mSlotHandle()
-	, mResponseApdu()
+	, mResponseApdus()
 {
 	mSlotHandle = getStringValue(pMessageObject, SLOT_HANDLE());
 
@@ -101,27 +90,37 @@ const QString& IfdTransmitResponse::getSlotHandle() const
 }
 
 
-const QByteArray& IfdTransmitResponse::getResponseApdu() const
+QByteArray IfdTransmitResponse::getResponseApdu() const
+{
+	if (mResponseApdus.isEmpty())
+	{
+		return QByteArray();
+	}
+
+	return mResponseApdus.first();
+}
+
+
+const QByteArrayList& IfdTransmitResponse::getResponseApdus() const
 {
-	return mResponseApdu;
+	return mResponseApdus;
 }
 
 
 QByteArray IfdTransmitResponse::toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = createMessageBody(pContextHandle);
+	RemoteMessageObject result = createMessageBody(pIfdVersion, pContextHandle);
 
-	result[SLOT_HANDLE()] = mSlotHandle;
+	result.insert(SLOT_HANDLE(), mSlotHandle);
 
-	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2)
+	const bool isBatch = mResponseApdus.size() > 1;
+	if (pIfdVersion.getVersion() >= IfdVersion::Version::v2 && !isBatch)
 	{
-		result[RESPONSE_APDU()] = QString::fromLatin1(mResponseApdu.toHex());
+		result.insertBinary(RESPONSE_APDU(), getResponseApdu());
 	}
 	else
 	{
-		QJsonArray responseApdus;
-		responseApdus += QString::fromLatin1(mResponseApdu.toHex());
-		result[RESPONSE_APDUS()] = responseApdus;
+		result.insertBinary(RESPONSE_APDUS(), mResponseApdus);
 	}
 
 	return RemoteMessage::toByteArray(result);
@@ -7,6 +7,7 @@
 #include "RemoteMessageResponse.h"
 
 #include <QByteArray>
+#include <QByteArrayList>
 
 
 namespace governikus
@@ -16,17 +17,19 @@ class IfdTransmitResponse
 {
 	private:
 		QString mSlotHandle;
-		QByteArray mResponseApdu;
+		QByteArrayList mResponseApdus;
 
-		void parseResponseApdu(const QJsonObject& pMessageObject);
+		void parseResponseApdu(const RemoteMessageObject& pMessageObject);
 
 	public:
 		IfdTransmitResponse(const QString& pSlotHandle, const QByteArray& pResponseApdu = QByteArray(), ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
-		explicit IfdTransmitResponse(const QJsonObject& pMessageObject);
+		IfdTransmitResponse(const QString& pSlotHandle, const QByteArrayList& pResponseApdus, ECardApiResult::Minor pResultMinor = ECardApiResult::Minor::null);
+		explicit IfdTransmitResponse(const RemoteMessageObject& pMessageObject);
 		~IfdTransmitResponse() override = default;
 
 		[[nodiscard]] const QString& getSlotHandle() const;
-		[[nodiscard]] const QByteArray& getResponseApdu() const;
+		[[nodiscard]] QByteArray getResponseApdu() const;
+		[[nodiscard]] const QByteArrayList& getResponseApdus() const;
 		[[nodiscard]] QByteArray toByteArray(const IfdVersion& pIfdVersion, const QString& pContextHandle) const override;
 };
 
@@ -21,6 +21,11 @@ IfdVersion::Version IfdVersion::fromString(const QString& pVersionString)
 		return Version::v2;
 	}
 
+	if (pVersionString == IfdVersion(Version::v4).toString())
+	{
+		return Version::v4;
+	}
+
 	return Version::Unknown;
 }
 
@@ -61,6 +66,9 @@ QString IfdVersion::toString() const
 
 		case IfdVersion::Version::v2:
 			return QStringLiteral("IFDInterface_WebSocket_v2");
+
+		case IfdVersion::Version::v4:
+			return QStringLiteral("IFDInterface_WebSocket_v4");
 	}
 
 	Q_UNREACHABLE();
@@ -70,7 +78,7 @@ QString IfdVersion::toString() const
 
 QVector<IfdVersion::Version> IfdVersion::supported()
 {
-	return QVector<IfdVersion::Version>({Version::v0, Version::v2});
+	return QVector<IfdVersion::Version>({Version::v0, Version::v2, Version::v4});
 }
 
 
@@ -18,7 +18,8 @@ class IfdVersion
 			Unknown = -1,
 			v0,
 			v2,
-			latest = v2
+			v4,
+			latest = v4
 		};
 
 	private:
@@ -10,6 +10,7 @@
 #ifndef QT_NO_DEBUG
 	#include <QCoreApplication>
 #endif
+#include <QJsonDocument>
 #include <QLoggingCategory>
 
 
@@ -28,13 +29,14 @@ VALUE_NAME(CONTEXT_HANDLE, "ContextHandle")
 
 INIT_FUNCTION([] {
 			qRegisterMetaType<QSharedPointer<const RemoteMessage> >("QSharedPointer<const RemoteMessage>");
+			qRegisterMetaType<RemoteMessageObject>("RemoteMessageObject");
 		})
 
 
-QJsonObject RemoteMessage::createMessageBody(const QString& pContextHandle) const
+RemoteMessageObject RemoteMessage::createMessageBody(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject messageBody;
-	messageBody[MSG_TYPE()] = getEnumName(mMessageType);
+	RemoteMessageObject messageBody(pIfdVersion);
+	messageBody.insert(MSG_TYPE(), getEnumName(mMessageType));
 	if (mMessageType == RemoteCardMessageType::IFDEstablishContext)
 	{
 		return messageBody;
@@ -44,21 +46,28 @@ QJsonObject RemoteMessage::createMessageBody(const QString& pContextHandle) cons
 		Q_ASSERT(!pContextHandle.isEmpty() || mMessageType == RemoteCardMessageType::IFDError || mMessageType == RemoteCardMessageType::IFDEstablishContextResponse);
 	}
 
-	messageBody[CONTEXT_HANDLE()] = pContextHandle;
+	messageBody.insert(CONTEXT_HANDLE(), pContextHandle);
 	return messageBody;
 }
 
 
-QByteArray RemoteMessage::toByteArray(const QJsonObject& pJsonObject)
+QByteArray RemoteMessage::toByteArray(const RemoteMessageObject& pMessageObject)
 {
+	if (pMessageObject.isCbor())
+	{
+		return pMessageObject.getCborMap().toCborValue().toCbor();
+	}
+
+	const QJsonDocument document(pMessageObject.getJsonObject());
+
 #ifndef QT_NO_DEBUG
 	if (QCoreApplication::applicationName().startsWith(QLatin1String("Test")))
 	{
-		return QJsonDocument(pJsonObject).toJson(QJsonDocument::Indented);
+		return document.toJson(QJsonDocument::Indented);
 	}
 #endif
 
-	return QJsonDocument(pJsonObject).toJson(QJsonDocument::Compact);
+	return document.toJson(QJsonDocument::Compact);
 }
 
 
@@ -85,14 +94,13 @@ void RemoteMessage::invalidType(const QLatin1String& pName, const QLatin1String&
 }
 
 
-bool RemoteMessage::getBoolValue(const QJsonObject& pJsonObject, const QLatin1String& pName)
+bool RemoteMessage::getBoolValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
-		if (value.isBool())
+		if (pMessageObject.isBool(pName))
 		{
-			return value.toBool();
+			return pMessageObject.toBool(pName);
 		}
 
 		invalidType(pName, QLatin1String("boolean"));
@@ -104,14 +112,13 @@ bool RemoteMessage::getBoolValue(const QJsonObject& pJsonObject, const QLatin1St
 }
 
 
-int RemoteMessage::getIntValue(const QJsonObject& pJsonObject, const QLatin1String& pName, int pDefault)
+int RemoteMessage::getIntValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName, int pDefault)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
-		if (value.isDouble())
+		if (pMessageObject.isNumber(pName))
 		{
-			return value.toInt();
+			return pMessageObject.toInt(pName);
 		}
 
 		invalidType(pName, QLatin1String("number"));
@@ -123,14 +130,13 @@ int RemoteMessage::getIntValue(const QJsonObject& pJsonObject, const QLatin1Stri
 }
 
 
-QString RemoteMessage::getStringValue(const QJsonObject& pJsonObject, const QLatin1String& pName)
+QString RemoteMessage::getStringValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName)
 {
-	if (pJsonObject.contains(pName))
+	if (pMessageObject.contains(pName))
 	{
-		const auto& value = pJsonObject.value(pName);
-		if (value.isString())
+		if (pMessageObject.isString(pName))
 		{
-			return value.toString();
+			return pMessageObject.toString(pName);
 		}
 
 		invalidType(pName, QLatin1String("string"));
@@ -142,8 +148,52 @@ QString RemoteMessage::getStringValue(const QJsonObject& pJsonObject, const QLat
 }
 
 
-QJsonObject RemoteMessage::parseByteArray(const QByteArray& pMessage)
+QByteArray RemoteMessage::getByteArrayValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName)
 {
+	if (pMessageObject.contains(pName))
+	{
+		if (pMessageObject.isBinary(pName))
+		{
+			return pMessageObject.toBinary(pName);
+		}
+
+		invalidType(pName, pMessageObject.isCbor() ? QLatin1String("byte string") : QLatin1String("string"));
+		return QByteArray();
+	}
+
+	missingValue(pName);
+	return QByteArray();
+}
+
+
+bool RemoteMessage::isBinary(const QByteArray& pMessage)
+{
+	// Every message is a map, which is encoded with major type 5 in CBOR. JSON text starts with '{' or whitespace.
+	return !pMessage.isEmpty() && (static_cast<uchar>(pMessage.at(0)) & 0xE0) == 0xA0;
+}
+
+
+RemoteMessageObject RemoteMessage::parseByteArray(const QByteArray& pMessage)
+{
+	if (isBinary(pMessage))
+	{
+		QCborParserError error {};
+		QCborValue value = QCborValue::fromCbor(pMessage, &error);
+		if (error.error != QCborError::NoError)
+		{
+			qCWarning(remote_device) << "Cbor parsing failed." << error.offset << ":" << error.errorString();
+			value = QCborValue();
+		}
+
+		const QCborMap& obj = value.toMap();
+		if (obj.isEmpty())
+		{
+			qCWarning(remote_device) << "Expected object at top level";
+		}
+
+		return obj;
+	}
+
 	QJsonParseError error {};
 	const QJsonDocument& doc = QJsonDocument::fromJson(pMessage, &error);
 	if (error.error != QJsonParseError::NoError)
@@ -169,7 +219,7 @@ RemoteMessage::RemoteMessage(RemoteCardMessageType pMessageType)
 }
 
 
-RemoteMessage::RemoteMessage(const QJsonObject& pMessageObject)
+RemoteMessage::RemoteMessage(const RemoteMessageObject& pMessageObject)
 	: mIncomplete(false)
 	, mMessageType(RemoteCardMessageType::UNDEFINED)
 	, mContextHandle()
@@ -6,9 +6,8 @@
 
 #include "EnumHelper.h"
 #include "IfdVersion.h"
+#include "RemoteMessageObject.h"
 
-#include <QJsonDocument>
-#include <QJsonObject>
 #include <QString>
 
 
@@ -47,21 +46,30 @@ class RemoteMessage
 		QString mContextHandle;
 
 	protected:
-		[[nodiscard]] virtual QJsonObject createMessageBody(const QString& pContextHandle) const;
-		static QByteArray toByteArray(const QJsonObject& pJsonObject);
+		[[nodiscard]] virtual RemoteMessageObject createMessageBody(const IfdVersion& pIfdVersion, const QString& pContextHandle) const;
+
+		/*!
+		 * Encodes the message as CBOR since IFDInterface_WebSocket_v4 and as JSON text before.
+		 */
+		static QByteArray toByteArray(const RemoteMessageObject& pMessageObject);
 
 		void markIncomplete(const QString& pLogMessage);
 		void missingValue(const QLatin1String& pName);
 		void invalidType(const QLatin1String& pName, const QLatin1String& pExpectedType);
-		bool getBoolValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
-		int getIntValue(const QJsonObject& pJsonObject, const QLatin1String& pName, int pDefault);
-		QString getStringValue(const QJsonObject& pJsonObject, const QLatin1String& pName);
+		bool getBoolValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName);
+		int getIntValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName, int pDefault);
+		QString getStringValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName);
+		QByteArray getByteArrayValue(const RemoteMessageObject& pMessageObject, const QLatin1String& pName);
 
 	public:
-		static QJsonObject parseByteArray(const QByteArray& pMessage);
+		/*!
+		 * Parses a message encoded as JSON text or, since IFDInterface_WebSocket_v4, as CBOR.
+		 */
+		static RemoteMessageObject parseByteArray(const QByteArray& pMessage);
+		static bool isBinary(const QByteArray& pMessage);
 
 		explicit RemoteMessage(RemoteCardMessageType pType);
-		explicit RemoteMessage(const QJsonObject& pMessageObject);
+		explicit RemoteMessage(const RemoteMessageObject& pMessageObject);
 		virtual ~RemoteMessage() = default;
 
 		[[nodiscard]] bool isIncomplete() const;
@@ -0,0 +1,424 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+
+#include "RemoteMessageObject.h"
+
+#include <QCborArray>
+#include <QJsonArray>
+
+
+using namespace governikus;
+
+
+RemoteMessageObject::RemoteMessageObject()
+	: mCbor(false)
+	, mJsonObject()
+	, mCborMap()
+{
+}
+
+
+RemoteMessageObject::RemoteMessageObject(const QJsonObject& pJsonObject)
+	: mCbor(false)
+	, mJsonObject(pJsonObject)
+	, mCborMap()
+{
+}
+
+
+RemoteMessageObject::RemoteMessageObject(const QCborMap& pCborMap)
+	: mCbor(true)
+	, mJsonObject()
+	, mCborMap(pCborMap)
+{
+}
+
+
+RemoteMessageObject::RemoteMessageObject(const IfdVersion& pIfdVersion)
+	: mCbor(pIfdVersion.getVersion() >= IfdVersion::Version::v4)
+	, mJsonObject()
+	, mCborMap()
+{
+}
+
+
+bool RemoteMessageObject::isCbor() const
+{
+	return mCbor;
+}
+
+
+bool RemoteMessageObject::isEmpty() const
+{
+	return mCbor ? mCborMap.isEmpty() : mJsonObject.isEmpty();
+}
+
+
+const QJsonObject& RemoteMessageObject::getJsonObject() const
+{
+	return mJsonObject;
+}
+
+
+const QCborMap& RemoteMessageObject::getCborMap() const
+{
+	return mCborMap;
+}
+
+
+bool RemoteMessageObject::contains(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.contains(pName) : mJsonObject.contains(pName);
+}
+
+
+bool RemoteMessageObject::isNull(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isNull() : mJsonObject.value(pName).isNull();
+}
+
+
+bool RemoteMessageObject::isBool(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isBool() : mJsonObject.value(pName).isBool();
+}
+
+
+bool RemoteMessageObject::isNumber(const QLatin1String& pName) const
+{
+	if (mCbor)
+	{
+		const auto& value = mCborMap.value(pName);
+		return value.isInteger() || value.isDouble();
+	}
+
+	return mJsonObject.value(pName).isDouble();
+}
+
+
+bool RemoteMessageObject::isString(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isString() : mJsonObject.value(pName).isString();
+}
+
+
+bool RemoteMessageObject::isBinary(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isByteArray() : mJsonObject.value(pName).isString();
+}
+
+
+bool RemoteMessageObject::isArray(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isArray() : mJsonObject.value(pName).isArray();
+}
+
+
+bool RemoteMessageObject::isObject(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).isMap() : mJsonObject.value(pName).isObject();
+}
+
+
+bool RemoteMessageObject::toBool(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).toBool() : mJsonObject.value(pName).toBool();
+}
+
+
+int RemoteMessageObject::toInt(const QLatin1String& pName) const
+{
+	if (mCbor)
+	{
+		const auto& value = mCborMap.value(pName);
+		return static_cast<int>(value.isDouble() ? value.toDouble() : value.toInteger());
+	}
+
+	return mJsonObject.value(pName).toInt();
+}
+
+
+QString RemoteMessageObject::toString(const QLatin1String& pName) const
+{
+	return mCbor ? mCborMap.value(pName).toString() : mJsonObject.value(pName).toString();
+}
+
+
+QByteArray RemoteMessageObject::toBinary(const QLatin1String& pName) const
+{
+	if (mCbor)
+	{
+		return mCborMap.value(pName).toByteArray();
+	}
+
+	return QByteArray::fromHex(mJsonObject.value(pName).toString().toLatin1());
+}
+
+
+RemoteMessageObject RemoteMessageObject::toObject(const QLatin1String& pName) const
+{
+	if (mCbor)
+	{
+		return RemoteMessageObject(mCborMap.value(pName).toMap());
+	}
+
+	return RemoteMessageObject(mJsonObject.value(pName).toObject());
+}
+
+
+bool RemoteMessageObject::toStringList(const QLatin1String& pName, QStringList& pValues) const
+{
+	if (mCbor)
+	{
+		const auto& value = mCborMap.value(pName);
+		if (!value.isArray())
+		{
+			return false;
+		}
+
+		const auto& array = value.toArray();
+		bool valid = true;
+		for (const auto& entry : array)
+		{
+			if (!entry.isString())
+			{
+				valid = false;
+				continue;
+			}
+			pValues += entry.toString();
+		}
+		return valid;
+	}
+
+	const auto& value = mJsonObject.value(pName);
+	if (!value.isArray())
+	{
+		return false;
+	}
+
+	const auto& array = value.toArray();
+	bool valid = true;
+	for (const auto& entry : array)
+	{
+		if (!entry.isString())
+		{
+			valid = false;
+			continue;
+		}
+		pValues += entry.toString();
+	}
+	return valid;
+}
+
+
+bool RemoteMessageObject::toBinaryList(const QLatin1String& pName, QByteArrayList& pValues) const
+{
+	if (mCbor)
+	{
+		const auto& value = mCborMap.value(pName);
+		if (!value.isArray())
+		{
+			return false;
+		}
+
+		const auto& array = value.toArray();
+		bool valid = true;
+		for (const auto& entry : array)
+		{
+			if (!entry.isByteArray())
+			{
+				valid = false;
+				continue;
+			}
+			pValues += entry.toByteArray();
+		}
+		return valid;
+	}
+
+	QStringList hexValues;
+	const bool valid = toStringList(pName, hexValues);
+	for (const auto& hexValue : qAsConst(hexValues))
+	{
+		pValues += QByteArray::fromHex(hexValue.toLatin1());
+	}
+	return valid;
+}
+
+
+bool RemoteMessageObject::toObjectList(const QLatin1String& pName, QVector<RemoteMessageObject>& pValues) const
+{
+	if (mCbor)
+	{
+		const auto& value = mCborMap.value(pName);
+		if (!value.isArray())
+		{
+			return false;
+		}
+
+		const auto& array = value.toArray();
+		bool valid = true;
+		for (const auto& entry : array)
+		{
+			if (!entry.isMap())
+			{
+				valid = false;
+				continue;
+			}
+			pValues += RemoteMessageObject(entry.toMap());
+		}
+		return valid;
+	}
+
+	const auto& value = mJsonObject.value(pName);
+	if (!value.isArray())
+	{
+		return false;
+	}
+
+	const auto& array = value.toArray();
+	bool valid = true;
+	for (const auto& entry : array)
+	{
+		if (!entry.isObject())
+		{
+			valid = false;
+			continue;
+		}
+		pValues += RemoteMessageObject(entry.toObject());
+	}
+	return valid;
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, const QString& pValue)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = pValue;
+		return;
+	}
+
+	mJsonObject[pName] = pValue;
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, bool pValue)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = pValue;
+		return;
+	}
+
+	mJsonObject[pName] = pValue;
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, int pValue)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = pValue;
+		return;
+	}
+
+	mJsonObject[pName] = pValue;
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, const QStringList& pValues)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = QCborArray::fromStringList(pValues);
+		return;
+	}
+
+	mJsonObject[pName] = QJsonArray::fromStringList(pValues);
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, const RemoteMessageObject& pValue)
+{
+	Q_ASSERT(mCbor == pValue.mCbor);
+
+	if (mCbor)
+	{
+		mCborMap[pName] = pValue.mCborMap;
+		return;
+	}
+
+	mJsonObject[pName] = pValue.mJsonObject;
+}
+
+
+void RemoteMessageObject::insert(const QLatin1String& pName, const QVector<RemoteMessageObject>& pValues)
+{
+	if (mCbor)
+	{
+		QCborArray array;
+		for (const auto& value : pValues)
+		{
+			Q_ASSERT(value.mCbor);
+			array += value.mCborMap;
+		}
+		mCborMap[pName] = array;
+		return;
+	}
+
+	QJsonArray array;
+	for (const auto& value : pValues)
+	{
+		Q_ASSERT(!value.mCbor);
+		array += value.mJsonObject;
+	}
+	mJsonObject[pName] = array;
+}
+
+
+void RemoteMessageObject::insertNull(const QLatin1String& pName)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = QCborValue(nullptr);
+		return;
+	}
+
+	mJsonObject[pName] = QJsonValue();
+}
+
+
+void RemoteMessageObject::insertBinary(const QLatin1String& pName, const QByteArray& pValue)
+{
+	if (mCbor)
+	{
+		mCborMap[pName] = pValue;
+		return;
+	}
+
+	mJsonObject[pName] = QString::fromLatin1(pValue.toHex());
+}
+
+
+void RemoteMessageObject::insertBinary(const QLatin1String& pName, const QByteArrayList& pValues)
+{
+	if (mCbor)
+	{
+		QCborArray array;
+		for (const auto& value : pValues)
+		{
+			array += value;
+		}
+		mCborMap[pName] = array;
+		return;
+	}
+
+	QJsonArray array;
+	for (const auto& value : pValues)
+	{
+		array += QString::fromLatin1(value.toHex());
+	}
+	mJsonObject[pName] = array;
+}
@@ -0,0 +1,86 @@
+/*!
+ * \brief Encoding independent access to the fields of an IFD message.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "IfdVersion.h"
+
+#include <QByteArrayList>
+#include <QCborMap>
+#include <QJsonObject>
+#include <QStringList>
+#include <QVector>
+
+
+namespace governikus
+{
+
+/*!
+ * Fields of an IFD message. JSON messages are kept as QJsonObject and carry binary
+ * values as hex strings. Only if IFDInterface_WebSocket_v4 is used the fields are kept
+ * as QCborMap with binary values as byte strings. A message is never converted
+ * between both encodings.
+ */
+class RemoteMessageObject
+{
+	private:
+		bool mCbor;
+		QJsonObject mJsonObject;
+		QCborMap mCborMap;
+
+	public:
+		RemoteMessageObject();
+		RemoteMessageObject(const QJsonObject& pJsonObject);
+		RemoteMessageObject(const QCborMap& pCborMap);
+
+		/*!
+		 * Creates an empty message with the encoding of the negotiated version.
+		 */
+		explicit RemoteMessageObject(const IfdVersion& pIfdVersion);
+
+		[[nodiscard]] bool isCbor() const;
+		[[nodiscard]] bool isEmpty() const;
+		[[nodiscard]] const QJsonObject& getJsonObject() const;
+		[[nodiscard]] const QCborMap& getCborMap() const;
+
+		[[nodiscard]] bool contains(const QLatin1String& pName) const;
+		[[nodiscard]] bool isNull(const QLatin1String& pName) const;
+		[[nodiscard]] bool isBool(const QLatin1String& pName) const;
+		[[nodiscard]] bool isNumber(const QLatin1String& pName) const;
+		[[nodiscard]] bool isString(const QLatin1String& pName) const;
+		[[nodiscard]] bool isBinary(const QLatin1String& pName) const;
+		[[nodiscard]] bool isArray(const QLatin1String& pName) const;
+		[[nodiscard]] bool isObject(const QLatin1String& pName) const;
+
+		[[nodiscard]] bool toBool(const QLatin1String& pName) const;
+		[[nodiscard]] int toInt(const QLatin1String& pName) const;
+		[[nodiscard]] QString toString(const QLatin1String& pName) const;
+		[[nodiscard]] QByteArray toBinary(const QLatin1String& pName) const;
+		[[nodiscard]] RemoteMessageObject toObject(const QLatin1String& pName) const;
+
+		/*!
+		 * Appends every entry of the expected type and returns false if the value
+		 * is no array or if any entry has a different type.
+		 */
+		bool toStringList(const QLatin1String& pName, QStringList& pValues) const;
+		bool toBinaryList(const QLatin1String& pName, QByteArrayList& pValues) const;
+		bool toObjectList(const QLatin1String& pName, QVector<RemoteMessageObject>& pValues) const;
+
+		void insert(const QLatin1String& pName, const QString& pValue);
+		void insert(const QLatin1String& pName, bool pValue);
+		void insert(const QLatin1String& pName, int pValue);
+		void insert(const QLatin1String& pName, const QStringList& pValues);
+		void insert(const QLatin1String& pName, const RemoteMessageObject& pValue);
+		void insert(const QLatin1String& pName, const QVector<RemoteMessageObject>& pValues);
+		void insertNull(const QLatin1String& pName);
+		void insertBinary(const QLatin1String& pName, const QByteArray& pValue);
+		void insertBinary(const QLatin1String& pName, const QByteArrayList& pValues);
+};
+
+
+} // namespace governikus
+
+Q_DECLARE_METATYPE(governikus::RemoteMessageObject)
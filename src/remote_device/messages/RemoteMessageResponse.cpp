@@ -21,12 +21,19 @@ VALUE_NAME(RESULT_MINOR, "ResultMinor")
 } // namespace
 
 
-QJsonObject RemoteMessageResponse::createMessageBody(const QString& pContextHandle) const
+RemoteMessageObject RemoteMessageResponse::createMessageBody(const IfdVersion& pIfdVersion, const QString& pContextHandle) const
 {
-	QJsonObject result = RemoteMessage::createMessageBody(pContextHandle);
+	RemoteMessageObject result = RemoteMessage::createMessageBody(pIfdVersion, pContextHandle);
 	const ECardApiResult eCardApiResult(mResultMajor, mResultMinor);
-	result[RESULT_MAJOR()] = eCardApiResult.getMajorString();
-	result[RESULT_MINOR()] = mResultMinor == ECardApiResult::Minor::null ? QJsonValue() : eCardApiResult.getMinorString();
+	result.insert(RESULT_MAJOR(), eCardApiResult.getMajorString());
+	if (mResultMinor == ECardApiResult::Minor::null)
+	{
+		result.insertNull(RESULT_MINOR());
+	}
+	else
+	{
+		result.insert(RESULT_MINOR(), eCardApiResult.getMinorString());
+	}
 	return result;
 }
 
@@ -39,7 +46,7 @@ RemoteMessageResponse::RemoteMessageResponse(RemoteCardMessageType pMessageType,
 }
 
 
-RemoteMessageResponse::RemoteMessageResponse(const QJsonObject& pMessageObject)
+RemoteMessageResponse::RemoteMessageResponse(const RemoteMessageObject& pMessageObject)
 	: RemoteMessage(pMessageObject)
 	, mResultMajor(ECardApiResult::Major::Ok)
 	, mResultMinor(ECardApiResult::Minor::null)
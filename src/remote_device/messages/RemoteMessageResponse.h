@@ -18,11 +18,11 @@ class RemoteMessageResponse
 		ECardApiResult::Minor mResultMinor;
 
 	protected:
-		[[nodiscard]] QJsonObject createMessageBody(const QString& pContextHandle) const override;
+		[[nodiscard]] RemoteMessageObject createMessageBody(const IfdVersion& pIfdVersion, const QString& pContextHandle) const override;
 
 	public:
 		RemoteMessageResponse(RemoteCardMessageType pType, ECardApiResult::Minor pResultMinor);
-		explicit RemoteMessageResponse(const QJsonObject& pMessageObject);
+		explicit RemoteMessageResponse(const RemoteMessageObject& pMessageObject);
 		~RemoteMessageResponse() override = default;
 
 		[[nodiscard]] bool resultHasError() const;
@@ -59,7 +59,7 @@ bool RemoteCard::sendMessage(const QSharedPointer<const RemoteMessage>& pMessage
 }
 
 
-void RemoteCard::onMessageReceived(RemoteCardMessageType pMessageTpe, const QJsonObject& pJsonObject)
+void RemoteCard::onMessageReceived(RemoteCardMessageType pMessageTpe, const RemoteMessageObject& pMessageObject)
 {
 	QMutexLocker locker(&mProcessResponse);
 
@@ -70,7 +70,7 @@ void RemoteCard::onMessageReceived(RemoteCardMessageType pMessageTpe, const QJso
 
 	if (pMessageTpe == mExpectedAnswerType || pMessageTpe == RemoteCardMessageType::IFDError)
 	{
-		mResponse = pJsonObject;
+		mResponse = pMessageObject;
 		mWaitingForAnswer = false;
 		mWaitCondition.wakeOne();
 	}
@@ -86,7 +86,7 @@ void RemoteCard::onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString
 	{
 		qCWarning(card_remote) << "RemoteDispatcher was closed while waiting for an answer:" << pCloseCode;
 
-		mResponse = QJsonObject();
+		mResponse = RemoteMessageObject();
 		mWaitingForAnswer = false;
 		mWaitCondition.wakeOne();
 	}
@@ -206,6 +206,53 @@ ResponseApduResult RemoteCard::transmit(const CommandApdu& pCommand)
 }
 
 
+QVector<ResponseApduResult> RemoteCard::transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos)
+{
+	if (!mRemoteDispatcher->isBatchTransmitSupported())
+	{
+		return QVector<ResponseApduResult>();
+	}
+
+	qCDebug(card_remote) << "Transmit batch of" << pInputApduInfos.size() << "command APDUs";
+
+	const QSharedPointer<const IfdTransmit>& transmitCmd = QSharedPointer<IfdTransmit>::create(mSlotHandle, pInputApduInfos, mProgressMessage);
+	if (sendMessage(transmitCmd, RemoteCardMessageType::IFDTransmitResponse, 5000 * static_cast<unsigned long>(pInputApduInfos.size())))
+	{
+		mProgressMessage.clear();
+
+		const IfdTransmitResponse response(mResponse);
+		if (!response.isIncomplete() && !response.getResponseApdus().isEmpty())
+		{
+			// A failed batch carries the responses of the command APDUs processed before the failure
+			QVector<ResponseApduResult> results;
+			for (const auto& responseApdu : response.getResponseApdus())
+			{
+				if (response.resultHasError() && responseApdu.isEmpty())
+				{
+					continue;
+				}
+
+				qCDebug(card_remote) << "Transmit response APDU:" << responseApdu.toHex();
+				results += ResponseApduResult{CardReturnCode::OK, ResponseApdu(responseApdu)};
+			}
+
+			if (!response.resultHasError())
+			{
+				return results;
+			}
+
+			qCWarning(card_remote) << response.getResultMinor();
+			results += ResponseApduResult{CardReturnCode::COMMAND_FAILED};
+			return results;
+		}
+
+		return {ResponseApduResult{CardReturnCode::COMMAND_FAILED}};
+	}
+
+	return {ResponseApduResult{CardReturnCode::INPUT_TIME_OUT}};
+}
+
+
 EstablishPaceChannelOutput RemoteCard::establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription, quint8 pTimeoutSeconds)
 {
 	EstablishPaceChannel establishPaceChannel(pPasswordId, pChat, pCertificateDescription);
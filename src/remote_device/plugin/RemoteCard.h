@@ -30,7 +30,7 @@ class RemoteCard
 		QMutex mResponseAvailable, mProcessResponse;
 
 		RemoteCardMessageType mExpectedAnswerType;
-		QJsonObject mResponse;
+		RemoteMessageObject mResponse;
 		const QSharedPointer<RemoteDispatcherClient> mRemoteDispatcher;
 		QString mReaderName;
 		QString mSlotHandle;
@@ -40,7 +40,7 @@ class RemoteCard
 		bool sendMessage(const QSharedPointer<const RemoteMessage>& pMessage, RemoteCardMessageType pExpectedAnswer, unsigned long pTimeout);
 
 	private Q_SLOTS:
-		void onMessageReceived(RemoteCardMessageType pMessageTpe, const QJsonObject& pJsonObject);
+		void onMessageReceived(RemoteCardMessageType pMessageTpe, const RemoteMessageObject& pMessageObject);
 		void onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 
 	Q_SIGNALS:
@@ -56,6 +56,7 @@ class RemoteCard
 		void setProgressMessage(const QString& pMessage, int pProgress = -1) override;
 
 		ResponseApduResult transmit(const CommandApdu& pCmd) override;
+		QVector<ResponseApduResult> transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos) override;
 
 		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId, int pPreferredPinLength, const QByteArray& pChat, const QByteArray& pCertificateDescription, quint8 pTimeoutSeconds = 60) override;
 
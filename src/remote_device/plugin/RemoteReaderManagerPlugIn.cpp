@@ -73,7 +73,7 @@ void RemoteReaderManagerPlugIn::connectToPairedReaders()
 }
 
 
-void RemoteReaderManagerPlugIn::handleIFDStatus(const QJsonObject& pJsonObject, const QString& pId)
+void RemoteReaderManagerPlugIn::handleIFDStatus(const RemoteMessageObject& pMessageObject, const QString& pId)
 {
 	const auto it = mDispatcherList.constFind(pId);
 	if (it == mDispatcherList.constEnd())
@@ -81,7 +81,7 @@ void RemoteReaderManagerPlugIn::handleIFDStatus(const QJsonObject& pJsonObject,
 		return;
 	}
 	const auto& remoteDispatcher = *it;
-	IfdStatus ifdStatus(pJsonObject);
+	IfdStatus ifdStatus(pMessageObject);
 
 	const QString& contextHandle = remoteDispatcher->getContextHandle();
 	const QString& readerName = ifdStatus.getSlotName() + contextHandle;
@@ -193,7 +193,7 @@ void RemoteReaderManagerPlugIn::onContextEstablished(const QString& pIfdName, co
 }
 
 
-void RemoteReaderManagerPlugIn::onRemoteMessage(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId)
+void RemoteReaderManagerPlugIn::onRemoteMessage(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject, const QString& pId)
 {
 	switch (pMessageType)
 	{
@@ -225,7 +225,7 @@ void RemoteReaderManagerPlugIn::onRemoteMessage(RemoteCardMessageType pMessageTy
 		}
 
 		case RemoteCardMessageType::IFDStatus:
-			handleIFDStatus(pJsonObject, pId);
+			handleIFDStatus(pMessageObject, pId);
 			break;
 	}
 }
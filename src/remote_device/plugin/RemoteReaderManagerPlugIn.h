@@ -38,11 +38,11 @@ class RemoteReaderManagerPlugIn
 		void removeDispatcher(const QString& pId);
 		void removeAllDispatchers();
 
-		void handleIFDStatus(const QJsonObject& pJsonObject, const QString& pId);
+		void handleIFDStatus(const RemoteMessageObject& pMessageObject, const QString& pId);
 
 	private Q_SLOTS:
 		void onContextEstablished(const QString& pIfdName, const QString& pId);
-		void onRemoteMessage(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void onRemoteMessage(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject, const QString& pId);
 		void onDispatcherClosed(GlobalStatus::Code pCloseCode, const QString& pId);
 		void addRemoteDispatcher(const QSharedPointer<RemoteDispatcherClient>& pRemoteDispatcher);
 		void connectToPairedReaders();
@@ -6,6 +6,7 @@
 #include "AbstractSettings.h"
 
 #include <QCoreApplication>
+#include <QStandardPaths>
 
 using namespace governikus;
 
@@ -42,3 +43,21 @@ QSharedPointer<QSettings> AbstractSettings::getStore(const QString& pFilename, Q
 	Q_ASSERT(pFilename.isEmpty() == (pFormat == QSettings::InvalidFormat));
 	return pFilename.isEmpty() ? QSharedPointer<QSettings>::create() : QSharedPointer<QSettings>::create(pFilename, pFormat);
 }
+
+
+QString AbstractSettings::getDataFilePath(const QString& pFilename)
+{
+#ifndef QT_NO_DEBUG
+	if (QCoreApplication::applicationName().startsWith(QLatin1String("Test")))
+	{
+		if (mTestDir.isNull())
+		{
+			mTestDir.reset(new QTemporaryDir());
+			Q_ASSERT(mTestDir->isValid());
+		}
+		return mTestDir->filePath(QCoreApplication::applicationName() + QLatin1Char('_') + pFilename);
+	}
+#endif
+
+	return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + QLatin1Char('/') + pFilename;
+}
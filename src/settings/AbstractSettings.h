@@ -37,6 +37,11 @@ class AbstractSettings
 
 		static QSharedPointer<QSettings> getStore(const QString& pFilename = QString(), QSettings::Format pFormat = QSettings::InvalidFormat);
 
+		/*!
+		 * Returns the path of a data file that is stored beside the settings.
+		 */
+		static QString getDataFilePath(const QString& pFilename);
+
 		virtual void save() = 0;
 
 	Q_SIGNALS:
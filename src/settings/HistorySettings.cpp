@@ -20,6 +20,7 @@ SETTINGS_NAME(SETTINGS_NAME_CHRONIC_USAGE, "usage")
 SETTINGS_NAME(SETTINGS_NAME_CHRONIC_DATETIME, "dateTime")
 SETTINGS_NAME(SETTINGS_NAME_CHRONIC_TOU, "termOfUsage")
 SETTINGS_NAME(SETTINGS_NAME_CHRONIC_REQUESTED_DATA, "requestedData")
+SETTINGS_NAME(HISTORY_STORE_FILE_NAME, "history.dat")
 } // namespace
 
 using namespace governikus;
@@ -29,10 +30,13 @@ Q_DECLARE_LOGGING_CATEGORY(settings)
 HistorySettings::HistorySettings()
 	: AbstractSettings()
 	, mStore(getStore())
-	, mHistoryInfos()
+	, mHistoryStore(getDataFilePath(HISTORY_STORE_FILE_NAME()))
 {
 	mStore->beginGroup(SETTINGS_GROUP_NAME_CHRONIC());
-	mHistoryInfos = getHistoryInfosFromStore();
+	if (!mHistoryStore.load())
+	{
+		migrateHistoryInfos();
+	}
 }
 
 
@@ -65,7 +69,25 @@ void HistorySettings::setEnabled(bool pEnabled)
 
 const QVector<HistoryInfo>& HistorySettings::getHistoryInfos() const
 {
-	return mHistoryInfos;
+	return mHistoryStore.getHistoryInfos();
+}
+
+
+void HistorySettings::migrateHistoryInfos()
+{
+	// An unreadable store was moved aside by load(), otherwise it is replaced here.
+	const auto historyInfos = getHistoryInfosFromStore();
+	if (!mHistoryStore.write(historyInfos))
+	{
+		return;
+	}
+
+	if (!historyInfos.isEmpty())
+	{
+		qCInfo(settings) << "Migrated" << historyInfos.size() << "history entries to" << mHistoryStore.getFileName();
+	}
+	mStore->remove(SETTINGS_NAME_HISTORY_ITEMS());
+	mStore->sync();
 }
 
 
@@ -94,27 +116,7 @@ QVector<HistoryInfo> HistorySettings::getHistoryInfosFromStore() const
 
 void HistorySettings::setHistoryInfos(const QVector<HistoryInfo>& pHistoryInfos)
 {
-	mStore->beginGroup(SETTINGS_NAME_HISTORY_ITEMS());
-	mStore->remove(QString());
-	mStore->endGroup();
-
-	mStore->beginWriteArray(SETTINGS_NAME_HISTORY_ITEMS());
-	for (int i = 0; i < pHistoryInfos.size(); ++i)
-	{
-		const HistoryInfo& item = pHistoryInfos.at(i);
-
-		mStore->setArrayIndex(i);
-		mStore->setValue(SETTINGS_NAME_CHRONIC_SUBJECTNAME(), item.getSubjectName());
-		mStore->setValue(SETTINGS_NAME_CHRONIC_SUBJECTURL(), item.getSubjectUrl());
-		mStore->setValue(SETTINGS_NAME_CHRONIC_USAGE(), item.getPurpose());
-		mStore->setValue(SETTINGS_NAME_CHRONIC_DATETIME(), item.getDateTime().toString(Qt::ISODate));
-		mStore->setValue(SETTINGS_NAME_CHRONIC_TOU(), item.getTermOfUsage());
-		mStore->setValue(SETTINGS_NAME_CHRONIC_REQUESTED_DATA(), item.getRequestedData());
-	}
-	mStore->endArray();
-
-	mHistoryInfos = pHistoryInfos;
-
+	mHistoryStore.write(pHistoryInfos);
 	Q_EMIT fireHistoryInfosChanged();
 }
 
@@ -127,9 +129,8 @@ void HistorySettings::addHistoryInfo(const HistoryInfo& pHistoryInfo)
 		return;
 	}
 
-	auto historyInfos = getHistoryInfos();
-	historyInfos.prepend(pHistoryInfo);
-	setHistoryInfos(historyInfos);
+	mHistoryStore.append(pHistoryInfo);
+	Q_EMIT fireHistoryInfosChanged();
 }
 
 
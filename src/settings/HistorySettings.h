@@ -10,6 +10,7 @@
 
 #include "EnumHelper.h"
 #include "HistoryInfo.h"
+#include "HistoryStore.h"
 
 #include <QVector>
 
@@ -34,13 +35,15 @@ class HistorySettings
 {
 	Q_OBJECT
 	friend class AppSettings;
+	friend class ::test_HistorySettings;
 
 	private:
 		QSharedPointer<QSettings> mStore;
-		QVector<HistoryInfo> mHistoryInfos;
+		HistoryStore mHistoryStore;
 
 		HistorySettings();
 		[[nodiscard]] QVector<HistoryInfo> getHistoryInfosFromStore() const;
+		void migrateHistoryInfos();
 
 	public:
 		~HistorySettings() override;
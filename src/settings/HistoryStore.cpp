@@ -0,0 +1,229 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "HistoryStore.h"
+
+#include <algorithm>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLoggingCategory>
+#include <QSaveFile>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(settings)
+
+
+const quint32 HistoryStore::MAGIC = 0x41413248; // "AA2H"
+const quint32 HistoryStore::VERSION = 1;
+
+
+namespace
+{
+const auto STREAM_VERSION = QDataStream::Qt_5_12;
+} // namespace
+
+
+HistoryStore::HistoryStore(const QString& pFileName)
+	: mFileName(pFileName)
+	, mHistoryInfos()
+{
+}
+
+
+QByteArray HistoryStore::encode(const HistoryInfo& pHistoryInfo)
+{
+	QByteArray record;
+	QDataStream stream(&record, QIODevice::WriteOnly);
+	stream.setVersion(STREAM_VERSION);
+	stream << pHistoryInfo.getSubjectName()
+		   << pHistoryInfo.getSubjectUrl()
+		   << pHistoryInfo.getPurpose()
+		   << pHistoryInfo.getDateTime()
+		   << pHistoryInfo.getTermOfUsage()
+		   << pHistoryInfo.getRequestedData();
+
+	QByteArray framed;
+	QDataStream framedStream(&framed, QIODevice::WriteOnly);
+	framedStream.setVersion(STREAM_VERSION);
+	framedStream << static_cast<quint32>(record.size());
+	return framed + record;
+}
+
+
+bool HistoryStore::decode(const QByteArray& pRecord, HistoryInfo& pHistoryInfo)
+{
+	QDataStream stream(pRecord);
+	stream.setVersion(STREAM_VERSION);
+
+	QString subjectName;
+	QString subjectUrl;
+	QString purpose;
+	QDateTime dateTime;
+	QString termOfUsage;
+	QStringList requestedData;
+	stream >> subjectName >> subjectUrl >> purpose >> dateTime >> termOfUsage >> requestedData;
+	if (stream.status() != QDataStream::Ok)
+	{
+		return false;
+	}
+
+	pHistoryInfo = HistoryInfo(subjectName, subjectUrl, purpose, dateTime, termOfUsage, requestedData);
+	return true;
+}
+
+
+const QString& HistoryStore::getFileName() const
+{
+	return mFileName;
+}
+
+
+bool HistoryStore::exists() const
+{
+	return QFile::exists(mFileName);
+}
+
+
+void HistoryStore::moveAside() const
+{
+	const QString backupFileName = mFileName + QStringLiteral(".unreadable");
+	QFile::remove(backupFileName);
+	if (QFile::rename(mFileName, backupFileName))
+	{
+		qCWarning(settings) << "Moved unreadable history store to" << backupFileName;
+	}
+	else if (!QFile::remove(mFileName))
+	{
+		qCCritical(settings) << "Cannot remove unreadable history store:" << mFileName;
+	}
+}
+
+
+bool HistoryStore::load()
+{
+	mHistoryInfos.clear();
+
+	QFile file(mFileName);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(STREAM_VERSION);
+
+	quint32 magic = 0;
+	quint32 version = 0;
+	stream >> magic >> version;
+	if (stream.status() != QDataStream::Ok || magic != MAGIC || version != VERSION)
+	{
+		qCCritical(settings) << "Unknown history store:" << mFileName;
+		file.close();
+		moveAside();
+		return false;
+	}
+
+	QVector<HistoryInfo> historyInfos;
+	qint64 validSize = file.pos();
+	while (!stream.atEnd())
+	{
+		quint32 size = 0;
+		stream >> size;
+		if (stream.status() != QDataStream::Ok || size > file.bytesAvailable())
+		{
+			break;
+		}
+		const QByteArray record = file.read(size);
+
+		HistoryInfo info;
+		if (record.size() != static_cast<int>(size) || !decode(record, info))
+		{
+			break;
+		}
+
+		historyInfos += info;
+		validSize = file.pos();
+	}
+	file.close();
+
+	if (validSize != file.size())
+	{
+		qCWarning(settings) << "Drop incomplete history record at" << validSize;
+		if (!QFile::resize(mFileName, validSize))
+		{
+			qCCritical(settings) << "Cannot truncate history store:" << mFileName;
+		}
+	}
+
+	std::reverse(historyInfos.begin(), historyInfos.end());
+	mHistoryInfos = historyInfos;
+	return true;
+}
+
+
+const QVector<HistoryInfo>& HistoryStore::getHistoryInfos() const
+{
+	return mHistoryInfos;
+}
+
+
+bool HistoryStore::append(const HistoryInfo& pHistoryInfo)
+{
+	if (!exists() && !write(mHistoryInfos))
+	{
+		return false;
+	}
+
+	QFile file(mFileName);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+	{
+		qCCritical(settings) << "Cannot open history store:" << file.errorString();
+		return false;
+	}
+
+	const auto record = encode(pHistoryInfo);
+	if (file.write(record) != record.size())
+	{
+		qCCritical(settings) << "Cannot append history entry:" << file.errorString();
+		return false;
+	}
+
+	mHistoryInfos.prepend(pHistoryInfo);
+	return true;
+}
+
+
+bool HistoryStore::write(const QVector<HistoryInfo>& pHistoryInfos)
+{
+	QDir().mkpath(QFileInfo(mFileName).absolutePath());
+
+	QSaveFile file(mFileName);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		qCCritical(settings) << "Cannot write history store:" << file.errorString();
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(STREAM_VERSION);
+	stream << MAGIC << VERSION;
+	for (auto iter = pHistoryInfos.crbegin(); iter != pHistoryInfos.crend(); ++iter)
+	{
+		file.write(encode(*iter));
+	}
+
+	if (!file.commit())
+	{
+		qCCritical(settings) << "Cannot write history store:" << file.errorString();
+		return false;
+	}
+
+	mHistoryInfos = pHistoryInfos;
+	return true;
+}
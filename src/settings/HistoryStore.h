@@ -0,0 +1,71 @@
+/*!
+ * \brief Append-only record file of the history entries.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "HistoryInfo.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+
+class test_HistoryStore;
+
+
+namespace governikus
+{
+
+/*!
+ * The file starts with a header of magic and version that is followed by
+ * one length prefixed record per entry in the order of creation. A new entry
+ * is appended to the file, only deletions rewrite it. A record that was not
+ * completely written, e.g. on a crash, is dropped on the next load.
+ *
+ * All entries are kept in memory with the newest entry first.
+ */
+class HistoryStore
+{
+	friend class ::test_HistoryStore;
+
+	private:
+		static const quint32 MAGIC;
+		static const quint32 VERSION;
+
+		QString mFileName;
+		QVector<HistoryInfo> mHistoryInfos;
+
+		static QByteArray encode(const HistoryInfo& pHistoryInfo);
+		static bool decode(const QByteArray& pRecord, HistoryInfo& pHistoryInfo);
+		void moveAside() const;
+
+	public:
+		explicit HistoryStore(const QString& pFileName);
+
+		[[nodiscard]] const QString& getFileName() const;
+		[[nodiscard]] bool exists() const;
+
+		/*!
+		 * Reads all entries of the file. A file that is not a history store is moved
+		 * aside with the suffix ".unreadable", so the next write starts a new one.
+		 * \return false if the file does not exist or is not a history store.
+		 */
+		bool load();
+
+		[[nodiscard]] const QVector<HistoryInfo>& getHistoryInfos() const;
+
+		/*!
+		 * Adds a new entry as the newest one and appends it to the file.
+		 */
+		bool append(const HistoryInfo& pHistoryInfo);
+
+		/*!
+		 * Replaces the file with the given entries, the newest entry first.
+		 */
+		bool write(const QVector<HistoryInfo>& pHistoryInfos);
+};
+
+} // namespace governikus
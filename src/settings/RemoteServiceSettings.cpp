@@ -12,12 +12,7 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QLoggingCategory>
-
-#if (QT_VERSION >= QT_VERSION_CHECK(6, 0, 0))
-#include <QMutableListIterator>
-#else
-#include <QMutableVectorIterator>
-#endif
+#include <QMutexLocker>
 
 using namespace governikus;
 
@@ -45,6 +40,14 @@ QString RemoteServiceSettings::generateFingerprint(const QSslCertificate& pCert)
 RemoteServiceSettings::RemoteServiceSettings()
 	: AbstractSettings()
 	, mStore(getStore())
+	, mTrustMutex()
+	, mTrustedCertificates()
+	, mTrustedCertificateIndex()
+	, mRemoteInfos()
+	, mRemoteInfoIndex()
+	, mTrustedCertificatesDirty(false)
+	, mRemoteInfosDirty(false)
+	, mWritePending(false)
 {
 	mStore->beginGroup(SETTINGS_GROUP_NAME_REMOTEREADER());
 
@@ -52,20 +55,118 @@ RemoteServiceSettings::RemoteServiceSettings()
 	{
 		setServerName(QString());
 	}
+
+	const QMutexLocker locker(&mTrustMutex);
+	loadTrustStore();
 }
 
 
 RemoteServiceSettings::~RemoteServiceSettings()
 {
+	writeTrustStore();
 }
 
 
 void RemoteServiceSettings::save()
 {
+	writeTrustStore();
 	mStore->sync();
 }
 
 
+void RemoteServiceSettings::loadTrustStore()
+{
+	const int itemCount = mStore->beginReadArray(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
+	for (int i = 0; i < itemCount; ++i)
+	{
+		mStore->setArrayIndex(i);
+		const QSslCertificate cert(mStore->value(SETTINGS_NAME_TRUSTED_CERTIFICATE_ITEM(), QByteArray()).toByteArray());
+		const auto& fingerprint = generateFingerprint(cert);
+		if (!mTrustedCertificateIndex.contains(fingerprint))
+		{
+			mTrustedCertificateIndex.insert(fingerprint, cert);
+			mTrustedCertificates << cert;
+		}
+	}
+	mStore->endArray();
+
+	const auto& data = mStore->value(SETTINGS_NAME_TRUSTED_REMOTE_INFO(), QByteArray()).toByteArray();
+	const auto& array = QJsonDocument::fromJson(data).array();
+	for (const auto& item : array)
+	{
+		mRemoteInfos << RemoteInfo::fromJson(item.toObject());
+	}
+	indexRemoteInfos();
+
+	qCDebug(settings) << "Loaded" << mTrustedCertificates.size() << "trusted certificates and" << mRemoteInfos.size() << "remote infos";
+}
+
+
+void RemoteServiceSettings::indexRemoteInfos()
+{
+	mRemoteInfoIndex.clear();
+	mRemoteInfoIndex.reserve(mRemoteInfos.size());
+	for (int i = 0; i < mRemoteInfos.size(); ++i)
+	{
+		mRemoteInfoIndex.insert(mRemoteInfos.at(i).getFingerprint(), i);
+	}
+}
+
+
+void RemoteServiceSettings::scheduleWrite(bool pTrustedCertificates, bool pRemoteInfos)
+{
+	mTrustedCertificatesDirty |= pTrustedCertificates;
+	mRemoteInfosDirty |= pRemoteInfos;
+	if (mWritePending)
+	{
+		return;
+	}
+
+	// Several changes of one event loop iteration are written at once, even
+	// if they are made by another thread.
+	mWritePending = true;
+	QMetaObject::invokeMethod(this, [this] {
+			writeTrustStore();
+		}, Qt::QueuedConnection);
+}
+
+
+void RemoteServiceSettings::writeTrustStore()
+{
+	const QMutexLocker locker(&mTrustMutex);
+	mWritePending = false;
+
+	if (mTrustedCertificatesDirty)
+	{
+		mTrustedCertificatesDirty = false;
+
+		mStore->beginGroup(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
+		mStore->remove(QString());
+		mStore->endGroup();
+
+		mStore->beginWriteArray(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
+		for (int i = 0; i < mTrustedCertificates.size(); ++i)
+		{
+			mStore->setArrayIndex(i);
+			mStore->setValue(SETTINGS_NAME_TRUSTED_CERTIFICATE_ITEM(), mTrustedCertificates.at(i).toPem());
+		}
+		mStore->endArray();
+	}
+
+	if (mRemoteInfosDirty)
+	{
+		mRemoteInfosDirty = false;
+
+		QJsonArray array;
+		for (const auto& item : qAsConst(mRemoteInfos))
+		{
+			array << item.toJson();
+		}
+		mStore->setValue(SETTINGS_NAME_TRUSTED_REMOTE_INFO(), QJsonDocument(array).toJson(QJsonDocument::Compact));
+	}
+}
+
+
 QString RemoteServiceSettings::getDefaultServerName() const
 {
 	QString name = DeviceInfo::getName();
@@ -112,83 +213,82 @@ void RemoteServiceSettings::setPinPadMode(bool pPinPadMode)
 
 QList<QSslCertificate> RemoteServiceSettings::getTrustedCertificates() const
 {
-	const int itemCount = mStore->beginReadArray(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
-
-	QList<QSslCertificate> certificates;
-	certificates.reserve(itemCount);
-	for (int i = 0; i < itemCount; ++i)
-	{
-		mStore->setArrayIndex(i);
-		const auto& cert = mStore->value(SETTINGS_NAME_TRUSTED_CERTIFICATE_ITEM(), QByteArray()).toByteArray();
-		certificates << QSslCertificate(cert);
-	}
-
-	mStore->endArray();
-	return certificates;
+	const QMutexLocker locker(&mTrustMutex);
+	return mTrustedCertificates;
 }
 
 
-void RemoteServiceSettings::setUniqueTrustedCertificates(const QSet<QSslCertificate>& pCertificates)
+void RemoteServiceSettings::setTrustedCertificates(const QList<QSslCertificate>& pCertificates)
 {
-	mStore->beginGroup(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
-	mStore->remove(QString());
-	mStore->endGroup();
-
-	mStore->beginWriteArray(SETTINGS_ARRAY_NAME_TRUSTED_CERTIFICATES());
-	int i = 0;
-	for (const auto& cert : pCertificates)
 	{
-		mStore->setArrayIndex(i);
-		++i;
-		mStore->setValue(SETTINGS_NAME_TRUSTED_CERTIFICATE_ITEM(), cert.toPem());
+		const QMutexLocker locker(&mTrustMutex);
+		mTrustedCertificates.clear();
+		mTrustedCertificateIndex.clear();
+		for (const auto& cert : pCertificates)
+		{
+			const auto& fingerprint = generateFingerprint(cert);
+			if (!mTrustedCertificateIndex.contains(fingerprint))
+			{
+				mTrustedCertificateIndex.insert(fingerprint, cert);
+				mTrustedCertificates << cert;
+			}
+		}
+		syncRemoteInfos();
+		scheduleWrite(true, true);
 	}
-	mStore->endArray();
 
-	syncRemoteInfos(pCertificates);
+	Q_EMIT fireTrustedRemoteInfosChanged();
 	Q_EMIT fireTrustedCertificatesChanged();
 }
 
 
-void RemoteServiceSettings::setTrustedCertificates(const QList<QSslCertificate>& pCertificates)
+void RemoteServiceSettings::addTrustedCertificate(const QSslCertificate& pCertificate)
 {
-	// remove duplicates
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 14, 0))
-	const auto set = QSet<QSslCertificate>(pCertificates.constBegin(), pCertificates.constEnd());
-#else
-	const auto set = pCertificates.toSet();
-#endif
-
-	setUniqueTrustedCertificates(set);
-}
+	{
+		const QMutexLocker locker(&mTrustMutex);
+		const auto& fingerprint = generateFingerprint(pCertificate);
+		if (mTrustedCertificateIndex.contains(fingerprint))
+		{
+			return;
+		}
 
+		mTrustedCertificateIndex.insert(fingerprint, pCertificate);
+		mTrustedCertificates << pCertificate;
+		if (!mRemoteInfoIndex.contains(fingerprint))
+		{
+			mRemoteInfoIndex.insert(fingerprint, mRemoteInfos.size());
+			mRemoteInfos << RemoteInfo(fingerprint, QDateTime::currentDateTime());
+		}
+		scheduleWrite(true, true);
+	}
 
-void RemoteServiceSettings::addTrustedCertificate(const QSslCertificate& pCertificate)
-{
-	auto certs = getTrustedCertificates();
-	certs << pCertificate;
-	setTrustedCertificates(certs);
+	Q_EMIT fireTrustedRemoteInfosChanged();
+	Q_EMIT fireTrustedCertificatesChanged();
 }
 
 
 void RemoteServiceSettings::removeTrustedCertificate(const QSslCertificate& pCertificate)
 {
-	auto certs = getTrustedCertificates();
-	certs.removeAll(pCertificate);
-	setTrustedCertificates(certs);
+	removeTrustedCertificate(generateFingerprint(pCertificate));
 }
 
 
 void RemoteServiceSettings::removeTrustedCertificate(const QString& pFingerprint)
 {
-	const auto& certs = getTrustedCertificates();
-	for (const auto& cert : certs)
 	{
-		if (generateFingerprint(cert) == pFingerprint)
+		const QMutexLocker locker(&mTrustMutex);
+		if (!mTrustedCertificateIndex.contains(pFingerprint))
 		{
-			removeTrustedCertificate(cert);
 			return;
 		}
+
+		mTrustedCertificates.removeOne(mTrustedCertificateIndex.take(pFingerprint));
+		syncRemoteInfos();
+		scheduleWrite(true, true);
 	}
+
+	Q_EMIT fireTrustedRemoteInfosChanged();
+	Q_EMIT fireTrustedCertificatesChanged();
 }
 
 
@@ -253,75 +353,59 @@ RemoteServiceSettings::RemoteInfo RemoteServiceSettings::getRemoteInfo(const QSs
 
 RemoteServiceSettings::RemoteInfo RemoteServiceSettings::getRemoteInfo(const QString& pFingerprint) const
 {
-	const auto& infos = getRemoteInfos();
-	for (const auto& item : infos)
-	{
-		if (item.getFingerprint() == pFingerprint)
-		{
-			return item;
-		}
-	}
-
-	return RemoteInfo();
+	const QMutexLocker locker(&mTrustMutex);
+	const int index = mRemoteInfoIndex.value(pFingerprint, -1);
+	return index < 0 ? RemoteInfo() : mRemoteInfos.at(index);
 }
 
 
 QVector<RemoteServiceSettings::RemoteInfo> RemoteServiceSettings::getRemoteInfos() const
 {
-	QVector<RemoteInfo> infos;
-
-	const auto& data = mStore->value(SETTINGS_NAME_TRUSTED_REMOTE_INFO(), QByteArray()).toByteArray();
-	const auto& array = QJsonDocument::fromJson(data).array();
-	for (const auto& item : array)
-	{
-		infos << RemoteInfo::fromJson(item.toObject());
-	}
-
-	return infos;
+	const QMutexLocker locker(&mTrustMutex);
+	return mRemoteInfos;
 }
 
 
 void RemoteServiceSettings::setRemoteInfos(const QVector<RemoteInfo>& pInfos)
 {
-	QJsonArray array;
-	for (const auto& item : pInfos)
 	{
-		array << item.toJson();
+		const QMutexLocker locker(&mTrustMutex);
+		mRemoteInfos = pInfos;
+		indexRemoteInfos();
+		scheduleWrite(false, true);
 	}
 
-	mStore->setValue(SETTINGS_NAME_TRUSTED_REMOTE_INFO(), QJsonDocument(array).toJson(QJsonDocument::Compact));
 	Q_EMIT fireTrustedRemoteInfosChanged();
 }
 
 
-void RemoteServiceSettings::syncRemoteInfos(const QSet<QSslCertificate>& pCertificates)
+void RemoteServiceSettings::syncRemoteInfos()
 {
-	QStringList trustedFingerprints;
-	for (const auto& cert : pCertificates)
-	{
-		trustedFingerprints << generateFingerprint(cert);
-	}
-
-	QVector<RemoteInfo> syncedInfo;
+	QVector<RemoteInfo> syncedInfos;
+	syncedInfos.reserve(mTrustedCertificates.size());
 
 	// remove outdated entries
-	const auto& infos = getRemoteInfos();
-	for (const auto& info : infos)
+	QHash<QString, QSslCertificate> newCertificates = mTrustedCertificateIndex;
+	for (const auto& info : qAsConst(mRemoteInfos))
 	{
-		if (trustedFingerprints.contains(info.getFingerprint()))
+		if (newCertificates.remove(info.getFingerprint()) > 0)
 		{
-			trustedFingerprints.removeOne(info.getFingerprint());
-			syncedInfo << info;
+			syncedInfos << info;
 		}
 	}
 
 	// add new entries
-	for (const auto& fingerprint : qAsConst(trustedFingerprints))
+	for (const auto& cert : qAsConst(mTrustedCertificates))
 	{
-		syncedInfo << RemoteInfo(fingerprint, QDateTime::currentDateTime());
+		const auto& fingerprint = generateFingerprint(cert);
+		if (newCertificates.contains(fingerprint))
+		{
+			syncedInfos << RemoteInfo(fingerprint, QDateTime::currentDateTime());
+		}
 	}
 
-	setRemoteInfos(syncedInfo);
+	mRemoteInfos = syncedInfos;
+	indexRemoteInfos();
 }
 
 
@@ -332,20 +416,20 @@ bool RemoteServiceSettings::updateRemoteInfo(const RemoteInfo& pInfo)
 		return false;
 	}
 
-	auto infos = getRemoteInfos();
-	QMutableVectorIterator<RemoteServiceSettings::RemoteInfo> iter(infos);
-	while (iter.hasNext())
 	{
-		iter.next();
-		if (iter.value().getFingerprint() == pInfo.getFingerprint())
+		const QMutexLocker locker(&mTrustMutex);
+		const int index = mRemoteInfoIndex.value(pInfo.getFingerprint(), -1);
+		if (index < 0)
 		{
-			iter.setValue(pInfo);
-			setRemoteInfos(infos);
-			return true;
+			return false;
 		}
+
+		mRemoteInfos[index] = pInfo;
+		scheduleWrite(false, true);
 	}
 
-	return false;
+	Q_EMIT fireTrustedRemoteInfosChanged();
+	return true;
 }
 
 
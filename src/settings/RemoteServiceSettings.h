@@ -9,8 +9,9 @@
 #include "AbstractSettings.h"
 
 #include <QDateTime>
+#include <QHash>
 #include <QList>
-#include <QSet>
+#include <QMutex>
 #include <QSslCertificate>
 #include <QSslKey>
 #include <QString>
@@ -70,13 +71,33 @@ class RemoteServiceSettings
 	private:
 		QSharedPointer<QSettings> mStore;
 
+		/*!
+		 * The trusted certificates and their remote infos are parsed once and indexed
+		 * by fingerprint. Changes are written to the store on the next event loop
+		 * iteration, on save() or on destruction.
+		 */
+		mutable QMutex mTrustMutex;
+		QList<QSslCertificate> mTrustedCertificates;
+		QHash<QString, QSslCertificate> mTrustedCertificateIndex;
+		QVector<RemoteInfo> mRemoteInfos;
+		QHash<QString, int> mRemoteInfoIndex;
+		bool mTrustedCertificatesDirty;
+		bool mRemoteInfosDirty;
+		bool mWritePending;
+
 		RemoteServiceSettings();
 		[[nodiscard]] QString getDefaultServerName() const;
 		void setTrustedCertificates(const QList<QSslCertificate>& pCertificates);
-		void setUniqueTrustedCertificates(const QSet<QSslCertificate>& pCertificates);
 
 		void setRemoteInfos(const QVector<RemoteInfo>& pInfos);
-		void syncRemoteInfos(const QSet<QSslCertificate>& pCertificates);
+
+		// Require a locked mTrustMutex
+		void loadTrustStore();
+		void indexRemoteInfos();
+		void syncRemoteInfos();
+		void scheduleWrite(bool pTrustedCertificates, bool pRemoteInfos);
+
+		void writeTrustStore();
 
 	public:
 		static QString generateFingerprint(const QSslCertificate& pCert);
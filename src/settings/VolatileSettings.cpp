@@ -51,6 +51,7 @@ VolatileSettings::VolatileSettings()
 	: mUsedAsSdk(true)
 	, mDeveloperMode(false)
 	, mHandleInterrupt(cHandleInterruptDefault)
+	, mMaxSessions(cMaxSessionsDefault)
 	, mMessages()
 {
 }
@@ -92,6 +93,18 @@ void VolatileSettings::setHandleInterrupt(bool pScan)
 }
 
 
+int VolatileSettings::getMaxSessions() const
+{
+	return mMaxSessions;
+}
+
+
+void VolatileSettings::setMaxSessions(int pMaxSessions)
+{
+	mMaxSessions = pMaxSessions;
+}
+
+
 void VolatileSettings::setMessages(const VolatileSettings::Messages& pMessages)
 {
 	mMessages = pMessages;
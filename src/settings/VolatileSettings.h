@@ -55,10 +55,12 @@ class VolatileSettings
 
 	private:
 		static constexpr bool cHandleInterruptDefault = true;
+		static constexpr int cMaxSessionsDefault = 1;
 
 		bool mUsedAsSdk;
 		bool mDeveloperMode;
 		bool mHandleInterrupt;
+		int mMaxSessions;
 		Messages mMessages;
 
 	protected:
@@ -76,6 +78,9 @@ class VolatileSettings
 		[[nodiscard]] bool handleInterrupt() const;
 		void setHandleInterrupt(bool pScan = cHandleInterruptDefault);
 
+		[[nodiscard]] int getMaxSessions() const;
+		void setMaxSessions(int pMaxSessions = cMaxSessionsDefault);
+
 		void setMessages(const Messages& pMessages = Messages());
 		[[nodiscard]] const Messages& getMessages() const;
 };
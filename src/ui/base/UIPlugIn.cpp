@@ -16,6 +16,20 @@ UIPlugIn::~UIPlugIn()
 }
 
 
+void UIPlugIn::onSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext)
+{
+	Q_UNUSED(pId)
+	Q_UNUSED(pContext)
+}
+
+
+void UIPlugIn::onSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext)
+{
+	Q_UNUSED(pId)
+	Q_UNUSED(pContext)
+}
+
+
 void UIPlugIn::onApplicationInitialized()
 {
 }
@@ -52,6 +52,8 @@ class UIPlugIn
 		virtual void doShutdown() = 0;
 		virtual void onWorkflowStarted(QSharedPointer<WorkflowContext> pContext) = 0;
 		virtual void onWorkflowFinished(QSharedPointer<WorkflowContext> pContext) = 0;
+		virtual void onSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext);
+		virtual void onSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext);
 		virtual void onApplicationInitialized();
 		virtual void onApplicationStarted();
 		virtual void onShowUi(UiModule pModule);
@@ -168,9 +168,14 @@ Msg MessageDispatcher::processCommand(const QByteArray& pMsg)
 		return MsgHandlerInvalid(jsonError);
 	}
 
-	const auto& obj = json.object();
-	auto msg = createForCommand(obj);
-	msg.setRequest(obj);
+	return processCommand(json.object());
+}
+
+
+Msg MessageDispatcher::processCommand(const QJsonObject& pObj)
+{
+	auto msg = createForCommand(pObj);
+	msg.setRequest(pObj);
 	return msg;
 }
 
@@ -212,7 +217,7 @@ MsgHandler MessageDispatcher::createForCommand(const QJsonObject& pObj)
 			return MsgHandlerReaderList();
 
 		case MsgCmdType::GET_LOG:
-			return HANDLE_INTERNAL_ONLY(MsgHandlerLog());
+			return HANDLE_INTERNAL_ONLY(MsgHandlerLog(pObj));
 
 		case MsgCmdType::GET_INFO:
 			return MsgHandlerInfo();
@@ -46,6 +46,7 @@ class MessageDispatcher
 		QByteArray finish();
 		void reset();
 		Msg processCommand(const QByteArray& pMsg);
+		Msg processCommand(const QJsonObject& pObj);
 		QByteArray processStateChange(const QString& pState);
 
 		[[nodiscard]] QByteArrayList processReaderChange(const ReaderInfo& pInfo);
@@ -6,9 +6,12 @@
 
 #include "context/AuthContext.h"
 #include "context/ChangePinContext.h"
+#include "messages/MsgHandlerInvalid.h"
 #include "messages/MsgTypes.h"
 #include "ReaderManager.h"
 
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QLoggingCategory>
 #include <QMetaMethod>
 
@@ -19,6 +22,7 @@ using namespace governikus;
 UIPlugInJson::UIPlugInJson()
 	: UIPlugIn()
 	, mMessageDispatcher()
+	, mSessionDispatchers()
 	, mEnabled(false)
 {
 }
@@ -67,6 +71,42 @@ void UIPlugInJson::callFireMessage(const QByteArray& pMsg, bool pLogging)
 }
 
 
+void UIPlugInJson::callFireSessionMessage(quint64 pId, const QByteArray& pMsg, bool pLogging)
+{
+	if (pMsg.isEmpty())
+	{
+		return;
+	}
+
+	// Every message of a session carries its id so that the client can tell the sessions apart.
+	auto obj = QJsonDocument::fromJson(pMsg).object();
+	obj[QLatin1String("session")] = QString::number(pId);
+	callFireMessage(QJsonDocument(obj).toJson(QJsonDocument::Compact), pLogging);
+}
+
+
+void UIPlugInJson::processSessionMessage(const QJsonValue& pSession, const QJsonObject& pObj)
+{
+	if (!pSession.isString())
+	{
+		callFireMessage(MsgHandlerInvalid(QLatin1String("Session must be a string")).getOutput());
+		return;
+	}
+
+	bool ok = false;
+	const quint64 id = pSession.toString().toULongLong(&ok);
+	const auto& dispatcher = mSessionDispatchers.value(id);
+	if (!ok || dispatcher.isNull())
+	{
+		callFireMessage(MsgHandlerInvalid(QLatin1String("Unknown session")).getOutput());
+		return;
+	}
+
+	const auto& msg = dispatcher->processCommand(pObj);
+	callFireSessionMessage(id, msg, msg != MsgType::LOG);
+}
+
+
 void UIPlugInJson::onWorkflowStarted(QSharedPointer<WorkflowContext> pContext)
 {
 	if (!mEnabled)
@@ -95,6 +135,34 @@ void UIPlugInJson::onWorkflowFinished(QSharedPointer<WorkflowContext>)
 }
 
 
+void UIPlugInJson::onSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext)
+{
+	if (!mEnabled || !(pContext.objectCast<AuthContext>() || pContext.objectCast<ChangePinContext>()))
+	{
+		return;
+	}
+
+	const auto dispatcher = QSharedPointer<MessageDispatcher>::create();
+	mSessionDispatchers.insert(pId, dispatcher);
+	connect(pContext.data(), &WorkflowContext::fireStateChanged, this, [this, pId, dispatcher](const QString& pNewState) {
+			callFireSessionMessage(pId, dispatcher->processStateChange(pNewState));
+		});
+
+	callFireSessionMessage(pId, dispatcher->init(pContext));
+}
+
+
+void UIPlugInJson::onSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext)
+{
+	const auto dispatcher = mSessionDispatchers.take(pId);
+	if (dispatcher)
+	{
+		disconnect(pContext.data(), &WorkflowContext::fireStateChanged, this, nullptr);
+		callFireSessionMessage(pId, dispatcher->finish());
+	}
+}
+
+
 void UIPlugInJson::onReaderEvent(const ReaderInfo& pInfo)
 {
 	const auto& messages = mMessageDispatcher.processReaderChange(pInfo);
@@ -118,7 +186,23 @@ void UIPlugInJson::doMessageProcessing(const QByteArray& pMsg)
 		return;
 	}
 
-	const auto& msg = mMessageDispatcher.processCommand(pMsg);
+	QJsonParseError jsonError {};
+	const auto& json = QJsonDocument::fromJson(pMsg, &jsonError);
+	if (jsonError.error != QJsonParseError::NoError)
+	{
+		callFireMessage(MsgHandlerInvalid(jsonError).getOutput());
+		return;
+	}
+
+	const auto& obj = json.object();
+	const auto& session = obj.value(QLatin1String("session"));
+	if (!session.isUndefined())
+	{
+		processSessionMessage(session, obj);
+		return;
+	}
+
+	const auto& msg = mMessageDispatcher.processCommand(obj);
 	callFireMessage(msg, msg != MsgType::LOG);
 }
 
@@ -10,6 +10,11 @@
 #include "MessageDispatcher.h"
 #include "UIPlugIn.h"
 
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QMap>
+#include <QSharedPointer>
+
 namespace governikus
 {
 
@@ -22,9 +27,12 @@ class UIPlugInJson
 
 	private:
 		MessageDispatcher mMessageDispatcher;
+		QMap<quint64, QSharedPointer<MessageDispatcher> > mSessionDispatchers;
 		bool mEnabled;
 
 		inline void callFireMessage(const QByteArray& pMsg, bool pLogging = true);
+		void callFireSessionMessage(quint64 pId, const QByteArray& pMsg, bool pLogging = true);
+		void processSessionMessage(const QJsonValue& pSession, const QJsonObject& pObj);
 
 	public:
 		UIPlugInJson();
@@ -37,6 +45,8 @@ class UIPlugInJson
 		void doShutdown() override;
 		void onWorkflowStarted(QSharedPointer<WorkflowContext> pContext) override;
 		void onWorkflowFinished(QSharedPointer<WorkflowContext> pContext) override;
+		void onSessionStarted(quint64 pId, QSharedPointer<WorkflowContext> pContext) override;
+		void onSessionFinished(quint64 pId, QSharedPointer<WorkflowContext> pContext) override;
 		void onReaderEvent(const ReaderInfo& pInfo);
 		void onStateChanged(const QString& pNewState);
 
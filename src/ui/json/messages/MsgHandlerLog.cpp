@@ -9,9 +9,51 @@
 
 using namespace governikus;
 
-MsgHandlerLog::MsgHandlerLog()
+
+const int MsgHandlerLog::MAX_PAGE_SIZE = 1000;
+
+
+MsgHandlerLog::MsgHandlerLog(const QJsonObject& pObj)
 	: MsgHandler(MsgType::LOG)
 {
-	const auto& data = Env::getSingleton<LogHandler>()->getBacklog();
-	mJsonObject[QLatin1String("data")] = QString::fromUtf8(data);
+	const auto& jsonOffset = pObj[QLatin1String("offset")];
+	const auto& jsonCount = pObj[QLatin1String("count")];
+
+	if (jsonOffset.isUndefined() && jsonCount.isUndefined())
+	{
+		const auto& data = Env::getSingleton<LogHandler>()->getBacklog();
+		mJsonObject[QLatin1String("data")] = QString::fromUtf8(data);
+	}
+	else if (!jsonOffset.isUndefined() && (!jsonOffset.isDouble() || jsonOffset.toInt(-1) < 0))
+	{
+		setError(QLatin1String("Invalid offset"));
+	}
+	else if (!jsonCount.isUndefined() && (!jsonCount.isDouble() || jsonCount.toInt(-1) <= 0))
+	{
+		setError(QLatin1String("Invalid count"));
+	}
+	else
+	{
+		setPage(jsonOffset.toInt(), qMin(jsonCount.toInt(MAX_PAGE_SIZE), MAX_PAGE_SIZE));
+	}
+}
+
+
+void MsgHandlerLog::setError(const QLatin1String pError)
+{
+	mJsonObject[QLatin1String("error")] = pError;
+}
+
+
+void MsgHandlerLog::setPage(int pOffset, int pCount)
+{
+	const auto logHandler = Env::getSingleton<LogHandler>();
+	const int total = logHandler->getLineCount();
+	const int count = qBound(0, total - pOffset, pCount);
+
+	mJsonObject[QLatin1String("offset")] = pOffset;
+	mJsonObject[QLatin1String("count")] = count;
+	mJsonObject[QLatin1String("total")] = total;
+	mJsonObject[QLatin1String("more")] = pOffset + count < total;
+	mJsonObject[QLatin1String("data")] = QString::fromUtf8(logHandler->getLines(pOffset, count));
 }
@@ -14,8 +14,19 @@ namespace governikus
 class MsgHandlerLog
 	: public MsgHandler
 {
+	private:
+		void setError(const QLatin1String pError);
+		void setPage(int pOffset, int pCount);
+
 	public:
-		MsgHandlerLog();
+		static const int MAX_PAGE_SIZE;
+
+		/*!
+		 * Returns the whole backlog if neither "offset" nor "count" is requested.
+		 * Otherwise only the lines of the requested page are returned, at most
+		 * MAX_PAGE_SIZE lines.
+		 */
+		explicit MsgHandlerLog(const QJsonObject& pObj = QJsonObject());
 };
 
 
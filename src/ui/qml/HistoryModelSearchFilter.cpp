@@ -4,6 +4,8 @@
 
 #include "HistoryModelSearchFilter.h"
 
+#include "AppSettings.h"
+#include "Env.h"
 #include "HistoryModel.h"
 
 #include <QDebug>
@@ -11,6 +13,46 @@
 using namespace governikus;
 
 
+HistoryModelSearchFilter::HistoryModelSearchFilter()
+	: QSortFilterProxyModel()
+	, mFilterString()
+	, mSearchIndex()
+	, mSourceConnections()
+{
+	const GeneralSettings& generalSettings = Env::getSingleton<AppSettings>()->getGeneralSettings();
+	connect(&generalSettings, &GeneralSettings::fireLanguageChanged, this, &HistoryModelSearchFilter::onTranslationChanged);
+}
+
+
+void HistoryModelSearchFilter::buildSearchIndex() const
+{
+	const QAbstractItemModel* const dataSourceModel = sourceModel();
+	const int rowCount = dataSourceModel->rowCount();
+
+	mSearchIndex.clear();
+	mSearchIndex.reserve(rowCount);
+	for (int row = 0; row < rowCount; ++row)
+	{
+		const QModelIndex& modelIndex = dataSourceModel->index(row, 0);
+		const QStringList fields({
+				dataSourceModel->data(modelIndex, HistoryModel::DATETIME).toDateTime().toString(tr("dd.MM.yyyy")),
+				dataSourceModel->data(modelIndex, HistoryModel::SUBJECT).toString(),
+				dataSourceModel->data(modelIndex, HistoryModel::PURPOSE).toString(),
+				dataSourceModel->data(modelIndex, HistoryModel::REQUESTEDDATA).toString()
+			});
+
+		// The separator prevents matches across two fields.
+		mSearchIndex += fields.join(QLatin1Char('\n')).toCaseFolded();
+	}
+}
+
+
+void HistoryModelSearchFilter::clearSearchIndex()
+{
+	mSearchIndex.clear();
+}
+
+
 bool HistoryModelSearchFilter::filterAcceptsRow(int pSourceRow, const QModelIndex&) const
 {
 	if (mFilterString.isEmpty())
@@ -18,27 +60,53 @@ bool HistoryModelSearchFilter::filterAcceptsRow(int pSourceRow, const QModelInde
 		return true;
 	}
 
-	const HistoryModel* const dataSourceModel = qobject_cast<HistoryModel*>(sourceModel());
-	if (dataSourceModel == nullptr)
+	if (qobject_cast<HistoryModel*>(sourceModel()) == nullptr)
 	{
 		return false;
 	}
 
-	const QModelIndex& modelIndex = dataSourceModel->index(pSourceRow, 0);
-	if (dataSourceModel->data(modelIndex, HistoryModel::DATETIME).toDateTime().toString(tr("dd.MM.yyyy")).contains(mFilterString, Qt::CaseInsensitive)
-			|| dataSourceModel->data(modelIndex, HistoryModel::SUBJECT).toString().contains(mFilterString, Qt::CaseInsensitive)
-			|| dataSourceModel->data(modelIndex, HistoryModel::PURPOSE).toString().contains(mFilterString, Qt::CaseInsensitive)
-			|| dataSourceModel->data(modelIndex, HistoryModel::REQUESTEDDATA).toString().contains(mFilterString, Qt::CaseInsensitive))
+	if (mSearchIndex.size() != sourceModel()->rowCount())
 	{
-		return true;
+		buildSearchIndex();
 	}
 
-	return false;
+	return mSearchIndex.at(pSourceRow).contains(mFilterString);
+}
+
+
+void HistoryModelSearchFilter::setSourceModel(QAbstractItemModel* pSourceModel)
+{
+	for (const auto& connection : qAsConst(mSourceConnections))
+	{
+		disconnect(connection);
+	}
+	mSourceConnections.clear();
+
+	clearSearchIndex();
+
+	// Connect before the proxy does, so the index is dropped before the rows are filtered again.
+	if (pSourceModel)
+	{
+		mSourceConnections += connect(pSourceModel, &QAbstractItemModel::modelReset, this, &HistoryModelSearchFilter::clearSearchIndex);
+		mSourceConnections += connect(pSourceModel, &QAbstractItemModel::rowsInserted, this, &HistoryModelSearchFilter::clearSearchIndex);
+		mSourceConnections += connect(pSourceModel, &QAbstractItemModel::rowsRemoved, this, &HistoryModelSearchFilter::clearSearchIndex);
+		mSourceConnections += connect(pSourceModel, &QAbstractItemModel::dataChanged, this, &HistoryModelSearchFilter::clearSearchIndex);
+	}
+
+	QSortFilterProxyModel::setSourceModel(pSourceModel);
 }
 
 
 void governikus::HistoryModelSearchFilter::setFilterString(const QString& pFilterString)
 {
-	mFilterString = pFilterString;
+	mFilterString = pFilterString.toCaseFolded();
+	invalidateFilter();
+}
+
+
+void HistoryModelSearchFilter::onTranslationChanged()
+{
+	// The date format of the index is translated.
+	clearSearchIndex();
 	invalidateFilter();
 }
@@ -9,6 +9,9 @@
 #include <QAbstractListModel>
 #include <QPointer>
 #include <QSortFilterProxyModel>
+#include <QVector>
+
+class test_HistoryModel;
 
 namespace governikus
 {
@@ -17,15 +20,33 @@ class HistoryModelSearchFilter
 	: public QSortFilterProxyModel
 {
 	Q_OBJECT
+	friend class ::test_HistoryModel;
 
 	private:
 		QString mFilterString;
 
+		/*!
+		 * The case folded searchable text of every row of the source model. It is
+		 * built on the first search and dropped if the source model or the
+		 * language changes.
+		 */
+		mutable QVector<QString> mSearchIndex;
+		QVector<QMetaObject::Connection> mSourceConnections;
+
+		void buildSearchIndex() const;
+		void clearSearchIndex();
+
 	protected:
 		bool filterAcceptsRow(int pSourceRow, const QModelIndex&) const override;
 
 	public:
+		HistoryModelSearchFilter();
+
+		void setSourceModel(QAbstractItemModel* pSourceModel) override;
 		Q_INVOKABLE void setFilterString(const QString& pFilterString);
+
+	public Q_SLOTS:
+		void onTranslationChanged();
 };
 
 } // namespace governikus
@@ -19,11 +19,17 @@
 using namespace governikus;
 
 
+const int LogModel::FETCH_SIZE = 500;
+
+
 LogModel::LogModel()
 	: QAbstractListModel()
 	, mLogFiles()
 	, mSelectedLogFile(-1)
 	, mLogEntries()
+	, mLineCount(0)
+	, mFetchedLines(0)
+	, mOtherLogFile()
 {
 	reset();
 	connect(Env::getSingleton<SettingsModel>(), &SettingsModel::fireLanguageChanged, this, &LogModel::fireLogFilesChanged); // needed to translate the "Current log" entry on language change
@@ -59,17 +65,40 @@ void LogModel::setLogEntries(QTextStream& pTextStream)
 	{
 		addLogEntry(pTextStream.readLine());
 	}
+	mLineCount = mLogEntries.size();
+	mFetchedLines = mLineCount;
 
 	endResetModel();
 }
 
 
-void LogModel::onNewLogMsg(const QString& pMsg)
+QByteArray LogModel::readLines(int pOffset, int pCount) const
 {
 	if (mSelectedLogFile == 0)
+	{
+		return Env::getSingleton<LogHandler>()->getLines(pOffset, pCount);
+	}
+
+	return mOtherLogFile ? mOtherLogFile->getLines(pOffset, pCount) : QByteArray();
+}
+
+
+void LogModel::onNewLogMsg(const QString& pMsg)
+{
+	if (mSelectedLogFile != 0)
+	{
+		return;
+	}
+
+	// This slot may be called inside the message handler, so the LogHandler must not be asked.
+	const bool allFetched = mFetchedLines >= mLineCount;
+	mLineCount += qMax(1, static_cast<int>(pMsg.count(QLatin1Char('\n'))));
+
+	if (allFetched)
 	{
 		const int oldSize = mLogEntries.size();
 		addLogEntry(pMsg);
+		mFetchedLines = mLineCount;
 		beginInsertRows(QModelIndex(), oldSize, mLogEntries.size() - 1);
 		endInsertRows();
 		Q_EMIT fireNewLogMsg();
@@ -107,6 +136,7 @@ QDateTime LogModel::getCurrentLogFileDate() const
 
 void LogModel::removeOtherLogFiles()
 {
+	mOtherLogFile.reset();
 	if (Env::getSingleton<LogHandler>()->removeOtherLogFiles())
 	{
 		reset();
@@ -122,6 +152,8 @@ void LogModel::removeCurrentLogFile()
 		return;
 	}
 
+	// A mapped file cannot be removed on every platform.
+	mOtherLogFile.reset();
 	if (!QFile::remove(mLogFiles[mSelectedLogFile]))
 	{
 		qDebug() << mLogFiles[mSelectedLogFile] << "could not be removed";
@@ -151,28 +183,32 @@ void LogModel::setLogFile(int pIndex)
 
 	if (pIndex == 0)
 	{
-		QTextStream in(logHandler->useLogFile() ? logHandler->getBacklog() : tr("The logfile is disabled.").toUtf8());
-#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-		in.setCodec("UTF-8");
-#endif
-
-		setLogEntries(in);
+		mOtherLogFile.reset();
 		connect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
-	}
-	else
-	{
-		disconnect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
-		QFile inputFile(mLogFiles[pIndex]);
-		if (inputFile.open(QIODevice::ReadOnly))
+
+		if (!logHandler->useLogFile())
 		{
-			QTextStream in(&inputFile);
+			QTextStream in(tr("The logfile is disabled.").toUtf8());
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 			in.setCodec("UTF-8");
 #endif
 			setLogEntries(in);
-			inputFile.close();
+			return;
 		}
 	}
+	else
+	{
+		disconnect(logHandler->getEventHandler(), &LogEventHandler::fireLog, this, &LogModel::onNewLogMsg);
+		mOtherLogFile.reset(new MappedLogFile(mLogFiles[pIndex]));
+	}
+
+	beginResetModel();
+	mLogEntries.clear();
+	mLineCount = pIndex == 0 ? logHandler->getLineCount() : mOtherLogFile->getLineCount();
+	mFetchedLines = 0;
+	endResetModel();
+
+	fetchMore(QModelIndex());
 }
 
 
@@ -216,6 +252,48 @@ int LogModel::rowCount(const QModelIndex& pIndex) const
 }
 
 
+bool LogModel::canFetchMore(const QModelIndex& pParent) const
+{
+	return !pParent.isValid() && mFetchedLines < mLineCount;
+}
+
+
+void LogModel::fetchMore(const QModelIndex& pParent)
+{
+	if (pParent.isValid())
+	{
+		return;
+	}
+
+	if (mSelectedLogFile == 0)
+	{
+		mLineCount = Env::getSingleton<LogHandler>()->getLineCount();
+	}
+
+	QTextStream in(readLines(mFetchedLines, FETCH_SIZE));
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+	in.setCodec("UTF-8");
+#endif
+
+	QStringList entries;
+	while (!in.atEnd())
+	{
+		entries += in.readLine();
+	}
+
+	if (entries.isEmpty())
+	{
+		mFetchedLines = mLineCount;
+		return;
+	}
+
+	beginInsertRows(QModelIndex(), mLogEntries.size(), mLogEntries.size() + entries.size() - 1);
+	mLogEntries += entries;
+	mFetchedLines += entries.size();
+	endInsertRows();
+}
+
+
 QHash<int, QByteArray> LogModel::roleNames() const
 {
 	QHash<int, QByteArray> roles;
@@ -5,11 +5,13 @@
 #pragma once
 
 #include "Env.h"
+#include "MappedLogFile.h"
 
 #include <QAbstractListModel>
 #include <QDateTime>
 #include <QObject>
 #include <QPoint>
+#include <QScopedPointer>
 #include <QString>
 #include <QStringList>
 #include <QTextStream>
@@ -39,6 +41,9 @@ class LogModel
 		QStringList mLogFiles;
 		int mSelectedLogFile;
 		QStringList mLogEntries;
+		int mLineCount;
+		int mFetchedLines;
+		QScopedPointer<MappedLogFile> mOtherLogFile;
 
 		LogModel();
 		~LogModel() override = default;
@@ -46,11 +51,14 @@ class LogModel
 		void reset();
 		void addLogEntry(const QString& pEntry);
 		void setLogEntries(QTextStream& pTextStream);
+		[[nodiscard]] QByteArray readLines(int pOffset, int pCount) const;
 
 	private Q_SLOTS:
 		void onNewLogMsg(const QString& pMsg);
 
 	public:
+		static const int FETCH_SIZE;
+
 		QStringList getLogFiles() const;
 		Q_INVOKABLE QDateTime getCurrentLogFileDate() const;
 		Q_INVOKABLE void removeOtherLogFiles();
@@ -69,6 +77,8 @@ class LogModel
 		Q_INVOKABLE void shareLog(QPoint popupPosition);
 
 		int rowCount(const QModelIndex& pIndex = QModelIndex()) const override;
+		bool canFetchMore(const QModelIndex& pParent) const override;
+		void fetchMore(const QModelIndex& pParent) override;
 		QHash<int, QByteArray> roleNames() const override;
 		QVariant data(const QModelIndex& pIndex, int pRole = Qt::DisplayRole) const override;
 		Q_INVOKABLE static QString createLogFileName(const QDateTime& pDateTime = QDateTime::currentDateTime());
@@ -125,16 +125,16 @@ QByteArray AuthContext::encodeEffectiveChat()
 }
 
 
-CVCertificateChain AuthContext::getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot) const
+CVCertificateChain AuthContext::getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot, const QVector<QSharedPointer<const CVCertificate> >& pTrustAnchors) const
 {
-	const auto& productionChain = mCvcChainBuilderProd.getChainStartingWith(pChainRoot);
+	const auto& productionChain = mCvcChainBuilderProd.getChainStartingWith(pChainRoot, pTrustAnchors);
 	if (productionChain.isValid())
 	{
 		qDebug() << "Found chain within productive PKI.";
 		return productionChain;
 	}
 
-	const auto& testChain = mCvcChainBuilderTest.getChainStartingWith(pChainRoot);
+	const auto& testChain = mCvcChainBuilderTest.getChainStartingWith(pChainRoot, pTrustAnchors);
 	if (testChain.isValid())
 	{
 		qDebug() << "Found chain within test PKI.";
@@ -173,6 +173,6 @@ void AuthContext::initCvcChainBuilder(const QVector<QSharedPointer<const CVCerti
 	cvcs += pAdditionalCertificates;
 
 	const auto* secureStorage = Env::getSingleton<SecureStorage>();
-	mCvcChainBuilderProd = CVCertificateChainBuilder(cvcs + CVCertificate::fromHex(secureStorage->getCVRootCertificates(true)), true);
-	mCvcChainBuilderTest = CVCertificateChainBuilder(cvcs + CVCertificate::fromHex(secureStorage->getCVRootCertificates(false)), false);
+	mCvcChainBuilderProd = CVCertificateChainBuilder(cvcs + CVCertificate::fromHex(secureStorage->getCVRootCertificates(true), true), true);
+	mCvcChainBuilderTest = CVCertificateChainBuilder(cvcs + CVCertificate::fromHex(secureStorage->getCVRootCertificates(false), true), false);
 }
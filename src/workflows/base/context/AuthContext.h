@@ -437,7 +437,8 @@ class AuthContext
 		}
 
 
-		[[nodiscard]] CVCertificateChain getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot) const;
+		[[nodiscard]] CVCertificateChain getChainStartingWith(const QSharedPointer<const CVCertificate>& pChainRoot,
+				const QVector<QSharedPointer<const CVCertificate>>& pTrustAnchors = QVector<QSharedPointer<const CVCertificate>>()) const;
 
 
 		[[nodiscard]] bool hasChainForCertificationAuthority(const EstablishPaceChannelOutput& pPaceOutput) const;
@@ -24,6 +24,7 @@ WorkflowContext::WorkflowContext()
 	, mCurrentState(QStringLiteral("Initial"))
 	, mReaderPlugInTypes()
 	, mReaderName()
+	, mBoundReaderName()
 	, mCardConnection()
 	, mCardVanishedDuringPacePinCount(0)
 	, mCardVanishedDuringPacePinTimer()
@@ -171,6 +172,18 @@ void WorkflowContext::setReaderName(const QString& pReaderName)
 }
 
 
+const QString& WorkflowContext::getBoundReaderName() const
+{
+	return mBoundReaderName;
+}
+
+
+void WorkflowContext::setBoundReaderName(const QString& pReaderName)
+{
+	mBoundReaderName = pReaderName;
+}
+
+
 const QSharedPointer<CardConnection>& WorkflowContext::getCardConnection() const
 {
 	return mCardConnection;
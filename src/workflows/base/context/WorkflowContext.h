@@ -30,6 +30,7 @@ class WorkflowContext
 		QString mCurrentState;
 		QVector<ReaderManagerPlugInType> mReaderPlugInTypes;
 		QString mReaderName;
+		QString mBoundReaderName;
 		QSharedPointer<CardConnection> mCardConnection;
 		int mCardVanishedDuringPacePinCount;
 		QElapsedTimer mCardVanishedDuringPacePinTimer;
@@ -97,6 +98,13 @@ class WorkflowContext
 		[[nodiscard]] const QString& getReaderName() const;
 		void setReaderName(const QString& pReaderName);
 
+		/*!
+		 * A workflow bound to a reader only selects this reader and shares
+		 * the ReaderManager with other workflows running concurrently.
+		 */
+		[[nodiscard]] const QString& getBoundReaderName() const;
+		void setBoundReaderName(const QString& pReaderName);
+
 		[[nodiscard]] const QSharedPointer<CardConnection>& getCardConnection() const;
 		void setCardConnection(const QSharedPointer<CardConnection>& pCardConnection);
 		void resetCardConnection();
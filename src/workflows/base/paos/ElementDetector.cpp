@@ -6,6 +6,8 @@
 
 #include <QLoggingCategory>
 
+#include <algorithm>
+
 
 using namespace governikus;
 
@@ -44,8 +46,12 @@ void ElementDetector::detectStartElements(const QStringList& pStartElementNames)
 
 void ElementDetector::handleStartElements(const QStringList& pStartElementNames)
 {
-	QString name = mReader.name().toString();
-	if (pStartElementNames.contains(name))
+	const auto& name = mReader.name();
+	const auto& found = std::find_if(pStartElementNames.cbegin(), pStartElementNames.cend(), [&name](const QString& pElementName){
+			return name == pElementName;
+		});
+
+	if (found != pStartElementNames.cend())
 	{
 		QXmlStreamAttributes attributes = mReader.attributes();
 		QString value;
@@ -53,7 +59,7 @@ void ElementDetector::handleStartElements(const QStringList& pStartElementNames)
 		{
 			value = mReader.text().toString().simplified();
 		}
-		if (!handleFoundElement(name, value, attributes))
+		if (!handleFoundElement(*found, value, attributes))
 		{
 			return;
 		}
@@ -7,135 +7,220 @@
 #include "paos/retrieve/InitializeFramework.h"
 #include "paos/retrieve/StartPaosResponse.h"
 #include "PaosHandler.h"
+#include "PaosTypeDetector.h"
 #include "retrieve/DidAuthenticateEac1Parser.h"
 #include "retrieve/DidAuthenticateEac2Parser.h"
 #include "retrieve/DidAuthenticateEacAdditionalParser.h"
 #include "retrieve/TransmitParser.h"
 
+#include <algorithm>
+#include <iterator>
+
 using namespace governikus;
 
 
-PaosHandler::PaosHandler(const QByteArray& pXmlData)
-	: ElementDetector(pXmlData)
-	, mDetectedType(PaosType::UNKNOWN)
-	, mParsedObject()
+namespace
 {
-	detect();
-	parse();
+using MessageFactory = PaosMessage* (*)(const QSharedPointer<QXmlStreamReader>& pXmlReader, const QByteArray& pXmlData, PaosType pDetectedType);
+
+
+template<typename T> PaosMessage* parseWithParser(const QSharedPointer<QXmlStreamReader>& pXmlReader, const QByteArray&, PaosType)
+{
+	return T().parse(pXmlReader);
 }
 
 
-void PaosHandler::parse()
+template<typename T> PaosMessage* parseWithDetector(const QSharedPointer<QXmlStreamReader>& pXmlReader, const QByteArray& pXmlData, PaosType)
 {
-	if (mDetectedType == PaosType::INITIALIZE_FRAMEWORK)
-	{
-		setParsedObject(new InitializeFramework(mXmlData));
-	}
-	else if (mDetectedType == PaosType::DID_LIST)
-	{
-		setParsedObject(new DIDList(mXmlData));
-	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC1)
+	// These messages are small and parse the WS addressing headers themselves.
+	pXmlReader->skipCurrentElement();
+	return new T(pXmlData);
+}
+
+
+PaosType detectDidAuthenticateType(const QByteArray& pXmlData)
+{
+	// The type of a DIDAuthenticate is only known from the AuthenticationProtocolData
+	// element. It follows the small ConnectionHandle and DIDName elements, so look
+	// ahead until it is found and parse the message afterwards in a single pass.
+	QXmlStreamReader reader(pXmlData);
+	for (; !reader.atEnd() && !reader.hasError(); reader.readNext())
 	{
-		setParsedObject(DidAuthenticateEac1Parser().parse(mXmlData));
+		if (reader.isStartElement() && reader.name() == QLatin1String("AuthenticationProtocolData"))
+		{
+			return PaosTypeDetector::getDidAuthenticateType(reader.attributes());
+		}
 	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC2)
+
+	return PaosType::UNKNOWN;
+}
+
+
+PaosMessage* parseDidAuthenticate(const QSharedPointer<QXmlStreamReader>& pXmlReader, const QByteArray& pXmlData, PaosType pDetectedType)
+{
+	// Skip the look ahead if the type was already detected while the message was received.
+	auto type = pDetectedType;
+	if (type != PaosType::DID_AUTHENTICATE_EAC1 && type != PaosType::DID_AUTHENTICATE_EAC2 && type != PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE)
 	{
-		setParsedObject(DidAuthenticateEac2Parser().parse(mXmlData));
+		type = detectDidAuthenticateType(pXmlData);
 	}
-	else if (mDetectedType == PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE)
+
+	switch (type)
 	{
-		setParsedObject(DidAuthenticateEacAdditionalParser().parse(mXmlData));
+		case PaosType::DID_AUTHENTICATE_EAC1:
+			return parseWithParser<DidAuthenticateEac1Parser>(pXmlReader, pXmlData, type);
+
+		case PaosType::DID_AUTHENTICATE_EAC2:
+			return parseWithParser<DidAuthenticateEac2Parser>(pXmlReader, pXmlData, type);
+
+		case PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE:
+			return parseWithParser<DidAuthenticateEacAdditionalParser>(pXmlReader, pXmlData, type);
+
+		default:
+			qCWarning(paos) << "Unknown AuthenticationProtocolData of DIDAuthenticate";
+			pXmlReader->skipCurrentElement();
+			return nullptr;
 	}
-	else if (mDetectedType == PaosType::TRANSMIT)
+}
+
+
+const struct
+{
+	QLatin1String mName;
+	MessageFactory mFactory;
+} BODY_ELEMENTS[] = {
+	{QLatin1String("Transmit"), &parseWithParser<TransmitParser>},
+	{QLatin1String("DIDAuthenticate"), &parseDidAuthenticate},
+	{QLatin1String("InitializeFramework"), &parseWithDetector<InitializeFramework>},
+	{QLatin1String("DIDList"), &parseWithDetector<DIDList>},
+	{QLatin1String("Disconnect"), &parseWithDetector<Disconnect>},
+	{QLatin1String("StartPAOSResponse"), &parseWithDetector<StartPaosResponse>}
+};
+
+} // namespace
+
+
+PaosHandler::PaosHandler(const QByteArray& pXmlData, PaosType pDetectedType)
+	: ElementParser(QSharedPointer<QXmlStreamReader>::create(pXmlData))
+	, mXmlData(pXmlData)
+	, mPreDetectedType(pDetectedType)
+	, mDetectedType(PaosType::UNKNOWN)
+	, mParsedObject()
+	, mMessageID()
+	, mRelatesTo()
+{
+	parse();
+}
+
+
+void PaosHandler::parse()
+{
+	while (readNextStartElement())
 	{
-		setParsedObject(TransmitParser().parse(mXmlData));
+		if (mXmlReader->name() == QLatin1String("Envelope"))
+		{
+			parseEnvelope();
+		}
+		else
+		{
+			mXmlReader->skipCurrentElement();
+		}
 	}
-	else if (mDetectedType == PaosType::DISCONNECT)
+
+	if (mXmlReader->hasError())
 	{
-		setParsedObject(new Disconnect(mXmlData));
+		qCWarning(paos) << "Error parsing PAOS message:" << mXmlReader->errorString();
 	}
-	else if (mDetectedType == PaosType::STARTPAOS_RESPONSE)
+
+	if (mParseError)
 	{
-		setParsedObject(new StartPaosResponse(mXmlData));
+		mParsedObject.reset();
+		mDetectedType = PaosType::UNKNOWN;
 	}
 }
 
 
-void PaosHandler::setParsedObject(PaosMessage* pParsedObject)
+void PaosHandler::parseEnvelope()
 {
-	if (pParsedObject == nullptr)
+	while (readNextStartElement())
 	{
-		qCCritical(paos) << "Error parsing message. This is not a valid" << mDetectedType;
-		mDetectedType = PaosType::UNKNOWN;
-	}
-	else
-	{
-		mParsedObject = QSharedPointer<PaosMessage>(pParsedObject);
+		if (mXmlReader->name() == QLatin1String("Body"))
+		{
+			parseBody();
+		}
+		else if (mXmlReader->name() == QLatin1String("Header"))
+		{
+			parseHeader();
+		}
+		else
+		{
+			mXmlReader->skipCurrentElement();
+		}
 	}
 }
 
 
-bool PaosHandler::handleFoundElement(const QString& pElementName, const QString&, const QXmlStreamAttributes& pAttributes)
+void PaosHandler::parseHeader()
 {
-	if (pElementName == QLatin1String("InitializeFramework"))
-	{
-		mDetectedType = PaosType::INITIALIZE_FRAMEWORK;
-	}
-	else if (pElementName == QLatin1String("DIDList"))
-	{
-		mDetectedType = PaosType::DID_LIST;
-	}
-	else if (pElementName == QLatin1String("DIDAuthenticate"))
+	while (readNextStartElement())
 	{
-		detectStartElements({QStringLiteral("AuthenticationProtocolData")});
+		if (mXmlReader->name() == QLatin1String("MessageID"))
+		{
+			mMessageID = readElementText();
+		}
+		else if (mXmlReader->name() == QLatin1String("RelatesTo"))
+		{
+			mRelatesTo = readElementText();
+		}
+		else
+		{
+			mXmlReader->skipCurrentElement();
+		}
 	}
-	else if (pElementName == QLatin1String("AuthenticationProtocolData"))
+}
+
+
+void PaosHandler::parseBody()
+{
+	while (readNextStartElement())
 	{
-		for (const auto& attribute : pAttributes)
+		const auto& name = mXmlReader->name();
+		const auto* element = std::find_if(std::begin(BODY_ELEMENTS), std::end(BODY_ELEMENTS), [&name](const auto& pElement){
+				return name == pElement.mName;
+			});
+
+		if (element == std::end(BODY_ELEMENTS))
+		{
+			mXmlReader->skipCurrentElement();
+		}
+		else if (assertNoDuplicateElement(mParsedObject.isNull() && mDetectedType == PaosType::UNKNOWN))
 		{
-			if (attribute.value().endsWith(QLatin1String("EAC1InputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC1;
-			}
-			else if (attribute.value().endsWith(QLatin1String("EAC2InputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC2;
-			}
-			else if (attribute.value().endsWith(QLatin1String("EACAdditionalInputType")))
-			{
-				mDetectedType = PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE;
-			}
+			setParsedObject(element->mFactory(mXmlReader, mXmlData, mPreDetectedType), element->mName);
 		}
 	}
-	else if (pElementName == QLatin1String("Transmit"))
+}
+
+
+void PaosHandler::setParsedObject(PaosMessage* pParsedObject, QLatin1String pElementName)
+{
+	if (pParsedObject == nullptr)
 	{
-		mDetectedType = PaosType::TRANSMIT;
+		qCCritical(paos) << "Error parsing message. This is not a valid" << pElementName;
+		mParseError = true;
+		return;
 	}
-	else if (pElementName == QLatin1String("Disconnect"))
+
+	mDetectedType = pParsedObject->mType;
+	mParsedObject = QSharedPointer<PaosMessage>(pParsedObject);
+
+	if (!mMessageID.isNull())
 	{
-		mDetectedType = PaosType::DISCONNECT;
+		mParsedObject->setMessageId(mMessageID);
 	}
-	else if (pElementName == QLatin1String("StartPAOSResponse"))
+	if (!mRelatesTo.isNull())
 	{
-		mDetectedType = PaosType::STARTPAOS_RESPONSE;
+		mParsedObject->setRelatesTo(mRelatesTo);
 	}
-	return false;
-}
-
-
-void PaosHandler::detect()
-{
-	const QStringList expectedElements({
-				QStringLiteral("InitializeFramework"),
-				QStringLiteral("DIDList"),
-				QStringLiteral("DIDAuthenticate"),
-				QStringLiteral("Transmit"),
-				QStringLiteral("Disconnect"),
-				QStringLiteral("StartPAOSResponse")
-			});
-
-	detectStartElements(expectedElements);
 }
 
 
@@ -1,12 +1,15 @@
 /*!
  * \brief Generic Handler to detect and parse paos types.
  *
+ * The envelope is traversed once: the header is read on the way and the
+ * body element is dispatched to the matching parser on the same reader.
+ *
  * \copyright Copyright (c) 2014-2022 Governikus GmbH & Co. KG, Germany
  */
 
 #pragma once
 
-#include "paos/ElementDetector.h"
+#include "paos/element/ElementParser.h"
 #include "paos/PaosMessage.h"
 
 #include <QSharedPointer>
@@ -16,21 +19,30 @@ namespace governikus
 {
 
 class PaosHandler
-	: private ElementDetector
+	: private ElementParser
 {
 	private:
+		const QByteArray mXmlData;
+		const PaosType mPreDetectedType;
 		PaosType mDetectedType;
 		QSharedPointer<PaosMessage> mParsedObject;
+		QString mMessageID;
+		QString mRelatesTo;
 
 		Q_DISABLE_COPY(PaosHandler)
-		void detect();
 		void parse();
-		void setParsedObject(PaosMessage* pParsedObject);
-
-		bool handleFoundElement(const QString& pElementName, const QString& pValue, const QXmlStreamAttributes& pAttributes) override;
+		void parseEnvelope();
+		void parseHeader();
+		void parseBody();
+		void setParsedObject(PaosMessage* pParsedObject, QLatin1String pElementName);
 
 	public:
-		explicit PaosHandler(const QByteArray& pXmlData);
+		/*!
+		 * \param pDetectedType Type reported by PaosTypeDetector, if the message was
+		 *        already scanned while it was received. It saves the look ahead to
+		 *        the AuthenticationProtocolData of a DIDAuthenticate.
+		 */
+		explicit PaosHandler(const QByteArray& pXmlData, PaosType pDetectedType = PaosType::UNKNOWN);
 
 		[[nodiscard]] PaosType getDetectedPaosType() const;
 		[[nodiscard]] QSharedPointer<PaosMessage> getPaosMessage() const;
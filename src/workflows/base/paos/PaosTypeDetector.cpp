@@ -0,0 +1,198 @@
+/*!
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "PaosTypeDetector.h"
+
+#include <QLoggingCategory>
+
+#include <algorithm>
+#include <iterator>
+
+
+using namespace governikus;
+
+
+Q_DECLARE_LOGGING_CATEGORY(paos)
+
+
+namespace
+{
+const struct
+{
+	QLatin1String mName;
+	PaosType mType;
+} BODY_ELEMENTS[] = {
+	{QLatin1String("Transmit"), PaosType::TRANSMIT},
+	{QLatin1String("InitializeFramework"), PaosType::INITIALIZE_FRAMEWORK},
+	{QLatin1String("DIDList"), PaosType::DID_LIST},
+	{QLatin1String("Disconnect"), PaosType::DISCONNECT},
+	{QLatin1String("StartPAOSResponse"), PaosType::STARTPAOS_RESPONSE}
+};
+
+} // namespace
+
+
+PaosTypeDetector::PaosTypeDetector()
+	: mReader()
+	, mDepth(0)
+	, mInBody(false)
+	, mInDidAuthenticate(false)
+	, mFinished(false)
+	, mDetectedType(PaosType::UNKNOWN)
+{
+}
+
+
+PaosType PaosTypeDetector::getDidAuthenticateType(const QXmlStreamAttributes& pAttributes)
+{
+	for (const auto& attribute : pAttributes)
+	{
+		if (attribute.value().endsWith(QLatin1String("EAC1InputType")))
+		{
+			return PaosType::DID_AUTHENTICATE_EAC1;
+		}
+		else if (attribute.value().endsWith(QLatin1String("EAC2InputType")))
+		{
+			return PaosType::DID_AUTHENTICATE_EAC2;
+		}
+		else if (attribute.value().endsWith(QLatin1String("EACAdditionalInputType")))
+		{
+			return PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE;
+		}
+	}
+
+	return PaosType::UNKNOWN;
+}
+
+
+void PaosTypeDetector::finish(PaosType pType)
+{
+	mDetectedType = pType;
+	mFinished = true;
+}
+
+
+void PaosTypeDetector::handleStartElement()
+{
+	const auto& name = mReader.name();
+	switch (mDepth)
+	{
+		case 1:
+			if (name != QLatin1String("Envelope"))
+			{
+				finish(PaosType::UNKNOWN);
+			}
+			break;
+
+		case 2:
+			mInBody = name == QLatin1String("Body");
+			break;
+
+		case 3:
+			if (!mInBody)
+			{
+				break;
+			}
+
+			if (name == QLatin1String("DIDAuthenticate"))
+			{
+				mInDidAuthenticate = true;
+				break;
+			}
+
+			{
+				const auto* element = std::find_if(std::begin(BODY_ELEMENTS), std::end(BODY_ELEMENTS), [&name](const auto& pElement){
+						return name == pElement.mName;
+					});
+				if (element != std::end(BODY_ELEMENTS))
+				{
+					finish(element->mType);
+				}
+			}
+			break;
+
+		case 4:
+			if (mInDidAuthenticate && name == QLatin1String("AuthenticationProtocolData"))
+			{
+				finish(getDidAuthenticateType(mReader.attributes()));
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+void PaosTypeDetector::addData(const QByteArray& pData)
+{
+	if (mFinished)
+	{
+		return;
+	}
+
+	mReader.addData(pData);
+	while (!mFinished)
+	{
+		switch (mReader.readNext())
+		{
+			case QXmlStreamReader::StartElement:
+				++mDepth;
+				handleStartElement();
+				break;
+
+			case QXmlStreamReader::EndElement:
+				if (mDepth == 3 && mInDidAuthenticate)
+				{
+					finish(PaosType::UNKNOWN);
+				}
+				else if (mDepth == 2 && mInBody)
+				{
+					finish(PaosType::UNKNOWN);
+				}
+				--mDepth;
+				break;
+
+			case QXmlStreamReader::EndDocument:
+				finish(PaosType::UNKNOWN);
+				break;
+
+			case QXmlStreamReader::Invalid:
+				if (mReader.error() == QXmlStreamReader::PrematureEndOfDocumentError)
+				{
+					// wait for the next chunk
+					return;
+				}
+				qCWarning(paos) << "Cannot detect type of PAOS message:" << mReader.errorString();
+				finish(PaosType::UNKNOWN);
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+
+void PaosTypeDetector::clear()
+{
+	mReader.clear();
+	mDepth = 0;
+	mInBody = false;
+	mInDidAuthenticate = false;
+	mFinished = false;
+	mDetectedType = PaosType::UNKNOWN;
+}
+
+
+bool PaosTypeDetector::isFinished() const
+{
+	return mFinished;
+}
+
+
+PaosType PaosTypeDetector::getDetectedPaosType() const
+{
+	return mDetectedType;
+}
@@ -0,0 +1,55 @@
+/*!
+ * \brief Incremental detection of the paos type while the message is still received.
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#pragma once
+
+#include "paos/PaosType.h"
+
+#include <QByteArray>
+#include <QXmlStreamReader>
+
+namespace governikus
+{
+
+/*!
+ * Reads the chunks of a PAOS envelope as they arrive and stops as soon as the
+ * first known body element determines the type. The rest of the message is
+ * never fed into the detector. Use PaosHandler to parse the complete message.
+ */
+class PaosTypeDetector
+{
+	private:
+		QXmlStreamReader mReader;
+		int mDepth;
+		bool mInBody;
+		bool mInDidAuthenticate;
+		bool mFinished;
+		PaosType mDetectedType;
+
+		Q_DISABLE_COPY(PaosTypeDetector)
+		void handleStartElement();
+		void finish(PaosType pType);
+
+	public:
+		PaosTypeDetector();
+
+		/*!
+		 * Returns the type of a DIDAuthenticate from the attributes of
+		 * its AuthenticationProtocolData element.
+		 */
+		static PaosType getDidAuthenticateType(const QXmlStreamAttributes& pAttributes);
+
+		void addData(const QByteArray& pData);
+		void clear();
+
+		/*!
+		 * Returns true if the type is known or if no more data can change the result.
+		 */
+		[[nodiscard]] bool isFinished() const;
+		[[nodiscard]] PaosType getDetectedPaosType() const;
+};
+
+} // namespace governikus
@@ -68,6 +68,21 @@ PaosMessage* PaosParser::parse(const QByteArray& pXmlData)
 }
 
 
+PaosMessage* PaosParser::parse(const QSharedPointer<QXmlStreamReader>& pXmlReader)
+{
+	mXmlReader = pXmlReader;
+
+	PaosMessage* message = parseMessage();
+	if (mParseError)
+	{
+		delete message;
+		return nullptr;
+	}
+
+	return message;
+}
+
+
 PaosMessage* PaosParser::parseEnvelope()
 {
 	PaosMessage* message = nullptr;
@@ -21,6 +21,12 @@ class PaosParser
 
 		PaosMessage* parse(const QByteArray& pXmlData);
 
+		/*!
+		 * \brief Parses the message element the reader is positioned at.
+		 * The envelope and header are expected to be handled by the caller.
+		 */
+		PaosMessage* parse(const QSharedPointer<QXmlStreamReader>& pXmlReader);
+
 	protected:
 		virtual PaosMessage* parseMessage() = 0;
 
@@ -23,19 +23,23 @@ void StateCleanUpReaderManager::run()
 {
 	const QSharedPointer<WorkflowContext> context = getContext();
 
-	// Stop scanning is required to kill all connections to force deleting all pace passwords on a remote comfort reader
-	const auto& status = context->getStatus();
-	const auto readerManager = Env::getSingleton<ReaderManager>();
-	readerManager->stopScanAll(status.isError() ? status.toErrorDescription(true) : QString());
+	// A workflow bound to a reader must not stop the readers of concurrent workflows
+	if (context->getBoundReaderName().isEmpty())
+	{
+		// Stop scanning is required to kill all connections to force deleting all pace passwords on a remote comfort reader
+		const auto& status = context->getStatus();
+		const auto readerManager = Env::getSingleton<ReaderManager>();
+		readerManager->stopScanAll(status.isError() ? status.toErrorDescription(true) : QString());
 
 #ifdef Q_OS_IOS
-	readerManager->reset(ReaderManagerPlugInType::NFC);
+		readerManager->reset(ReaderManagerPlugInType::NFC);
 #else
-	if (Env::getSingleton<VolatileSettings>()->isUsedAsSDK())
-	{
-		readerManager->startScanAll();
-	}
+		if (Env::getSingleton<VolatileSettings>()->isUsedAsSDK())
+		{
+			readerManager->startScanAll();
+		}
 #endif
+	}
 
 	if (context->getCardConnection())
 	{
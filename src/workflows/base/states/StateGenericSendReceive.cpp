@@ -16,12 +16,20 @@ Q_DECLARE_LOGGING_CATEGORY(network)
 
 using namespace governikus;
 
+namespace
+{
+// PAOS messages are small, so a larger announced length is not trusted for the allocation.
+const qint64 MAX_RESERVED_SIZE = 1024 * 1024;
+} // namespace
+
 
 StateGenericSendReceive::StateGenericSendReceive(const QSharedPointer<WorkflowContext>& pContext, const QVector<PaosType>& pTypesToReceive, bool pConnectOnCardRemoved)
 	: AbstractState(pContext, pConnectOnCardRemoved)
 	, GenericContextContainer(pContext)
 	, mTypesToReceive(pTypesToReceive)
 	, mReply()
+	, mReceivedData()
+	, mTypeDetector()
 {
 }
 
@@ -191,6 +199,8 @@ void StateGenericSendReceive::onExit(QEvent* pEvent)
 	{
 		mReply.reset();
 	}
+	mReceivedData.clear();
+	mTypeDetector.clear();
 }
 
 
@@ -262,14 +272,95 @@ void StateGenericSendReceive::run()
 	qCDebug(network).noquote() << "Try to send raw data:\n" << data;
 	const QByteArray& paosNamespace = PaosCreator::getNamespace(PaosCreator::Namespace::PAOS).toUtf8();
 	const auto& session = token->usePsk() ? QByteArray() : getContext()->getSslSession();
+	mReceivedData.clear();
+	mTypeDetector.clear();
 	mReply.reset(Env::getSingleton<NetworkManager>()->paos(request, paosNamespace, data, token->usePsk(), session), &QObject::deleteLater);
 	mConnections += connect(mReply.data(), &QNetworkReply::sslErrors, this, &StateGenericSendReceive::onSslErrors);
 	mConnections += connect(mReply.data(), &QNetworkReply::encrypted, this, &StateGenericSendReceive::onSslHandshakeDone);
+	mConnections += connect(mReply.data(), &QNetworkReply::readyRead, this, &StateGenericSendReceive::onReplyReadyRead);
 	mConnections += connect(mReply.data(), &QNetworkReply::finished, this, &StateGenericSendReceive::onReplyFinished);
 	mConnections += connect(mReply.data(), &QNetworkReply::preSharedKeyAuthenticationRequired, this, &StateGenericSendReceive::onPreSharedKeyAuthenticationRequired);
 }
 
 
+bool StateGenericSendReceive::checkReceivedType(PaosType pType)
+{
+	if (mTypesToReceive.contains(pType))
+	{
+		return true;
+	}
+
+	QString warnMsg = QStringLiteral("Received PAOS message not of expected type: ");
+	for (const auto expectedType : mTypesToReceive)
+	{
+		warnMsg += expectedType;
+		warnMsg += QLatin1Char(' ');
+	}
+	qCCritical(network) << warnMsg;
+
+	if (pType == PaosType::UNKNOWN)
+	{
+		qCCritical(network) << "The program received an unknown message from the server.";
+		updateStatus({GlobalStatus::Code::Workflow_Unknown_Paos_From_EidServer, {GlobalStatus::ExternalInformation::LAST_URL, mReply->url().toString()}
+				});
+	}
+	else
+	{
+		qCCritical(network) << "The program received an unexpected message from the server.";
+		updateStatus({GlobalStatus::Code::Workflow_Unexpected_Message_From_EidServer, {GlobalStatus::ExternalInformation::LAST_URL, mReply->url().toString()}
+				});
+	}
+	return false;
+}
+
+
+void StateGenericSendReceive::onReplyReadyRead()
+{
+	if (mReceivedData.isEmpty())
+	{
+		bool ok = false;
+		const auto contentLength = mReply->header(QNetworkRequest::ContentLengthHeader).toLongLong(&ok);
+		if (ok && contentLength > 0)
+		{
+			mReceivedData.reserve(static_cast<int>(qMin(contentLength, MAX_RESERVED_SIZE)));
+		}
+	}
+
+	const QByteArray& chunk = mReply->readAll();
+	mReceivedData += chunk;
+
+	if (mTypeDetector.isFinished())
+	{
+		return;
+	}
+
+	// The type is usually known after the first chunk. Detecting it while the
+	// rest of the message is received allows to drop unexpected messages early.
+	mTypeDetector.addData(chunk);
+	if (!mTypeDetector.isFinished())
+	{
+		return;
+	}
+
+	const auto type = mTypeDetector.getDetectedPaosType();
+	qCDebug(network) << "Detected PAOS message of type" << type << "after" << mReceivedData.size() << "bytes";
+
+	const auto statusCode = mReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+	if (type == PaosType::UNKNOWN || statusCode >= 400)
+	{
+		// The complete message and the status code are checked on finish.
+		return;
+	}
+
+	if (!checkReceivedType(type))
+	{
+		clearConnections();
+		mReply->abort();
+		Q_EMIT fireAbort();
+	}
+}
+
+
 void StateGenericSendReceive::onReplyFinished()
 {
 	qCDebug(network) << "Received message from eID-Server";
@@ -302,33 +393,13 @@ void StateGenericSendReceive::onReplyFinished()
 		return;
 	}
 
-	QByteArray message = mReply->readAll();
-	qCDebug(network).noquote() << "Received raw data:\n" << message;
-	PaosHandler paosHandler(message);
+	mReceivedData += mReply->readAll();
+	qCDebug(network).noquote() << "Received raw data:\n" << mReceivedData;
+	PaosHandler paosHandler(mReceivedData, mTypeDetector.getDetectedPaosType());
 	qCDebug(network) << "Received PAOS message of type:" << paosHandler.getDetectedPaosType();
 
-	if (!mTypesToReceive.contains(paosHandler.getDetectedPaosType()))
+	if (!checkReceivedType(paosHandler.getDetectedPaosType()))
 	{
-		QString warnMsg = QStringLiteral("Received PAOS message not of expected type: ");
-		for (const auto expectedType : mTypesToReceive)
-		{
-			warnMsg += expectedType;
-			warnMsg += QLatin1Char(' ');
-		}
-		qCCritical(network) << warnMsg;
-
-		if (paosHandler.getDetectedPaosType() == PaosType::UNKNOWN)
-		{
-			qCCritical(network) << "The program received an unknown message from the server.";
-			updateStatus({GlobalStatus::Code::Workflow_Unknown_Paos_From_EidServer, {GlobalStatus::ExternalInformation::LAST_URL, mReply->url().toString()}
-					});
-		}
-		else
-		{
-			qCCritical(network) << "The program received an unexpected message from the server.";
-			updateStatus({GlobalStatus::Code::Workflow_Unexpected_Message_From_EidServer, {GlobalStatus::ExternalInformation::LAST_URL, mReply->url().toString()}
-					});
-		}
 		Q_EMIT fireAbort();
 		return;
 	}
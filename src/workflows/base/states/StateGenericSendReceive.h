@@ -10,6 +10,7 @@
 #include "paos/invoke/PaosCreator.h"
 #include "paos/PaosMessage.h"
 #include "paos/PaosType.h"
+#include "paos/PaosTypeDetector.h"
 
 #include <QSharedPointer>
 #include <QSslPreSharedKeyAuthenticator>
@@ -30,8 +31,11 @@ class StateGenericSendReceive
 		friend class ::test_StateGenericSendReceive;
 		const QVector<PaosType> mTypesToReceive;
 		QSharedPointer<QNetworkReply> mReply;
+		QByteArray mReceivedData;
+		PaosTypeDetector mTypeDetector;
 
 		void setReceivedMessage(const QSharedPointer<PaosMessage>& pMessage);
+		bool checkReceivedType(PaosType pType);
 		GlobalStatus::Code checkAndSaveCertificate(const QSslCertificate& pCertificate);
 		void onSslErrors(const QList<QSslError>& pErrors);
 		void onSslHandshakeDone();
@@ -47,6 +51,7 @@ class StateGenericSendReceive
 		virtual void emitStateMachineSignal(int result) = 0;
 
 	private Q_SLOTS:
+		void onReplyReadyRead();
 		void onReplyFinished();
 		void onPreSharedKeyAuthenticationRequired(QSslPreSharedKeyAuthenticator* pAuthenticator);
 
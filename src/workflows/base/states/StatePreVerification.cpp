@@ -4,6 +4,7 @@
 
 #include "StatePreVerification.h"
 
+#include "asn1/CVCertificateChainBuilder.h"
 #include "asn1/SignatureChecker.h"
 #include "AppSettings.h"
 #include "EnumHelper.h"
@@ -19,8 +20,8 @@ using namespace governikus;
 StatePreVerification::StatePreVerification(const QSharedPointer<WorkflowContext>& pContext)
 	: AbstractState(pContext, false)
 	, GenericContextContainer(pContext)
-	, mTrustedCvcas(CVCertificate::fromHex(Env::getSingleton<SecureStorage>()->getCVRootCertificates(true))
-			+ CVCertificate::fromHex(Env::getSingleton<SecureStorage>()->getCVRootCertificates(false)))
+	, mTrustedCvcas(CVCertificate::fromHex(Env::getSingleton<SecureStorage>()->getCVRootCertificates(true), true)
+			+ CVCertificate::fromHex(Env::getSingleton<SecureStorage>()->getCVRootCertificates(false), true))
 	, mValidationDateTime(QDateTime::currentDateTime())
 {
 }
@@ -39,7 +40,7 @@ void StatePreVerification::run()
 			// want a chain with self signed root, because the SignatureChecker needs it
 			continue;
 		}
-		certificateChain = getContext()->getChainStartingWith(trustPoint);
+		certificateChain = getContext()->getChainStartingWith(trustPoint, mTrustedCvcas);
 		if (certificateChain.isValid())
 		{
 			break;
@@ -69,7 +70,7 @@ void StatePreVerification::run()
 		Q_EMIT fireAbort();
 		return;
 	}
-	else if (!SignatureChecker(certificateChain).check())
+	else if (!SignatureChecker(certificateChain, mValidationDateTime).check())
 	{
 		qCritical() << "Pre-verification failed: signature check failed";
 		updateStatus(GlobalStatus::Code::Workflow_Preverification_Error);
@@ -90,6 +91,11 @@ void StatePreVerification::run()
 			return;
 		}
 	}
+	else if (!developerMode)
+	{
+		// Only a chain that passed every check without the developer mode may skip later verifications.
+		CVCertificateChainBuilder::addVerifiedChain(certificateChain, mTrustedCvcas);
+	}
 
 	saveCvcaLinkCertificates(certificateChain);
 
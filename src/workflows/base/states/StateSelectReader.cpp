@@ -38,11 +38,24 @@ void StateSelectReader::run()
 
 	onReaderInfoChanged();
 
+	// The scan of a bound reader is shared with other workflows. It is started if
+	// it is not running yet, but never stopped for them.
+	const bool bound = !getContext()->getBoundReaderName().isEmpty();
 	const auto& readerPlugInTypes = Enum<ReaderManagerPlugInType>::getList();
 	const auto& enabledPlugInTypes = getContext()->getReaderPlugInTypes();
 	for (const auto t : readerPlugInTypes)
 	{
-		enabledPlugInTypes.contains(t) ? readerManager->startScan(t) : readerManager->stopScan(t);
+		if (enabledPlugInTypes.contains(t))
+		{
+			if (!bound || !readerManager->isScanRunning(t))
+			{
+				readerManager->startScan(t);
+			}
+		}
+		else if (!bound)
+		{
+			readerManager->stopScan(t);
+		}
 	}
 }
 
@@ -57,8 +70,14 @@ void StateSelectReader::onReaderInfoChanged()
 	const auto allReaders = Env::getSingleton<ReaderManager>()->getReaderInfos(ReaderFilter(plugInTypes));
 	QVector<ReaderInfo> selectableReaders;
 
+	const QString& boundReaderName = context->getBoundReaderName();
 	for (const auto& info : allReaders)
 	{
+		if (!boundReaderName.isEmpty() && info.getName() != boundReaderName)
+		{
+			continue;
+		}
+
 		if (info.isConnected() && (!requiresCard(info.getPlugInType()) || info.hasEidCard()))
 		{
 			if (info.sufficientApduLength())
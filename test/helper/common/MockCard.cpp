@@ -4,6 +4,8 @@
 
 #include "MockCard.h"
 
+#include <QThread>
+
 using namespace governikus;
 
 MockCard::MockCard(const MockCardConfig& pCardConfig)
@@ -40,6 +42,10 @@ ResponseApduResult MockCard::transmit(const CommandApdu& pCmd)
 		qFatal("No (more) response APDU configured, but a(nother) command transmitted");
 	}
 	QPair<CardReturnCode, QByteArray> config = mCardConfig.mTransmits.takeFirst();
+	if (mCardConfig.mTransmitDelay > 0)
+	{
+		QThread::msleep(mCardConfig.mTransmitDelay);
+	}
 	return {config.first, ResponseApdu(config.second)};
 }
 
@@ -24,6 +24,7 @@ class MockCardConfig
 		QVector<TransmitConfig> mTransmits;
 		CardReturnCode mConnect = CardReturnCode::OK;
 		CardReturnCode mDisconnect = CardReturnCode::OK;
+		unsigned long mTransmitDelay = 0;
 
 		MockCardConfig(const QVector<TransmitConfig>& pTransmits = QVector<TransmitConfig>())
 			: mTransmits(pTransmits)
@@ -4,6 +4,8 @@
 
 #include "MockCardConnectionWorker.h"
 
+#include <utility>
+
 using namespace governikus;
 
 
@@ -13,6 +15,7 @@ MockCardConnectionWorker::MockCardConnectionWorker(Reader* pReader)
 	, mResponseCodes()
 	, mResponseData()
 	, mPaceCodes()
+	, mBatchResponses()
 {
 }
 
@@ -39,6 +42,12 @@ void MockCardConnectionWorker::addPaceCode(CardReturnCode pCode)
 }
 
 
+void MockCardConnectionWorker::setBatchResponses(const QVector<ResponseApduResult>& pBatchResponses)
+{
+	mBatchResponses = pBatchResponses;
+}
+
+
 ResponseApduResult MockCardConnectionWorker::getMockedResponse()
 {
 	if (mResponseData.empty())
@@ -57,6 +66,13 @@ ResponseApduResult MockCardConnectionWorker::transmit(const CommandApdu& pComman
 }
 
 
+QVector<ResponseApduResult> MockCardConnectionWorker::transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos)
+{
+	Q_UNUSED(pInputApduInfos)
+	return std::exchange(mBatchResponses, QVector<ResponseApduResult>());
+}
+
+
 CardReturnCode MockCardConnectionWorker::updateRetryCounter()
 {
 	if (!mReader->getReaderInfo().hasCard())
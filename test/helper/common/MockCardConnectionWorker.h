@@ -25,6 +25,7 @@ class MockCardConnectionWorker
 		QList<CardReturnCode> mResponseCodes;
 		QByteArrayList mResponseData;
 		QList<CardReturnCode> mPaceCodes;
+		QVector<ResponseApduResult> mBatchResponses;
 
 		ResponseApduResult getMockedResponse();
 
@@ -34,8 +35,10 @@ class MockCardConnectionWorker
 
 		void addResponse(CardReturnCode pCode, const QByteArray& pData = QByteArray());
 		void addPaceCode(CardReturnCode pCode);
+		void setBatchResponses(const QVector<ResponseApduResult>& pBatchResponses);
 
 		ResponseApduResult transmit(const CommandApdu& pCommandApdu) override;
+		QVector<ResponseApduResult> transmitBatch(const QVector<InputAPDUInfo>& pInputApduInfos) override;
 		CardReturnCode updateRetryCounter() override;
 		EstablishPaceChannelOutput establishPaceChannel(PacePasswordId pPasswordId,
 				const QByteArray& pPasswordValue,
@@ -10,6 +10,8 @@ using namespace governikus;
 MockNetworkReply::MockNetworkReply(const QByteArray& pData, http_status pStatusCode, QObject* pParent)
 	: QNetworkReply(pParent)
 	, mSocket()
+	, mReadableSize(-1)
+	, mSslConfiguration()
 {
 	mSocket.mReadBuffer = pData;
 	setOpenMode(QIODevice::ReadOnly);
@@ -24,5 +26,25 @@ MockNetworkReply::~MockNetworkReply()
 
 qint64 MockNetworkReply::readData(char* pDst, qint64 pMaxSize)
 {
+	if (mReadableSize > -1)
+	{
+		pMaxSize = qMin(pMaxSize, mReadableSize - static_cast<qint64>(mSocket.mReaderBufferPosition));
+	}
+
 	return mSocket.readData(pDst, pMaxSize);
 }
+
+
+void MockNetworkReply::fireReadyReadChunked(int pChunkSize)
+{
+	Q_ASSERT(pChunkSize > 0);
+
+	const qint64 size = mSocket.mReadBuffer.size();
+	mReadableSize = 0;
+	while (mReadableSize < size)
+	{
+		mReadableSize = qMin(mReadableSize + pChunkSize, size);
+		Q_EMIT readyRead();
+	}
+	mReadableSize = -1;
+}
@@ -10,6 +10,7 @@
 
 #include <http_parser.h>
 #include <QNetworkReply>
+#include <QSslConfiguration>
 
 class test_StateCheckRefreshAddress;
 class test_StateGetSelfAuthenticationData;
@@ -26,6 +27,21 @@ class MockNetworkReply
 		friend class ::test_StateCheckRefreshAddress;
 		friend class ::test_StateGetSelfAuthenticationData;
 		MockSocket mSocket;
+		qint64 mReadableSize;
+		QSslConfiguration mSslConfiguration;
+
+	protected:
+		void sslConfigurationImplementation(QSslConfiguration& pConfiguration) const override
+		{
+			pConfiguration = mSslConfiguration;
+		}
+
+
+		void setSslConfigurationImplementation(const QSslConfiguration& pConfiguration) override
+		{
+			mSslConfiguration = pConfiguration;
+		}
+
 
 	public:
 		MockNetworkReply(const QByteArray& pData = QByteArray(), http_status pStatusCode = HTTP_STATUS_OK, QObject* pParent = nullptr);
@@ -50,6 +66,13 @@ class MockNetworkReply
 		}
 
 
+		/*!
+		 * Emits readyRead for every chunk of pChunkSize bytes. While a signal is
+		 * handled only the data up to the end of the current chunk is readable.
+		 */
+		void fireReadyReadChunked(int pChunkSize);
+
+
 		void setNetworkError(NetworkError pErrorCode, const QString& pErrorString)
 		{
 			setError(pErrorCode, pErrorString);
@@ -59,7 +59,7 @@ void MockRemoteDispatcher::send(const QSharedPointer<const RemoteMessage>& pMess
 		ReaderInfo info(QStringLiteral("NFC Reader"), ReaderManagerPlugInType::PCSC, CardInfo(withCard ? CardType::EID_CARD : CardType::NONE));
 		info.setConnected(true);
 		const QSharedPointer<RemoteMessage> message(new IfdStatus(info));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), RemoteMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 		return;
 	}
 
@@ -70,7 +70,7 @@ void MockRemoteDispatcher::send(const QSharedPointer<const RemoteMessage>& pMess
 		const QSharedPointer<const IfdConnect> request = pMessage.staticCast<const IfdConnect>();
 		const QString readerName = request->getSlotName();
 		const QSharedPointer<RemoteMessage> message(new IfdConnectResponse(readerName, resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), RemoteMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 
 	if (pMessage->getType() == RemoteCardMessageType::IFDTransmit)
@@ -78,7 +78,7 @@ void MockRemoteDispatcher::send(const QSharedPointer<const RemoteMessage>& pMess
 		const QSharedPointer<const IfdTransmit> request = pMessage.staticCast<const IfdTransmit>();
 		const QString readerName = request->getSlotHandle();
 		const QSharedPointer<RemoteMessage> message(new IfdTransmitResponse(readerName, resultMinor == ECardApiResult::Minor::null ? QByteArray("pong") : QByteArray(), resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), RemoteMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 
 	if (pMessage->getType() == RemoteCardMessageType::IFDDisconnect)
@@ -86,7 +86,7 @@ void MockRemoteDispatcher::send(const QSharedPointer<const RemoteMessage>& pMess
 		const QSharedPointer<const IfdDisconnect> request = pMessage.staticCast<const IfdDisconnect>();
 		const QString readerName = request->getSlotHandle();
 		const QSharedPointer<RemoteMessage> message(new IfdDisconnectResponse(readerName, resultMinor));
-		Q_EMIT fireReceived(message->getType(), QJsonDocument::fromJson(message->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+		Q_EMIT fireReceived(message->getType(), RemoteMessage::parseByteArray(message->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 	}
 }
 
@@ -111,5 +111,5 @@ void MockRemoteDispatcher::onClosed()
 
 void MockRemoteDispatcher::onReceived(const QSharedPointer<const RemoteMessage>& pMessage)
 {
-	Q_EMIT fireReceived(pMessage->getType(), QJsonDocument::fromJson(pMessage->toByteArray(IfdVersion::Version::v2, mContextHandle)).object(), mId);
+	Q_EMIT fireReceived(pMessage->getType(), RemoteMessage::parseByteArray(pMessage->toByteArray(IfdVersion::Version::v2, mContextHandle)), mId);
 }
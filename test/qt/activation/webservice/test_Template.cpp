@@ -84,6 +84,82 @@ class test_Template
 		}
 
 
+		void renderPlaceholderSyntax_data()
+		{
+			QTest::addColumn<QString>("source");
+			QTest::addColumn<int>("keys");
+			QTest::addColumn<QString>("output");
+
+			QTest::newRow("text") << QStringLiteral("no keys") << 0 << QStringLiteral("no keys");
+			QTest::newRow("key") << QStringLiteral("a ${KEY_1} b") << 1 << QStringLiteral("a la b");
+			QTest::newRow("unclosed") << QStringLiteral("a ${KEY_1 b") << 0 << QStringLiteral("a ${KEY_1 b");
+			QTest::newRow("dollar") << QStringLiteral("$${KEY_1}$") << 1 << QStringLiteral("$la$");
+			QTest::newRow("nested") << QStringLiteral("${${KEY_1}}") << 1 << QStringLiteral("${la}");
+			QTest::newRow("empty key") << QStringLiteral("a${}b") << 1 << QStringLiteral("ab");
+			QTest::newRow("adjacent") << QStringLiteral("${KEY_1}${KEY_1}") << 1 << QStringLiteral("lala");
+		}
+
+
+		void renderPlaceholderSyntax()
+		{
+			QFETCH(QString, source);
+			QFETCH(int, keys);
+			QFETCH(QString, output);
+
+			Template tplt(source);
+			QCOMPARE(tplt.getContextKeys().size(), keys);
+			if (keys > 0 && tplt.getContextKeys().contains(KEY_1))
+			{
+				tplt.setContextParameter(KEY_1, QStringLiteral("la"));
+			}
+			else if (keys > 0)
+			{
+				QTest::ignoreMessage(QtWarningMsg, "No parameter specified, replace with empty string \"\"");
+			}
+			QCOMPARE(tplt.render(), output);
+		}
+
+
+		void renderValueIsNotExpanded()
+		{
+			Template tplt(QStringLiteral("${KEY_1}${KEY_2}"));
+
+			tplt.setContextParameter(KEY_1, QStringLiteral("${KEY_2}"));
+			tplt.setContextParameter(KEY_2, QStringLiteral("le"));
+			QCOMPARE(tplt.render(), QLatin1String("${KEY_2}le"));
+		}
+
+
+		void fromFileIsCompiledOnce()
+		{
+			Template::clearCache();
+
+			Template first = Template::fromFile(QStringLiteral(":/html_templates/error.html"));
+			Template second = Template::fromFile(QStringLiteral(":/html_templates/error.html"));
+			QCOMPARE(second.mCompiled.data(), first.mCompiled.data());
+
+			first.setContextParameter(QStringLiteral("TITLE"), QStringLiteral("first"));
+			QVERIFY(!second.render().contains(QLatin1String("first")));
+
+			QTest::ignoreMessage(QtCriticalMsg, "Template file not found \":/html_templates/unknown.html\"");
+			QCOMPARE(Template::fromFile(QStringLiteral(":/html_templates/unknown.html")).getContextKeys().size(), 0);
+		}
+
+
+		void benchmarkRender()
+		{
+			QBENCHMARK
+			{
+				Template tplt = Template::fromFile(QStringLiteral(":/html_templates/error.html"));
+				for (const auto& key : tplt.getContextKeys())
+				{
+					tplt.setContextParameter(key, key);
+				}
+				QVERIFY(!tplt.render().isEmpty());
+			}
+		}
+
+
 		void renderErrorPage()
 		{
 			QString title("test titel");
@@ -10,6 +10,8 @@
 #include "MockSocket.h"
 #include "ResourceLoader.h"
 
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
 #include <QtCore>
 #include <QtTest>
 
@@ -306,6 +308,77 @@ class test_WebserviceActivationHandler
 		}
 
 
+		void benchmarkResponses_data()
+		{
+			QTest::addColumn<QByteArray>("url");
+			QTest::addColumn<QByteArray>("status");
+
+			QTest::newRow("status") << QByteArray("http://localhost:24727/eID-Client?status") << QByteArray("HTTP/1.0 200 OK");
+			QTest::newRow("status json") << QByteArray("http://localhost:24727/eID-Client?status=json") << QByteArray("HTTP/1.0 200 OK");
+			QTest::newRow("error") << QByteArray("http://localhost:24727/eID-Client?unknownRequest") << QByteArray("HTTP/1.0 404 Not Found");
+		}
+
+
+		void benchmarkResponses()
+		{
+			QFETCH(QByteArray, url);
+			QFETCH(QByteArray, status);
+
+			QBENCHMARK
+			{
+				auto* socket = new MockSocket();
+				const auto request = QSharedPointer<HttpRequest>::create(socket);
+				request->mUrl = url;
+				mHandler.onNewRequest(request);
+				QVERIFY(socket->mWriteBuffer.startsWith(status));
+			}
+		}
+
+
+		void loadStatus_data()
+		{
+			QTest::addColumn<int>("idleTimeout");
+
+			QTest::newRow("keep-alive") << HttpServer::cIdleTimeout;
+			QTest::newRow("close") << 0;
+		}
+
+
+		void loadStatus()
+		{
+			QFETCH(int, idleTimeout);
+
+			const auto port = HttpServer::cPort;
+			const auto timeout = HttpServer::cIdleTimeout;
+			HttpServer::cPort = 0;
+			HttpServer::cIdleTimeout = idleTimeout;
+			const auto resetServerSettings = qScopeGuard([port, timeout] {
+					HttpServer::cPort = port;
+					HttpServer::cIdleTimeout = timeout;
+				});
+
+			WebserviceActivationHandler handler;
+			QVERIFY(handler.start());
+			const QUrl url(QStringLiteral("http://127.0.0.1:%1/eID-Client?status").arg(handler.mServer->getServerPort()));
+
+			const int requests = 200;
+			QNetworkAccessManager accessManager;
+			QElapsedTimer timer;
+			timer.start();
+			for (int i = 0; i < requests; ++i)
+			{
+				QScopedPointer<QNetworkReply> reply(accessManager.get(QNetworkRequest(url)));
+				QSignalSpy spyFinished(reply.data(), &QNetworkReply::finished);
+				QVERIFY(spyFinished.wait());
+				QCOMPARE(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), 200);
+			}
+
+			const auto elapsed = qMax<qint64>(timer.elapsed(), 1);
+			qInfo() << "Status endpoint:" << requests * 1000 / elapsed << "requests/second";
+			handler.stop();
+		}
+
+
 		void test_GuessImageContentType_data()
 		{
 			QTest::addColumn<QString>("fileName");
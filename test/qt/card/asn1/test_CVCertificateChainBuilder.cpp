@@ -73,6 +73,12 @@ class test_CVCertificateChainBuilder
 		}
 
 
+		void init()
+		{
+			CVCertificateChainBuilder::clearVerifiedChains();
+		}
+
+
 		void productionAndTestEnvironment()
 		{
 			CVCertificateChainBuilder builderProduction(true);
@@ -424,6 +430,96 @@ class test_CVCertificateChainBuilder
 		}
 
 
+		void duplicates_getChainStartingWith()
+		{
+			QVector<QSharedPointer<const CVCertificate> > list;
+			list.append(mCvca_DETESTeID00004);
+			list.append(CVCertificate::fromHex(readFile("cvca-DETESTeID00004.hex")));
+			list.append(mCvdv_DEDVeIDDPST00035);
+			list.append(mCvdv_DEDVeIDDPST00035);
+			list.append(mCvat_DEDEMODEV00038);
+			list.append(CVCertificate::fromHex(readFile("cvat-DEDEMODEV00038.hex")));
+			CVCertificateChainBuilder builder(list, false);
+
+			QCOMPARE(builder.mCertificatesByChr.size(), 3);
+			QCOMPARE(builder.mCertificatesByCar.size(), 2);
+
+			CVCertificateChain chain = builder.getChainStartingWith(mCvca_DETESTeID00004);
+			QVERIFY(chain.isValid());
+			QCOMPARE(chain.size(), 3);
+		}
+
+
+		void verifiedChain_getChainStartingWith()
+		{
+			QVector<QSharedPointer<const CVCertificate> > list;
+			list.append(mCvca_DETESTeID00004_DETESTeID00002);
+			list.append(mCvca_DETESTeID00002);
+			list.append(mCvca_DETESTeID00002_DETESTeID00001);
+			list.append(mCvca_DETESTeID00001);
+			list.append(mCvdv_DEDVeIDDPST00035);
+			list.append(mCvat_DEDEMODEV00038);
+			const CVCertificateChain verifiedChain = CVCertificateChainBuilder(list, false).getChainStartingWith(mCvca_DETESTeID00001);
+			QVERIFY(verifiedChain.isValid());
+			QCOMPARE(verifiedChain.size(), 5);
+
+			// without the link certificates the chain is only found after it was verified
+			const QVector<QSharedPointer<const CVCertificate> > pool({mCvca_DETESTeID00001, mCvdv_DEDVeIDDPST00035, mCvat_DEDEMODEV00038});
+			const QVector<QSharedPointer<const CVCertificate> > trustAnchors({mCvca_DETESTeID00001, mCvca_DETESTeID00005});
+			QVERIFY(!CVCertificateChainBuilder(pool, false).getChainStartingWith(mCvca_DETESTeID00001, trustAnchors).isValid());
+
+			CVCertificateChainBuilder::addVerifiedChain(verifiedChain, trustAnchors);
+			CVCertificateChainBuilder::addVerifiedChain(verifiedChain, trustAnchors);
+
+			CVCertificateChain chain = CVCertificateChainBuilder(pool, false).getChainStartingWith(mCvca_DETESTeID00001, trustAnchors);
+			QVERIFY(chain.isValid());
+			QCOMPARE(chain.size(), 5);
+			for (int i = 0; i < chain.size(); ++i)
+			{
+				QVERIFY(*chain.at(i) == *verifiedChain.at(i));
+			}
+
+			// the order of the trust anchors does not matter
+			const QVector<QSharedPointer<const CVCertificate> > reorderedTrustAnchors({mCvca_DETESTeID00005, mCvca_DETESTeID00001});
+			QVERIFY(CVCertificateChainBuilder(pool, false).getChainStartingWith(mCvca_DETESTeID00001, reorderedTrustAnchors).isValid());
+
+			// the DV and the terminal certificate must still be part of the pool
+			QVERIFY(!CVCertificateChainBuilder({mCvca_DETESTeID00001, mCvdv_DEDVeIDDPST00035}, false).getChainStartingWith(mCvca_DETESTeID00001, trustAnchors).isValid());
+
+			// the environment must match
+			QVERIFY(!CVCertificateChainBuilder(pool, true).getChainStartingWith(mCvca_DETESTeID00001, trustAnchors).isValid());
+
+			// the trust anchors must match
+			QVERIFY(!CVCertificateChainBuilder(pool, false).getChainStartingWith(mCvca_DETESTeID00001).isValid());
+			QVERIFY(!CVCertificateChainBuilder(pool, false).getChainStartingWith(mCvca_DETESTeID00001, {mCvca_DETESTeID00001}).isValid());
+		}
+
+
+		void benchmark()
+		{
+			QVector<QSharedPointer<const CVCertificate> > list;
+			list.append(mCvca_DETESTeID00005);
+			list.append(mCvca_DETESTeID00005_DETESTeID00004);
+			list.append(mCvca_DETESTeID00004);
+			list.append(mCvca_DETESTeID00004_DETESTeID00002);
+			list.append(mCvca_DETESTeID00002);
+			list.append(mCvca_DETESTeID00002_DETESTeID00001);
+			list.append(mCvca_DETESTeID00001);
+			list.append(mCvdv_DEDVeIDDPST00035);
+			list.append(mCvat_DEDEMODEV00038);
+			list.append(mCvdv_DEDVtIDGVNK00005);
+			list.append(mCvat_DEDEVDEMO00020);
+			const auto output = createPaceOutput(mCvca_DETESTeID00002, mCvca_DETESTeID00002);
+
+			QBENCHMARK
+			{
+				CVCertificateChainBuilder builder(list, false);
+				QVERIFY(builder.getChainStartingWith(mCvca_DETESTeID00001).isValid());
+				QVERIFY(builder.getChainForCertificationAuthority(output).isValid());
+			}
+		}
+
+
 };
 
 
@@ -0,0 +1,127 @@
+/*!
+ * \brief Unit tests for \ref CVCertificatePool
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "asn1/CVCertificatePool.h"
+
+#include "asn1/ASN1TemplateUtil.h"
+#include "TestFileHelper.h"
+
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_CVCertificatePool
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static QByteArray readDer(const QString& pName)
+		{
+			return QByteArray::fromHex(TestFileHelper::readFile(pName));
+		}
+
+	private Q_SLOTS:
+		void identicalCertificatesAreShared()
+		{
+			CVCertificatePool pool;
+			const auto der = readDer(":/card/cvca-DETESTeID00001.hex");
+
+			const auto cvc = pool.get(der);
+			QVERIFY(cvc);
+			QCOMPARE(pool.getMissCount(), 1);
+			QCOMPARE(pool.getHitCount(), 0);
+
+			const auto other = pool.get(QByteArray(der));
+			QCOMPARE(other.data(), cvc.data());
+			QCOMPARE(pool.getMissCount(), 1);
+			QCOMPARE(pool.getHitCount(), 1);
+			QCOMPARE(pool.size(), 1);
+
+			const auto dv = pool.get(readDer(":/card/cvdv-DEDVeIDDPST00035.hex"));
+			QVERIFY(dv);
+			QVERIFY(dv.data() != cvc.data());
+			QCOMPARE(pool.size(), 2);
+		}
+
+
+		void invalidCertificate()
+		{
+			CVCertificatePool pool;
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("Cannot decode ASN.1 object")));
+			QVERIFY(pool.get(QByteArray::fromHex("7f2100")).isNull());
+			QCOMPARE(pool.size(), 0);
+		}
+
+
+		void weakReferences()
+		{
+			CVCertificatePool pool;
+			const auto der = readDer(":/card/cvca-DETESTeID00001.hex");
+
+			QVERIFY(pool.get(der));
+			QCOMPARE(pool.size(), 0);
+			QVERIFY(pool.get(der));
+			QCOMPARE(pool.getMissCount(), 2);
+
+			QVERIFY(pool.get(der, true));
+			QCOMPARE(pool.size(), 1);
+			QVERIFY(pool.get(der));
+			QCOMPARE(pool.getHitCount(), 1);
+
+			pool.clear();
+			QCOMPARE(pool.size(), 0);
+		}
+
+
+		void fromHex()
+		{
+			const auto hex = TestFileHelper::readFile(":/card/cvca-DETESTeID00002_DETESTeID00001.hex");
+			const auto cvc = CVCertificate::fromHex(hex);
+			QCOMPARE(CVCertificate::fromHex(hex).data(), cvc.data());
+			QCOMPARE(CVCertificate::fromHex(QByteArrayList({hex, hex})).size(), 2);
+			QCOMPARE(CVCertificate::fromHex(QByteArrayList({hex})).at(0).data(), cvc.data());
+		}
+
+
+		void benchmark_data()
+		{
+			QTest::addColumn<bool>("pooled");
+
+			QTest::newRow("decode") << false;
+			QTest::newRow("pool") << true;
+		}
+
+
+		void benchmark()
+		{
+			QFETCH(bool, pooled);
+
+			CVCertificatePool pool;
+			const auto der = readDer(":/card/cvdv-DEDVeIDDPST00035.hex");
+			const auto cvc = pool.get(der);
+
+			QBENCHMARK
+			{
+				if (pooled)
+				{
+					QVERIFY(pool.get(der));
+				}
+				else
+				{
+					QVERIFY(decodeObject<CVCertificate>(der));
+				}
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_CVCertificatePool)
+#include "test_CVCertificatePool.moc"
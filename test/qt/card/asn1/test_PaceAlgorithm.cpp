@@ -0,0 +1,104 @@
+/*!
+ * \brief Unit tests for \ref PaceAlgorithm
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "asn1/PaceAlgorithm.h"
+
+#include "asn1/KnownOIDs.h"
+
+#include <QtCore>
+#include <QtTest>
+
+using namespace governikus;
+
+class test_PaceAlgorithm
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void fromOid_data()
+		{
+			QTest::addColumn<QByteArray>("oid");
+			QTest::addColumn<KeyAgreementType>("keyAgreementType");
+			QTest::addColumn<MappingType>("mappingType");
+			QTest::addColumn<bool>("supported");
+			QTest::addColumn<int>("keySize");
+			QTest::addColumn<int>("hashAlgorithm");
+
+			using namespace KnownOIDs;
+			const int sha1 = QCryptographicHash::Sha1;
+			const int sha256 = QCryptographicHash::Sha256;
+
+			QTest::newRow("DH_GM_3DES") << toByteArray(id_PACE::DH::GM_3DES_CBC_CBC) << KeyAgreementType::DH << MappingType::GM << false << 16 << sha1;
+			QTest::newRow("DH_GM_AES_128") << toByteArray(id_PACE::DH::GM_AES_CBC_CMAC_128) << KeyAgreementType::DH << MappingType::GM << true << 16 << sha1;
+			QTest::newRow("DH_GM_AES_192") << toByteArray(id_PACE::DH::GM_AES_CBC_CMAC_192) << KeyAgreementType::DH << MappingType::GM << true << 24 << sha256;
+			QTest::newRow("DH_GM_AES_256") << toByteArray(id_PACE::DH::GM_AES_CBC_CMAC_256) << KeyAgreementType::DH << MappingType::GM << true << 32 << sha256;
+			QTest::newRow("ECDH_GM_3DES") << toByteArray(id_PACE::ECDH::GM_3DES_CBC_CBC) << KeyAgreementType::ECDH << MappingType::GM << false << 16 << sha1;
+			QTest::newRow("ECDH_GM_AES_128") << toByteArray(id_PACE::ECDH::GM_AES_CBC_CMAC_128) << KeyAgreementType::ECDH << MappingType::GM << true << 16 << sha1;
+			QTest::newRow("ECDH_GM_AES_192") << toByteArray(id_PACE::ECDH::GM_AES_CBC_CMAC_192) << KeyAgreementType::ECDH << MappingType::GM << true << 24 << sha256;
+			QTest::newRow("ECDH_GM_AES_256") << toByteArray(id_PACE::ECDH::GM_AES_CBC_CMAC_256) << KeyAgreementType::ECDH << MappingType::GM << true << 32 << sha256;
+			QTest::newRow("DH_IM_3DES") << toByteArray(id_PACE::DH::IM_3DES_CBC_CBC) << KeyAgreementType::DH << MappingType::IM << false << 16 << sha1;
+			QTest::newRow("DH_IM_AES_128") << toByteArray(id_PACE::DH::IM_AES_CBC_CMAC_128) << KeyAgreementType::DH << MappingType::IM << true << 16 << sha1;
+			QTest::newRow("DH_IM_AES_192") << toByteArray(id_PACE::DH::IM_AES_CBC_CMAC_192) << KeyAgreementType::DH << MappingType::IM << true << 24 << sha256;
+			QTest::newRow("DH_IM_AES_256") << toByteArray(id_PACE::DH::IM_AES_CBC_CMAC_256) << KeyAgreementType::DH << MappingType::IM << true << 32 << sha256;
+			QTest::newRow("ECDH_IM_3DES") << toByteArray(id_PACE::ECDH::IM_3DES_CBC_CBC) << KeyAgreementType::ECDH << MappingType::IM << false << 16 << sha1;
+			QTest::newRow("ECDH_IM_AES_128") << toByteArray(id_PACE::ECDH::IM_AES_CBC_CMAC_128) << KeyAgreementType::ECDH << MappingType::IM << true << 16 << sha1;
+			QTest::newRow("ECDH_IM_AES_192") << toByteArray(id_PACE::ECDH::IM_AES_CBC_CMAC_192) << KeyAgreementType::ECDH << MappingType::IM << true << 24 << sha256;
+			QTest::newRow("ECDH_IM_AES_256") << toByteArray(id_PACE::ECDH::IM_AES_CBC_CMAC_256) << KeyAgreementType::ECDH << MappingType::IM << true << 32 << sha256;
+		}
+
+
+		void fromOid()
+		{
+			QFETCH(QByteArray, oid);
+			QFETCH(KeyAgreementType, keyAgreementType);
+			QFETCH(MappingType, mappingType);
+			QFETCH(bool, supported);
+			QFETCH(int, keySize);
+			QFETCH(int, hashAlgorithm);
+
+			const auto* algorithm = PaceAlgorithm::fromOid(oid);
+			QVERIFY(algorithm);
+			QCOMPARE(QByteArray(algorithm->mOid), oid);
+			QCOMPARE(algorithm->mKeyAgreementType, keyAgreementType);
+			QCOMPARE(algorithm->mMappingType, mappingType);
+			QCOMPARE(algorithm->isSupported(), supported);
+			QCOMPARE(algorithm->getCipher() != nullptr, supported);
+			QCOMPARE(algorithm->mKeySize, keySize);
+			QCOMPARE(static_cast<int>(algorithm->mHashAlgorithm), hashAlgorithm);
+			if (supported)
+			{
+				QCOMPARE(EVP_CIPHER_key_length(algorithm->getCipher()), keySize);
+			}
+		}
+
+
+		void unknownOid_data()
+		{
+			QTest::addColumn<QByteArray>("oid");
+
+			QTest::newRow("empty") << QByteArray();
+			QTest::newRow("pace") << toByteArray(KnownOIDs::SecurityProtocol::ID_PACE);
+			QTest::newRow("pace_dh_gm") << toByteArray(KnownOIDs::id_PACE::DH::GM);
+			QTest::newRow("ca") << toByteArray(KnownOIDs::id_ca::ECDH_AES_CBC_CMAC_128);
+			QTest::newRow("suffix") << QByteArray("0.4.0.127.0.7.2.2.4.2.2.1");
+			QTest::newRow("before") << QByteArray("0.4.0.127.0.7.2.2.4.0.1");
+			QTest::newRow("after") << QByteArray("0.4.0.127.0.7.2.2.4.5.1");
+		}
+
+
+		void unknownOid()
+		{
+			QFETCH(QByteArray, oid);
+
+			QVERIFY(PaceAlgorithm::fromOid(oid) == nullptr);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_PaceAlgorithm)
+#include "test_PaceAlgorithm.moc"
@@ -0,0 +1,96 @@
+/*!
+ * \brief Unit tests for \ref SignatureCache
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "asn1/SignatureCache.h"
+
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_SignatureCache
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		const QDateTime mNow = QDateTime(QDate(2020, 5, 25), QTime(12, 0), Qt::UTC);
+
+	private Q_SLOTS:
+		void createKey()
+		{
+			const auto key = SignatureCache::createKey("publicKey", "hash", "signature");
+			QCOMPARE(key, SignatureCache::createKey("publicKey", "hash", "signature"));
+			QVERIFY(key != SignatureCache::createKey("otherKey", "hash", "signature"));
+			QVERIFY(key != SignatureCache::createKey("publicKey", "otherHash", "signature"));
+			QVERIFY(key != SignatureCache::createKey("publicKey", "hash", "otherSignature"));
+			QVERIFY(key != SignatureCache::createKey("publicKeyh", "ash", "signature"));
+		}
+
+
+		void hitAndMiss()
+		{
+			SignatureCache cache;
+			const auto key = SignatureCache::createKey("publicKey", "hash", "signature");
+
+			QVERIFY(!cache.isVerified(key, mNow));
+			QCOMPARE(cache.getHitCount(), 0);
+			QCOMPARE(cache.getMissCount(), 1);
+
+			cache.addVerified(key, mNow.addDays(1), mNow);
+			QCOMPARE(cache.size(), 1);
+			QVERIFY(cache.isVerified(key, mNow));
+			QCOMPARE(cache.getHitCount(), 1);
+			QCOMPARE(cache.getMissCount(), 1);
+
+			QVERIFY(!cache.isVerified(SignatureCache::createKey("publicKey", "hash", "otherSignature"), mNow));
+			QCOMPARE(cache.getHitCount(), 1);
+			QCOMPARE(cache.getMissCount(), 2);
+
+			cache.clear();
+			QCOMPARE(cache.size(), 0);
+			QVERIFY(!cache.isVerified(key, mNow));
+		}
+
+
+		void expiration()
+		{
+			SignatureCache cache;
+			const auto key = SignatureCache::createKey("publicKey", "hash", "signature");
+
+			cache.addVerified(key, mNow.addSecs(-1), mNow);
+			QCOMPARE(cache.size(), 0);
+
+			cache.addVerified(key, QDateTime(), mNow);
+			QCOMPARE(cache.size(), 0);
+
+			cache.addVerified(key, mNow.addDays(1), mNow);
+			QVERIFY(cache.isVerified(key, mNow.addDays(1)));
+			QVERIFY(!cache.isVerified(key, mNow.addDays(1).addSecs(1)));
+			QCOMPARE(cache.size(), 0);
+			QVERIFY(!cache.isVerified(key, mNow));
+		}
+
+
+		void bounded()
+		{
+			SignatureCache cache;
+			for (int i = 0; i <= SignatureCache::MAX_ENTRIES; ++i)
+			{
+				cache.addVerified(SignatureCache::createKey("publicKey", QByteArray::number(i), "signature"), mNow.addDays(1), mNow);
+			}
+
+			QCOMPARE(cache.size(), SignatureCache::MAX_ENTRIES);
+			QVERIFY(!cache.isVerified(SignatureCache::createKey("publicKey", "0", "signature"), mNow));
+			QVERIFY(cache.isVerified(SignatureCache::createKey("publicKey", QByteArray::number(SignatureCache::MAX_ENTRIES), "signature"), mNow));
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_SignatureCache)
+#include "test_SignatureCache.moc"
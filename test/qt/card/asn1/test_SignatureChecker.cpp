@@ -14,6 +14,7 @@
 #include <openssl/obj_mac.h>
 
 #include "asn1/CVCertificate.h"
+#include "asn1/SignatureCache.h"
 #include "asn1/SignatureChecker.h"
 #include "TestFileHelper.h"
 #include <QDebug>
@@ -106,6 +107,61 @@ class test_SignatureChecker
 		}
 
 
+		void verifyCachedChain()
+		{
+			const QDateTime validationDate(QDate(2020, 5, 25), QTime(12, 0), Qt::UTC);
+			auto* cache = Env::getSingleton<SignatureCache>();
+			cache->clear();
+			const int hits = cache->getHitCount();
+
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			QCOMPARE(cache->getHitCount(), hits);
+			QCOMPARE(cache->size(), cvcs.size());
+
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			QCOMPARE(cache->getHitCount(), hits + cvcs.size());
+
+			// expired certificates are verified again
+			QVERIFY(SignatureChecker(cvcs, validationDate.addYears(10)).check());
+			QCOMPARE(cache->getHitCount(), hits + cvcs.size());
+			QCOMPARE(cache->size(), 0);
+
+			// a cached chain does not hide a broken signature
+			QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			auto certs = cvcs;
+			certs.removeAt(2);
+			QVERIFY(!SignatureChecker(certs, validationDate).check());
+		}
+
+
+		void benchmark_data()
+		{
+			QTest::addColumn<bool>("cached");
+
+			QTest::newRow("uncached") << false;
+			QTest::newRow("cached") << true;
+		}
+
+
+		void benchmark()
+		{
+			QFETCH(bool, cached);
+
+			const QDateTime validationDate(QDate(2020, 5, 25), QTime(12, 0), Qt::UTC);
+			auto* cache = Env::getSingleton<SignatureCache>();
+			cache->clear();
+
+			QBENCHMARK
+			{
+				if (!cached)
+				{
+					cache->clear();
+				}
+				QVERIFY(SignatureChecker(cvcs, validationDate).check());
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_SignatureChecker)
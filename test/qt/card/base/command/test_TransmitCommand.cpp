@@ -219,6 +219,44 @@ class test_TransmitCommand
 		}
 
 
+		void test_InternalExecuteBatch()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			QVector<InputAPDUInfo> inputApduInfos(3);
+			inputApduInfos[1].addAcceptableStatusCode(QByteArray("9000"));
+			QSharedPointer<MockCardConnectionWorker> worker(new MockCardConnectionWorker());
+
+			worker->setBatchResponses({
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))},
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("6300"))}
+					});
+			TransmitCommand command1(worker, inputApduInfos, QStringLiteral("slotname"));
+			command1.internalExecute();
+			QCOMPARE(command1.getOutputApduAsHex(), QByteArrayList({"9000", "6300"}));
+			QCOMPARE(command1.getReturnCode(), CardReturnCode::UNEXPECTED_TRANSMIT_STATUS);
+			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("Transmit unsuccessful. StatusCode does not start with acceptable status code")));
+
+			worker->setBatchResponses({
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))},
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))},
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("6a82"))}
+					});
+			TransmitCommand command2(worker, inputApduInfos, QStringLiteral("slotname"));
+			command2.internalExecute();
+			QCOMPARE(command2.getOutputApduAsHex(), QByteArrayList({"9000", "9000", "6a82"}));
+			QCOMPARE(command2.getReturnCode(), CardReturnCode::OK);
+
+			worker->setBatchResponses({
+						{CardReturnCode::OK, ResponseApdu(QByteArray::fromHex("9000"))}
+					});
+			TransmitCommand command3(worker, inputApduInfos, QStringLiteral("slotname"));
+			command3.internalExecute();
+			QCOMPARE(command3.getOutputApduAsHex(), QByteArrayList({"9000"}));
+			QCOMPARE(command3.getReturnCode(), CardReturnCode::COMMAND_FAILED);
+		}
+
+
 		void test_SlotHandle()
 		{
 			QVector<InputAPDUInfo> inputApduInfos(1);
@@ -130,6 +130,92 @@ class test_CardConnectionWorker
 		}
 
 
+		void test_ReadFile()
+		{
+			QByteArray content;
+
+			//no card
+			QCOMPARE(mWorker->readFile(FileRef::efCardAccess(), content), CardReturnCode::CARD_NOT_FOUND);
+
+			QVector<TransmitConfig> transmitConfigs;
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("0102039000")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("04056282")));
+			mReader->setCard(MockCardConfig(transmitConfigs));
+
+			QCOMPARE(mWorker->readFile(FileRef::efCardAccess(), content), CardReturnCode::OK);
+			QCOMPARE(content, QByteArray::fromHex("0102030405"));
+
+			//no more responses configured, so the content has to be cached
+			QByteArray cachedContent;
+			QCOMPARE(mWorker->readFile(FileRef::efCardAccess(), cachedContent), CardReturnCode::OK);
+			QCOMPARE(cachedContent, content);
+		}
+
+
+		void test_ReadFileCacheDroppedOnPace()
+		{
+			QVector<TransmitConfig> transmitConfigs;
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("0102036282")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("0405066282")));
+			mReader->setCard(MockCardConfig(transmitConfigs));
+			mReader->getReaderInfo().setBasicReader(false);
+
+			QByteArray content;
+			QCOMPARE(mWorker->readFile(FileRef::efCardAccess(), content), CardReturnCode::OK);
+			QCOMPARE(content, QByteArray::fromHex("010203"));
+
+			QTest::ignoreMessage(QtInfoMsg, "Starting PACE for PACE_PIN");
+			QTest::ignoreMessage(QtInfoMsg, "Finished PACE for PACE_PIN with result COMMAND_FAILED");
+			QTest::ignoreMessage(QtWarningMsg, "Establishment of PACE channel not supported");
+			mWorker->establishPaceChannel(PacePasswordId::PACE_PIN, QByteArray());
+
+			//the file has to be read again after PACE
+			QByteArray newContent;
+			QCOMPARE(mWorker->readFile(FileRef::efCardAccess(), newContent), CardReturnCode::OK);
+			QCOMPARE(newContent, QByteArray::fromHex("040506"));
+		}
+
+
+		void test_ReadFileExtendedLengthFallback_data()
+		{
+			QTest::addColumn<CardType>("cardType");
+			QTest::addColumn<bool>("reported");
+			QTest::addColumn<CardReturnCode>("returnCode");
+
+			QTest::newRow("eID card") << CardType::EID_CARD << true << CardReturnCode::OK;
+			QTest::newRow("eID card without reported length") << CardType::EID_CARD << false << CardReturnCode::COMMAND_FAILED;
+			QTest::newRow("passport") << CardType::PASSPORT << true << CardReturnCode::COMMAND_FAILED;
+		}
+
+
+		void test_ReadFileExtendedLengthFallback()
+		{
+			QFETCH(CardType, cardType);
+			QFETCH(bool, reported);
+			QFETCH(CardReturnCode, returnCode);
+
+			QVector<TransmitConfig> transmitConfigs;
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("6700")));
+			transmitConfigs.append(TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("0102036282")));
+			mReader->setCard(MockCardConfig(transmitConfigs));
+			mReader->getReaderInfo().setCardInfo(CardInfo(cardType));
+			QVERIFY(!mReader->getReaderInfo().isMaxApduLengthReported());
+			if (reported)
+			{
+				mReader->getReaderInfo().setMaxApduLength(-1);
+			}
+
+			// Without extended length the 6700 is not retried with short APDUs
+			QByteArray content;
+			QCOMPARE(mWorker->readFile(FileRef::efCardSecurity(), content), returnCode);
+			QCOMPARE(content, returnCode == CardReturnCode::OK ? QByteArray::fromHex("010203") : QByteArray());
+		}
+
+
 		void test_UpdateRetryCounter()
 		{
 			//no card
@@ -0,0 +1,187 @@
+/*!
+ * \brief Unit tests for \ref ReaderThread
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "ReaderThread.h"
+
+#include "CardConnectionWorker.h"
+#include "MockReader.h"
+
+#include <QAtomicInt>
+#include <QSemaphore>
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_ReaderThread
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static const int READERS = 4;
+		static const int TIMEOUT = 10000;
+
+		QSharedPointer<CardConnectionWorker> createWorker(MockReader* pReader)
+		{
+			QSharedPointer<CardConnectionWorker> worker;
+			ReaderThread::call(pReader, [pReader] {
+					return pReader->createCardConnectionWorker();
+				}, this, [&worker](const QSharedPointer<CardConnectionWorker>& pWorker) {
+					worker = pWorker;
+				});
+			QTest::qWaitFor([&worker] {
+					return !worker.isNull();
+				}, TIMEOUT);
+			return worker;
+		}
+
+	private Q_SLOTS:
+		void take()
+		{
+			auto* reader = MockReader::createMockReader();
+			QPointer<ReaderThread> readerThread = new ReaderThread(QStringLiteral("reader"));
+			QThread* const thread = readerThread.data();
+			QCOMPARE(readerThread->objectName(), QStringLiteral("ReaderThread: reader"));
+
+			readerThread->take(reader);
+			QCOMPARE(reader->thread(), thread);
+			QCOMPARE(reader->getCard()->thread(), thread);
+
+			QThread* callThread = nullptr;
+			ReaderThread::call(reader, [] {
+					return QThread::currentThread();
+				}, this, [&callThread](QThread* pThread) {
+					callThread = pThread;
+				});
+			QVERIFY(callThread == nullptr);
+			QTRY_COMPARE(callThread, thread); // clazy:exclude=qstring-allocations
+
+			QPointer<Reader> guard(reader);
+			QSignalSpy spyDestroyed(readerThread.data(), &ReaderThread::fireReaderDestroyed);
+			readerThread->destroy(reader);
+			QTRY_COMPARE(spyDestroyed.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(guard.isNull());
+			QCOMPARE(spyDestroyed.at(0).at(0).value<ReaderInfo>().getName(), QStringLiteral("MockReader"));
+			QTRY_VERIFY(readerThread.isNull()); // clazy:exclude=qstring-allocations
+		}
+
+
+		void callInSameThread()
+		{
+			MockReader reader;
+			QString name;
+			ReaderThread::call(&reader, [&reader] {
+					return reader.getName();
+				}, this, [&name](const QString& pName) {
+					name = pName;
+				});
+			QCOMPARE(name, QStringLiteral("MockReader"));
+		}
+
+
+		void retain()
+		{
+			auto* reader = MockReader::createMockReader();
+			QPointer<ReaderThread> readerThread = new ReaderThread(QStringLiteral("reader"));
+			QThread* const thread = readerThread.data();
+			readerThread->take(reader);
+
+			auto worker = createWorker(reader);
+			QVERIFY(worker);
+			QCOMPARE(worker->thread(), thread);
+			auto* const rawThread = readerThread.data();
+			auto* const rawWorker = worker.data();
+			QMetaObject::invokeMethod(rawWorker, [rawThread, rawWorker] {
+					rawThread->retain(rawWorker);
+				}, Qt::BlockingQueuedConnection);
+
+			QPointer<Reader> guard(reader);
+			readerThread->destroy(reader);
+			QTRY_VERIFY(guard.isNull()); // clazy:exclude=qstring-allocations
+			QVERIFY(!readerThread.isNull());
+			QVERIFY(readerThread->isRunning());
+
+			CardReturnCode returnCode = CardReturnCode::UNDEFINED;
+			QMetaObject::invokeMethod(rawWorker, [rawWorker] {
+					return rawWorker->transmit(CommandApdu(QByteArray::fromHex("00A4040C"))).mReturnCode;
+				}, Qt::BlockingQueuedConnection, &returnCode);
+			QCOMPARE(returnCode, CardReturnCode::CARD_NOT_FOUND);
+
+			worker.reset();
+			QTRY_VERIFY(readerThread.isNull()); // clazy:exclude=qstring-allocations
+		}
+
+
+		void concurrentTransmits()
+		{
+			QVector<QPointer<ReaderThread>> threads;
+			QVector<MockReader*> readers;
+			QVector<QSharedPointer<CardConnectionWorker>> workers;
+			for (int i = 0; i < READERS; ++i)
+			{
+				const QString name = QStringLiteral("reader %1").arg(i);
+				auto* reader = new MockReader(name);
+				auto* thread = new ReaderThread(name);
+				thread->take(reader);
+
+				MockCardConfig config(QVector<TransmitConfig>(2, TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000"))));
+				reader->setCard(config);
+
+				workers += createWorker(reader);
+				threads += thread;
+				readers += reader;
+			}
+
+			// Every reader transmits and then waits until all readers have transmitted.
+			// This can only succeed if the readers do not share a single thread.
+			QSemaphore arrived;
+			QSemaphore proceed;
+			QAtomicInt succeeded(0);
+			QAtomicInt done(0);
+			for (int i = 0; i < READERS; ++i)
+			{
+				const auto& worker = workers.at(i);
+				QThread* const thread = threads.at(i).data();
+				QMetaObject::invokeMethod(worker.data(), [worker, thread, &arrived, &proceed, &succeeded, &done] {
+						const CommandApdu command(QByteArray::fromHex("00A4040C"));
+						if (QThread::currentThread() == thread && worker->transmit(command).mReturnCode == CardReturnCode::OK)
+						{
+							succeeded.fetchAndAddOrdered(1);
+						}
+
+						arrived.release();
+						if (proceed.tryAcquire(1, TIMEOUT) && worker->transmit(command).mReturnCode == CardReturnCode::OK)
+						{
+							succeeded.fetchAndAddOrdered(1);
+						}
+						done.fetchAndAddOrdered(1);
+					}, Qt::QueuedConnection);
+			}
+
+			const bool allArrived = arrived.tryAcquire(READERS, TIMEOUT);
+			proceed.release(READERS);
+			QTRY_COMPARE_WITH_TIMEOUT(done.loadAcquire(), READERS, TIMEOUT); // clazy:exclude=qstring-allocations
+			QVERIFY(allArrived);
+			QCOMPARE(succeeded.loadAcquire(), 2 * READERS);
+
+			workers.clear();
+			for (int i = 0; i < READERS; ++i)
+			{
+				threads.at(i)->destroy(readers.at(i));
+			}
+			for (const auto& thread : qAsConst(threads))
+			{
+				QTRY_VERIFY(thread.isNull()); // clazy:exclude=qstring-allocations
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_ReaderThread)
+#include "test_ReaderThread.moc"
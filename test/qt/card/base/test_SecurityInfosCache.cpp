@@ -0,0 +1,111 @@
+/*!
+ * \brief Unit tests for \ref SecurityInfosCache
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "SecurityInfosCache.h"
+
+#include "TestFileHelper.h"
+
+#include <QtTest>
+
+
+using namespace governikus;
+
+
+class test_SecurityInfosCache
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QByteArray mEfCardAccessBytes;
+		QByteArray mEfCardSecurityBytes;
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			mEfCardAccessBytes = QByteArray::fromHex(TestFileHelper::readFile(":/card/efCardAccess.hex"));
+			mEfCardSecurityBytes = QByteArray::fromHex(TestFileHelper::readFile(":/card/efCardSecurity.hex"));
+		}
+
+
+		void efCardAccess()
+		{
+			SecurityInfosCache cache;
+
+			const auto first = cache.getEfCardAccess(mEfCardAccessBytes);
+			QVERIFY(first);
+			QCOMPARE(cache.getHitCount(), 0);
+			QCOMPARE(cache.getMissCount(), 1);
+
+			const auto second = cache.getEfCardAccess(mEfCardAccessBytes);
+			QCOMPARE(second, first);
+			QCOMPARE(cache.getHitCount(), 1);
+			QCOMPARE(cache.getMissCount(), 1);
+		}
+
+
+		void efCardAccessBroken()
+		{
+			SecurityInfosCache cache;
+
+			QVERIFY(!cache.getEfCardAccess(QByteArray::fromHex("3100")));
+			QVERIFY(!cache.getEfCardAccess(QByteArray::fromHex("3100")));
+			QCOMPARE(cache.getHitCount(), 0);
+			QCOMPARE(cache.getMissCount(), 2);
+		}
+
+
+		void efCardSecurity()
+		{
+			SecurityInfosCache cache;
+
+			const auto first = cache.getEfCardSecurity(mEfCardSecurityBytes);
+			QVERIFY(first);
+			QCOMPARE(cache.getEfCardSecurity(mEfCardSecurityBytes), first);
+			QCOMPARE(cache.getHitCount(), 1);
+			QCOMPARE(cache.getMissCount(), 1);
+
+			QVERIFY(!cache.getEfCardSecurity(mEfCardAccessBytes));
+			QCOMPARE(cache.getMissCount(), 2);
+		}
+
+
+		void differentContent()
+		{
+			SecurityInfosCache cache;
+			QVERIFY(cache.getEfCardAccess(mEfCardAccessBytes));
+
+			// a different card with another EF.CardSecurity never gets the cached one
+			const auto& efCardSecurity = cache.getEfCardSecurity(mEfCardSecurityBytes);
+			QVERIFY(efCardSecurity);
+			QVERIFY(!cache.getEfCardSecurity(mEfCardSecurityBytes + '\0'));
+			QCOMPARE(cache.getHitCount(), 0);
+			QCOMPARE(cache.getMissCount(), 3);
+		}
+
+
+		void bounded()
+		{
+			SecurityInfosCache cache;
+			for (int i = 0; i < SecurityInfosCache::MAX_ENTRIES; ++i)
+			{
+				cache.mEfCardAccessEntries += SecurityInfosCache::Entry<EFCardAccess>{QByteArray::number(i), QSharedPointer<EFCardAccess>()};
+			}
+
+			QVERIFY(cache.getEfCardAccess(mEfCardAccessBytes));
+			QCOMPARE(cache.mEfCardAccessEntries.size(), SecurityInfosCache::MAX_ENTRIES);
+			QCOMPARE(cache.mEfCardAccessEntries.last().mHash, QByteArray::number(SecurityInfosCache::MAX_ENTRIES - 2));
+
+			QVERIFY(cache.getEfCardAccess(mEfCardAccessBytes));
+			QCOMPARE(cache.getHitCount(), 1);
+			QCOMPARE(cache.getMissCount(), 1);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_SecurityInfosCache)
+#include "test_SecurityInfosCache.moc"
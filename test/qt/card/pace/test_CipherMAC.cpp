@@ -6,8 +6,14 @@
 #include "pace/CipherMac.h"
 #include "pace/KeyDerivationFunction.h"
 
+#include <openssl/evp.h>
 #include <QtTest>
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	#include <openssl/core_names.h>
+	#include <openssl/params.h>
+#endif
+
 using namespace governikus;
 
 /**
@@ -119,6 +125,82 @@ class test_CipherMAC
 		}
 
 
+		void benchmarkGenerate_data()
+		{
+			QTest::addColumn<QByteArray>("paceAlgo");
+			QTest::addColumn<bool>("rekeying");
+
+			QTest::newRow("AES-128 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_128) << true;
+			QTest::newRow("AES-128 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_128) << false;
+			QTest::newRow("AES-192 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_192) << true;
+			QTest::newRow("AES-192 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_192) << false;
+			QTest::newRow("AES-256 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256) << true;
+			QTest::newRow("AES-256 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256) << false;
+		}
+
+
+		void benchmarkGenerate()
+		{
+			QFETCH(QByteArray, paceAlgo);
+			QFETCH(bool, rekeying);
+
+			KeyDerivationFunction kdf(paceAlgo);
+			const QByteArray key = kdf.mac("123456");
+			const QByteArray data(256, 0x42);
+
+			if (rekeying)
+			{
+#if OPENSSL_VERSION_NUMBER < 0x10101000L || defined(LIBRESSL_VERSION_NUMBER)
+				QSKIP("EVP_PKEY_new_CMAC_key is not available");
+#else
+				// Former behaviour: a new digest context is created and initialised for every MAC
+				const EVP_CIPHER* cipher = key.size() == 16 ? EVP_aes_128_cbc() : (key.size() == 24 ? EVP_aes_192_cbc() : EVP_aes_256_cbc());
+	#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+				const OSSL_PARAM params[] = {
+					OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_CIPHER, const_cast<char*>(EVP_CIPHER_get0_name(cipher)), 0),
+					OSSL_PARAM_construct_end()
+				};
+				const auto mac = QSharedPointer<EVP_MAC>(EVP_MAC_fetch(nullptr, OSSL_MAC_NAME_CMAC, nullptr), &EVP_MAC_free);
+				QVERIFY(mac);
+
+				QBENCHMARK
+				{
+					const auto ctx = QSharedPointer<EVP_MAC_CTX>(EVP_MAC_CTX_new(mac.data()), &EVP_MAC_CTX_free);
+					uchar out[EVP_MAX_MD_SIZE];
+					size_t outLen = sizeof(out);
+					QVERIFY(EVP_MAC_init(ctx.data(), reinterpret_cast<const uchar*>(key.constData()), static_cast<size_t>(key.size()), params));
+					QVERIFY(EVP_MAC_update(ctx.data(), reinterpret_cast<const uchar*>(data.constData()), static_cast<size_t>(data.size())));
+					QVERIFY(EVP_MAC_final(ctx.data(), out, &outLen, sizeof(out)));
+				}
+	#else
+				const auto pkey = QSharedPointer<EVP_PKEY>(EVP_PKEY_new_CMAC_key(nullptr, reinterpret_cast<const uchar*>(key.constData()), static_cast<size_t>(key.size()), cipher), &EVP_PKEY_free);
+				QVERIFY(pkey);
+
+				QBENCHMARK
+				{
+					const auto ctx = QSharedPointer<EVP_MD_CTX>(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+					uchar mac[EVP_MAX_MD_SIZE];
+					size_t macLen = sizeof(mac);
+					QVERIFY(EVP_DigestSignInit(ctx.data(), nullptr, nullptr, nullptr, pkey.data()));
+					QVERIFY(EVP_DigestSignUpdate(ctx.data(), data.constData(), static_cast<size_t>(data.size())));
+					QVERIFY(EVP_DigestSignFinal(ctx.data(), mac, &macLen));
+				}
+	#endif
+#endif
+			}
+			else
+			{
+				CipherMac cipherMac(paceAlgo, key);
+				QVERIFY(cipherMac.isInitialized());
+
+				QBENCHMARK
+				{
+					QCOMPARE(cipherMac.generate(data).size(), 8);
+				}
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_CipherMAC)
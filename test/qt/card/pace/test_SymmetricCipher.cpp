@@ -150,6 +150,82 @@ class test_SymmetricCipher
 		}
 
 
+		void reuseContextWithNewIv()
+		{
+			QByteArray paceAlgo = toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256);
+			KeyDerivationFunction kdf(paceAlgo);
+			QByteArray key = kdf.pi(PIN);
+			SymmetricCipher sc(paceAlgo, key);
+			const QByteArray iv = QByteArray().fill(1, 16);
+
+			const QByteArray encryptedData_withIv0 = sc.encrypt(DATA);
+			sc.setIv(iv);
+			const QByteArray encryptedData_withIv1 = sc.encrypt(DATA);
+
+			SymmetricCipher freshCipher(paceAlgo, key);
+			freshCipher.setIv(iv);
+			QCOMPARE(freshCipher.encrypt(DATA), encryptedData_withIv1);
+			QCOMPARE(freshCipher.decrypt(encryptedData_withIv1), DATA);
+			QVERIFY(encryptedData_withIv0 != encryptedData_withIv1);
+		}
+
+
+		void benchmarkEncrypt_data()
+		{
+			QTest::addColumn<QByteArray>("paceAlgo");
+			QTest::addColumn<bool>("rekeying");
+
+			QTest::newRow("AES-128 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_128) << true;
+			QTest::newRow("AES-128 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_128) << false;
+			QTest::newRow("AES-192 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_192) << true;
+			QTest::newRow("AES-192 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_192) << false;
+			QTest::newRow("AES-256 rekeying") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256) << true;
+			QTest::newRow("AES-256 persistent") << toByteArray(KnownOIDs::id_PACE::ECDH::GM_AES_CBC_CMAC_256) << false;
+		}
+
+
+		void benchmarkEncrypt()
+		{
+			QFETCH(QByteArray, paceAlgo);
+			QFETCH(bool, rekeying);
+
+			KeyDerivationFunction kdf(paceAlgo);
+			const QByteArray key = kdf.enc(PIN);
+			const QByteArray iv(16, 0x00);
+			const QByteArray data(256, 0x42);
+
+			if (rekeying)
+			{
+				// Former behaviour: the key schedule is set up again for every operation
+				const EVP_CIPHER* cipher = key.size() == 16 ? EVP_aes_128_cbc() : (key.size() == 24 ? EVP_aes_192_cbc() : EVP_aes_256_cbc());
+				const auto ctx = QSharedPointer<EVP_CIPHER_CTX>(EVP_CIPHER_CTX_new(), &EVP_CIPHER_CTX_free);
+				QByteArray encryptedData(data.size(), Qt::Uninitialized);
+				auto* output = reinterpret_cast<uchar*>(encryptedData.data());
+
+				QBENCHMARK
+				{
+					int updateLen = 0;
+					int finalLen = 0;
+					QVERIFY(EVP_EncryptInit_ex(ctx.data(), cipher, nullptr, reinterpret_cast<const uchar*>(key.constData()), reinterpret_cast<const uchar*>(iv.constData())));
+					EVP_CIPHER_CTX_set_padding(ctx.data(), 0);
+					QVERIFY(EVP_EncryptUpdate(ctx.data(), output, &updateLen, reinterpret_cast<const uchar*>(data.constData()), data.size()));
+					QVERIFY(EVP_EncryptFinal_ex(ctx.data(), output + updateLen, &finalLen));
+				}
+			}
+			else
+			{
+				SymmetricCipher sc(paceAlgo, key);
+				QVERIFY(sc.isInitialized());
+
+				QBENCHMARK
+				{
+					QVERIFY(sc.setIv(iv));
+					QCOMPARE(sc.encrypt(data).size(), data.size());
+				}
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_SymmetricCipher)
@@ -9,6 +9,7 @@
 #include <QCoreApplication>
 #include <QSharedPointer>
 #include <QSignalSpy>
+#include <QThread>
 #include <QtTest>
 
 Q_IMPORT_PLUGIN(MockReaderManagerPlugIn)
@@ -60,6 +61,7 @@ class test_ReaderManager
 		void cleanup()
 		{
 			MockReaderManagerPlugIn::getInstance().removeAllReader();
+			QTRY_VERIFY(Env::getSingleton<ReaderManager>()->getReaderInfos().isEmpty()); // clazy:exclude=qstring-allocations
 		}
 
 
@@ -226,6 +228,92 @@ class test_ReaderManager
 		}
 
 
+		void readerInfosVersion()
+		{
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			QSignalSpy spyAdded(readerManager, &ReaderManager::fireReaderAdded);
+			QSignalSpy spyRemoved(readerManager, &ReaderManager::fireReaderRemoved);
+
+			const auto version = readerManager->getReaderInfosVersion();
+			QCOMPARE(readerManager->getReaderInfosVersion(), version);
+
+			MockReaderManagerPlugIn::getInstance().addReader("MockReader 1");
+			QTRY_COMPARE(spyAdded.count(), 1); // clazy:exclude=qstring-allocations
+			const auto addedVersion = readerManager->getReaderInfosVersion();
+			QVERIFY(addedVersion > version);
+
+			QCOMPARE(readerManager->getReaderInfos().size(), 1);
+			QCOMPARE(readerManager->getReaderInfo("MockReader 1").getName(), QStringLiteral("MockReader 1"));
+			QCOMPARE(readerManager->getReaderInfosVersion(), addedVersion);
+
+			MockReaderManagerPlugIn::getInstance().removeReader("MockReader 1");
+			QTRY_COMPARE(spyRemoved.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(readerManager->getReaderInfosVersion() > addedVersion);
+			QVERIFY(readerManager->getReaderInfos().isEmpty());
+		}
+
+
+		void concurrentReads()
+		{
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			QSignalSpy spy(readerManager, &ReaderManager::fireReaderAdded);
+
+			QAtomicInt stop(0);
+			QAtomicInt inconsistent(0);
+			QScopedPointer<QThread> thread(QThread::create([readerManager, &stop, &inconsistent] {
+					quint64 lastVersion = 0;
+					while (!stop.loadAcquire())
+					{
+						const auto version = readerManager->getReaderInfosVersion();
+						const auto& readerInfos = readerManager->getReaderInfos();
+						for (const auto& info : readerInfos)
+						{
+							if (info.getName().isEmpty())
+							{
+								inconsistent.ref();
+							}
+						}
+						if (version < lastVersion)
+						{
+							inconsistent.ref();
+						}
+						lastVersion = version;
+					}
+				}));
+			thread->start();
+
+			for (int i = 0; i < 10; ++i)
+			{
+				MockReaderManagerPlugIn::getInstance().addReader(QStringLiteral("MockReader %1").arg(i));
+			}
+			QTRY_COMPARE(spy.count(), 10); // clazy:exclude=qstring-allocations
+
+			stop.storeRelease(1);
+			QVERIFY(thread->wait(5000));
+			QCOMPARE(inconsistent.loadAcquire(), 0);
+			QCOMPARE(readerManager->getReaderInfos().size(), 10);
+		}
+
+
+		void benchmarkGetReaderInfos()
+		{
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			QSignalSpy spy(readerManager, &ReaderManager::fireReaderAdded);
+			for (int i = 0; i < 10; ++i)
+			{
+				MockReaderManagerPlugIn::getInstance().addReader(QStringLiteral("MockReader %1").arg(i));
+			}
+			QTRY_COMPARE(spy.count(), 10); // clazy:exclude=qstring-allocations
+
+			const QString name = QStringLiteral("MockReader 5");
+			QBENCHMARK
+			{
+				QCOMPARE(readerManager->getReaderInfos().size(), 10);
+				QCOMPARE(readerManager->getReaderInfo(name).getName(), name);
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_ReaderManager)
@@ -174,6 +174,50 @@ class test_SecureMessaging
 		}
 
 
+		void testDataLongLength()
+		{
+			const QByteArray data(200, 0x42);
+			CommandApdu command(static_cast<char>(0x00), static_cast<char>(0x10), static_cast<char>(0x20), static_cast<char>(0x30), data, CommandApdu::NO_LE);
+			CommandApdu securedCommand = mSecureMessaging->encrypt(command);
+
+			const QByteArray securedData = securedCommand.getData();
+			QCOMPARE(securedCommand.getLc(), 4 + 208 + 10);
+			QCOMPARE(securedData.left(4), QByteArray::fromHex("8781d101"));
+			QCOMPARE(securedData.mid(212, 2), QByteArray::fromHex("8e08"));
+
+			QByteArray dataToMac = concat({QByteArray(15, 0x00), QByteArray::fromHex("01"), QByteArray::fromHex("0c10203080"), QByteArray(11, 0x00)});
+			dataToMac += securedData.left(212);
+			dataToMac += concat({QByteArray::fromHex("80"), QByteArray(11, 0x00)});
+			QCOMPARE(securedData.mid(214), mCipherMac->generate(dataToMac));
+		}
+
+
+		void benchmarkEncrypt_data()
+		{
+			QTest::addColumn<int>("dataSize");
+			QTest::addColumn<int>("le");
+
+			QTest::newRow("no data") << 0 << CommandApdu::SHORT_MAX_LE;
+			QTest::newRow("short data") << 16 << CommandApdu::SHORT_MAX_LE;
+			QTest::newRow("short max data") << CommandApdu::SHORT_MAX_LC << CommandApdu::SHORT_MAX_LE;
+			QTest::newRow("extended data") << 1024 << CommandApdu::EXTENDED_MAX_LE;
+		}
+
+
+		void benchmarkEncrypt()
+		{
+			QFETCH(int, dataSize);
+			QFETCH(int, le);
+
+			const CommandApdu command(static_cast<char>(0x00), static_cast<char>(0xB0), static_cast<char>(0x00), static_cast<char>(0x00), QByteArray(dataSize, 0x42), le);
+			QBENCHMARK
+			{
+				const CommandApdu securedCommand = mSecureMessaging->encrypt(command);
+				QVERIFY(!securedCommand.isEmpty());
+			}
+		}
+
+
 		void testSendSequenceCounter()
 		{
 			QByteArray data = QByteArray::fromHex("D0D1D2D3");
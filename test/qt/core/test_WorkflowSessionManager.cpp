@@ -0,0 +1,163 @@
+/*!
+ * \brief Unit tests for \ref WorkflowSessionManager
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "controller/WorkflowSessionManager.h"
+
+#include "context/AuthContext.h"
+#include "controller/AuthController.h"
+#include "MockActivationContext.h"
+#include "MockReaderManagerPlugIn.h"
+#include "ReaderManager.h"
+#include "VolatileSettings.h"
+
+#include <QtTest>
+
+#include <algorithm>
+
+Q_IMPORT_PLUGIN(MockReaderManagerPlugIn)
+
+using namespace governikus;
+
+
+class test_WorkflowSessionManager
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		static const int READER_COUNT = 3;
+
+		static QSharedPointer<AuthContext> createContext()
+		{
+			return QSharedPointer<AuthContext>::create(QSharedPointer<MockActivationContext>::create(true, false, true, true));
+		}
+
+	private Q_SLOTS:
+		void initTestCase()
+		{
+			qRegisterMetaType<QSharedPointer<WorkflowContext>>("QSharedPointer<WorkflowContext>");
+
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			readerManager->init();
+			readerManager->isScanRunning(); // just to wait until initialization finished
+		}
+
+
+		void cleanupTestCase()
+		{
+			Env::getSingleton<ReaderManager>()->shutdown();
+		}
+
+
+		void init()
+		{
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			for (int i = 0; i < READER_COUNT; ++i)
+			{
+				const QString name = QStringLiteral("MockReader %1").arg(i);
+				auto* reader = MockReaderManagerPlugIn::getInstance().addReader(name);
+				MockCardConfig config(QVector<TransmitConfig>(3, TransmitConfig(CardReturnCode::OK, QByteArray::fromHex("9000"))));
+				reader->setCard(config);
+				QTRY_VERIFY(readerManager->getReaderInfo(name).hasEidCard()); // clazy:exclude=qstring-allocations
+			}
+		}
+
+
+		void cleanup()
+		{
+			MockReaderManagerPlugIn::getInstance().removeAllReader();
+		}
+
+
+		void disabledByDefault()
+		{
+			QCOMPARE(Env::getSingleton<VolatileSettings>()->getMaxSessions(), 1);
+			WorkflowSessionManager manager(Env::getSingleton<VolatileSettings>()->getMaxSessions());
+			QCOMPARE(manager.getMaxSessions(), 1);
+			QVERIFY(!manager.isEnabled());
+
+			manager.setMaxSessions(2);
+			QVERIFY(manager.isEnabled());
+		}
+
+
+		void concurrentAuthentications()
+		{
+			WorkflowSessionManager manager(READER_COUNT);
+			QStringList statesAtStart;
+			connect(&manager, &WorkflowSessionManager::fireSessionStarted, this, [&statesAtStart](quint64, const QSharedPointer<WorkflowContext>& pContext) {
+					statesAtStart += pContext->getCurrentState();
+				});
+			QSignalSpy spyStarted(&manager, &WorkflowSessionManager::fireSessionStarted);
+			QSignalSpy spyFinished(&manager, &WorkflowSessionManager::fireSessionFinished);
+			QSignalSpy spyAllFinished(&manager, &WorkflowSessionManager::fireAllSessionsFinished);
+
+			QVector<QSharedPointer<AuthContext>> contexts;
+			for (int i = 0; i < READER_COUNT; ++i)
+			{
+				contexts += createContext();
+				QVERIFY(manager.start<AuthController>(contexts.last()));
+			}
+			QCOMPARE(manager.getSessionCount(), READER_COUNT);
+			QCOMPARE(spyStarted.count(), READER_COUNT);
+			QCOMPARE(statesAtStart, QStringList(READER_COUNT, QString()));
+
+			auto boundReaders = manager.getBoundReaderNames();
+			boundReaders.sort();
+			QCOMPARE(boundReaders, QStringList({"MockReader 0", "MockReader 1", "MockReader 2"}));
+			for (int i = 0; i < READER_COUNT; ++i)
+			{
+				QCOMPARE(spyStarted.at(i).at(1).value<QSharedPointer<WorkflowContext>>(), contexts.at(i));
+				QVERIFY(boundReaders.contains(contexts.at(i)->getBoundReaderName()));
+			}
+
+			QTest::ignoreMessage(QtWarningMsg, "Session rejected, limit of 3 sessions reached");
+			QVERIFY(!manager.start<AuthController>(createContext()));
+
+			// Nobody approves the states, so every session waits in its first state.
+			QTRY_VERIFY(std::all_of(contexts.constBegin(), contexts.constEnd(), [](const auto& pContext){ // clazy:exclude=qstring-allocations
+					return !pContext->getCurrentState().isEmpty();
+				}));
+			QCOMPARE(spyFinished.count(), 0);
+
+			manager.killAll();
+			QTRY_COMPARE(spyAllFinished.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(spyFinished.count(), READER_COUNT);
+			QVERIFY(manager.isEmpty());
+
+			for (const auto& context : qAsConst(contexts))
+			{
+				QVERIFY(context->isWorkflowFinished());
+				QCOMPARE(context->getStatus().getStatusCode(), GlobalStatus::Code::Workflow_Cancellation_By_User);
+			}
+		}
+
+
+		void noIdleReader()
+		{
+			WorkflowSessionManager manager(READER_COUNT + 1);
+			for (int i = 0; i < READER_COUNT; ++i)
+			{
+				QVERIFY(manager.start<AuthController>(createContext()));
+			}
+
+			QTest::ignoreMessage(QtWarningMsg, "Session rejected, no idle reader available");
+			QVERIFY(!manager.start<AuthController>(createContext()));
+
+			QSignalSpy spyAllFinished(&manager, &WorkflowSessionManager::fireAllSessionsFinished);
+			manager.killAll();
+			QTRY_COMPARE(spyAllFinished.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(manager.start<AuthController>(createContext()));
+			QCOMPARE(manager.getSessionCount(), 1);
+			manager.killAll();
+			QTRY_COMPARE(spyAllFinished.count(), 2); // clazy:exclude=qstring-allocations
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_WorkflowSessionManager)
+#include "test_WorkflowSessionManager.moc"
@@ -5,6 +5,7 @@
  */
 
 #include "LogHandler.h"
+#include "MappedLogFile.h"
 
 #include <QDir>
 #include <QFile>
@@ -70,10 +71,122 @@ class test_LogHandler
 		}
 
 
+		void benchmark_data()
+		{
+			QTest::addColumn<bool>("asyncWrite");
+			QTest::addColumn<int>("producers");
+
+			QTest::newRow("sync") << false << 1;
+			QTest::newRow("async") << true << 1;
+			QTest::newRow("sync - 4 producers x 100 messages") << false << 4;
+			QTest::newRow("async - 4 producers x 100 messages") << true << 4;
+		}
+
+
 		void benchmark()
 		{
+			QFETCH(bool, asyncWrite);
+			QFETCH(int, producers);
+
+			const auto& logger = Env::getSingleton<LogHandler>();
+			logger->setAsyncWrite(asyncWrite);
+			const auto resetAsyncWrite = qScopeGuard([logger] {
+					logger->setAsyncWrite(true);
+				});
+
+			if (producers == 1)
+			{
+				QBENCHMARK{
+					qDebug() << "Add some dummy" << "messages" << "in different" << "strings";
+				}
+				return;
+			}
+
 			QBENCHMARK{
-				qDebug() << "Add some dummy" << "messages" << "in different" << "strings";
+				QVector<QThread*> threads;
+				for (int i = 0; i < producers; ++i)
+				{
+					threads += QThread::create([] {
+							for (int j = 0; j < 100; ++j)
+							{
+								qDebug() << "Add some dummy" << "messages" << "in different" << "strings";
+							}
+						});
+					threads.last()->start();
+				}
+
+				for (auto* thread : qAsConst(threads))
+				{
+					thread->wait();
+					delete thread;
+				}
+			}
+		}
+
+
+		void asyncWrite()
+		{
+			const auto& logger = Env::getSingleton<LogHandler>();
+			QVERIFY(logger->useAsyncWrite());
+			QVERIFY(logger->mLogFileWriter.isAsync());
+			logger->resetBacklog();
+
+			const QByteArray msg("message that is still buffered by the writer thread");
+			qDebug() << msg;
+			QVERIFY(logger->getBacklog().contains(msg));
+			QCOMPARE(logger->mLogFileWriter.getPosition(), logger->mLogFile->size());
+
+			logger->setAsyncWrite(false);
+			QVERIFY(!logger->mLogFileWriter.isAsync());
+			qDebug() << msg;
+			QCOMPARE(logger->mLogFileWriter.getPosition(), logger->mLogFile->size());
+			QCOMPARE(logger->getBacklog().count(msg), 2);
+
+			logger->setAsyncWrite(true);
+			QVERIFY(logger->mLogFileWriter.isAsync());
+		}
+
+
+		void asyncWriteConcurrent()
+		{
+			const auto& logger = Env::getSingleton<LogHandler>();
+			const bool useHandler = logger->useHandler();
+			logger->setUseHandler(false);
+			const auto resetUseHandler = qScopeGuard([logger, useHandler] {
+					logger->setUseHandler(useHandler);
+				});
+			logger->resetBacklog();
+
+			const int producers = 4;
+			const int messages = 500;
+			QVector<QThread*> threads;
+			const auto deleteThreads = qScopeGuard([&threads] {
+					for (auto* thread : qAsConst(threads))
+					{
+						thread->wait();
+						delete thread;
+					}
+				});
+			for (int i = 0; i < producers; ++i)
+			{
+				threads += QThread::create([i] {
+						for (int j = 0; j < messages; ++j)
+						{
+							qDebug().noquote() << QStringLiteral("producer %1 message %2").arg(i).arg(j);
+						}
+					});
+				threads.last()->start();
+			}
+
+			for (auto* thread : qAsConst(threads))
+			{
+				QVERIFY(thread->wait(10000));
+			}
+
+			const auto backlog = logger->getBacklog();
+			for (int i = 0; i < producers; ++i)
+			{
+				QCOMPARE(backlog.count(QStringLiteral("producer %1 message ").arg(i).toUtf8()), messages);
 			}
 		}
 
@@ -101,6 +214,158 @@ class test_LogHandler
 		}
 
 
+		void getLines()
+		{
+			const auto& logger = Env::getSingleton<LogHandler>();
+			logger->setUseHandler(false);
+			logger->resetBacklog();
+			QCOMPARE(logger->getLineCount(), 0);
+			QVERIFY(logger->getLines(0, 10).isEmpty());
+
+			for (int i = 0; i < 10; ++i)
+			{
+				qDebug() << "line" << i;
+			}
+			qDebug() << "multi\nline";
+
+			QCOMPARE(logger->getLineCount(), 12);
+			QVERIFY(logger->getLineCount(true) > 12);
+			QCOMPARE(logger->getLines(0, 12), logger->getBacklog());
+			QCOMPARE(logger->getLines(0, 100), logger->getBacklog());
+
+			const auto page = logger->getLines(3, 2);
+			QCOMPARE(page.count('\n'), 2);
+			QVERIFY(page.contains("line 3"));
+			QVERIFY(page.contains("line 4"));
+			QVERIFY(!page.contains("line 5"));
+
+			QVERIFY(logger->getLines(11, 1).startsWith("line"));
+			QVERIFY(logger->getLines(12, 1).isEmpty());
+			QVERIFY(logger->getLines(-1, 1).isEmpty());
+			QVERIFY(logger->getLines(0, 0).isEmpty());
+
+			const int offset = logger->getLineCount(true) - 12;
+			QCOMPARE(logger->getLines(offset + 3, 2, true), page);
+			QVERIFY(logger->getLines(0, offset, true).isEmpty());
+
+			logger->setLogFile(false);
+			QCOMPARE(logger->getLineCount(true), 0);
+			QVERIFY(logger->getLines(0, 10, true).isNull());
+
+			logger->setLogFile(true);
+			QCOMPARE(logger->getLineCount(true), 0);
+			qDebug() << "first line";
+			QCOMPARE(logger->getLineCount(true), 1);
+			QVERIFY(logger->getLines(0, 1, true).contains("first line"));
+		}
+
+
+		void mappedLogFile_data()
+		{
+			QTest::addColumn<bool>("map");
+
+			QTest::newRow("mapped") << true;
+			QTest::newRow("read") << false;
+		}
+
+
+		void mappedLogFile()
+		{
+			QFETCH(bool, map);
+
+			QTemporaryFile file;
+			QVERIFY(file.open());
+			file.write("first\nsecond\r\n\nfourth");
+			file.close();
+
+			MappedLogFile logFile(file.fileName(), map);
+			QVERIFY(logFile.isOpen());
+			QCOMPARE(logFile.isMapped(), map);
+			QCOMPARE(logFile.getLineCount(), 4);
+			QCOMPARE(logFile.getLines(0, 1), QByteArray("first\n"));
+			QCOMPARE(logFile.getLines(1, 2), QByteArray("second\r\n\n"));
+			QCOMPARE(logFile.getLines(3, 10), QByteArray("fourth"));
+			QCOMPARE(logFile.getLines(0, 10), QByteArray("first\nsecond\r\n\nfourth"));
+			QVERIFY(logFile.getLines(4, 1).isEmpty());
+			QVERIFY(logFile.getLines(0, 0).isEmpty());
+
+			QTemporaryFile emptyFile;
+			QVERIFY(emptyFile.open());
+			MappedLogFile emptyLogFile(emptyFile.fileName(), map);
+			QVERIFY(emptyLogFile.isOpen());
+			QVERIFY(!emptyLogFile.isMapped());
+			QCOMPARE(emptyLogFile.getLineCount(), 0);
+			QVERIFY(emptyLogFile.getLines(0, 1).isEmpty());
+
+			QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Cannot open log file"));
+			MappedLogFile missingLogFile(QStringLiteral("missing.log"), map);
+			QVERIFY(!missingLogFile.isOpen());
+			QCOMPARE(missingLogFile.getLineCount(), 0);
+		}
+
+
+		void lineIndex()
+		{
+			LogLineIndex index(100);
+			QCOMPARE(index.getLineCount(), 0);
+			QCOMPARE(index.getLineStart(0), qint64(100));
+
+			index.append(QByteArray("a\nb"));
+			index.append(QByteArray("c\n"));
+			index.append(QByteArray("\nd\n"));
+			QCOMPARE(index.getLineCount(), 4);
+			QCOMPARE(index.getLineStart(0), qint64(100));
+			QCOMPARE(index.getLineStart(1), qint64(102));
+			QCOMPARE(index.getLineStart(2), qint64(105));
+			QCOMPARE(index.getLineStart(3), qint64(106));
+			QCOMPARE(index.getLineStart(4), qint64(108));
+			QCOMPARE(index.getEnd(), qint64(108));
+			QCOMPARE(index.getLine(0), 0);
+			QCOMPARE(index.getLine(101), 1);
+			QCOMPARE(index.getLine(105), 2);
+			QCOMPARE(index.getLine(108), 4);
+
+			index.clear(5);
+			QCOMPARE(index.getLineCount(), 0);
+			QCOMPARE(index.getEnd(), qint64(5));
+		}
+
+
+		void lineIndexBounded()
+		{
+			LogLineIndex index(0, 8);
+			for (int i = 0; i < 8; ++i)
+			{
+				index.append(QByteArray("line\n"));
+			}
+			QCOMPARE(index.getLineCount(), 8);
+			QCOMPARE(index.getLineStart(0), qint64(0));
+
+			index.append(QByteArray("line\nopen"));
+			QCOMPARE(index.getLineCount(), 10);
+			QCOMPARE(index.getLineStart(0), qint64(20));
+			QCOMPARE(index.getLineStart(4), qint64(20));
+			QCOMPARE(index.getLineStart(9), qint64(45));
+			QCOMPARE(index.getLine(0), 4);
+			QCOMPARE(index.getLine(21), 5);
+			QCOMPARE(index.getEnd(), qint64(49));
+
+			index.append(QByteArray(" line\n"));
+			QCOMPARE(index.getLineCount(), 10);
+			QCOMPARE(index.getLineStart(9), qint64(45));
+			QCOMPARE(index.getLineStart(10), qint64(55));
+
+			index.drop(40);
+			QCOMPARE(index.getLineCount(), 10);
+			QCOMPARE(index.getLineStart(7), qint64(40));
+			QCOMPARE(index.getLineStart(8), qint64(40));
+			QCOMPARE(index.getLine(40), 8);
+
+			index.clear();
+			QCOMPARE(index.getLineCount(), 0);
+		}
+
+
 		void fireLog()
 		{
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
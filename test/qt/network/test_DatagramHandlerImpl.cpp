@@ -199,6 +199,69 @@ class test_DatagramHandlerImpl
 		}
 
 
+		void broadcastTargetsAreCached()
+		{
+			#ifdef Q_OS_FREEBSD
+			QSKIP("FreeBSD does not like that");
+			#endif
+
+			QUdpSocket receiver;
+			receiver.setProxy(QNetworkProxy::NoProxy);
+			QVERIFY(receiver.bind());
+
+			DatagramHandlerImpl datagramHandlerImpl(false);
+			const QByteArray data("{\"test\":\"dummy\"}");
+			if (!datagramHandlerImpl.sendToAllAddressEntries(data, receiver.localPort()))
+			{
+				QSKIP("No interface to broadcast");
+			}
+			const auto broadcastTargets = datagramHandlerImpl.mBroadcastTargets;
+			QVERIFY(!broadcastTargets.isEmpty());
+
+			// The interfaces are not enumerated again while the targets are valid
+			datagramHandlerImpl.mBroadcastTargets.clear();
+			QVERIFY(!datagramHandlerImpl.sendToAllAddressEntries(data, receiver.localPort()));
+
+			datagramHandlerImpl.mBroadcastTargets = broadcastTargets;
+			datagramHandlerImpl.onNetworkChanged();
+			QVERIFY(datagramHandlerImpl.sendToAllAddressEntries(data, receiver.localPort()));
+			QCOMPARE(datagramHandlerImpl.mBroadcastTargets.size(), broadcastTargets.size());
+			for (int i = 0; i < broadcastTargets.size(); ++i)
+			{
+				QCOMPARE(datagramHandlerImpl.mBroadcastTargets.at(i).mAddress, broadcastTargets.at(i).mAddress);
+				QVERIFY(datagramHandlerImpl.mBroadcastTargets.at(i).mSocket == broadcastTargets.at(i).mSocket);
+			}
+		}
+
+
+		void sendStatistics()
+		{
+			#ifdef Q_OS_FREEBSD
+			QSKIP("FreeBSD does not like that");
+			#endif
+
+			QUdpSocket receiver;
+			receiver.setProxy(QNetworkProxy::NoProxy);
+			QVERIFY(receiver.bind());
+
+			DatagramHandlerImpl datagramHandlerImpl(false);
+			QVERIFY(datagramHandlerImpl.getSendStatistics().isEmpty());
+			if (!datagramHandlerImpl.sendToAllAddressEntries("dummy", receiver.localPort())
+					|| !datagramHandlerImpl.sendToAllAddressEntries("dummy", receiver.localPort()))
+			{
+				QSKIP("No interface to broadcast");
+			}
+
+			const auto& statistics = datagramHandlerImpl.getSendStatistics();
+			for (const auto& target : qAsConst(datagramHandlerImpl.mBroadcastTargets))
+			{
+				QVERIFY(statistics.contains(target.mInterfaceName));
+				QVERIFY(statistics.value(target.mInterfaceName).mSent >= 2);
+				QCOMPARE(statistics.value(target.mInterfaceName).mFailed, quint64(0));
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_DatagramHandlerImpl)
@@ -27,6 +27,8 @@ class test_HttpRequest
 											 "\r\n\r\n");
 
 			HttpRequest request(socket);
+			QSignalSpy spy(&request, &HttpRequest::fireMessageComplete);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
 			QVERIFY(!request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHeader().size(), 1);
@@ -50,6 +52,8 @@ class test_HttpRequest
 											 "\r\n\r\n");
 
 			HttpRequest request(socket);
+			QSignalSpy spy(&request, &HttpRequest::fireMessageComplete);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
 			QVERIFY(request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHeader().size(), 7);
@@ -77,6 +81,8 @@ class test_HttpRequest
 											 "\r\n\r\n");
 
 			HttpRequest request(socket);
+			QSignalSpy spy(&request, &HttpRequest::fireMessageComplete);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
 			QVERIFY(!request.isUpgrade());
 			QCOMPARE(request.getMethod(), QByteArray("GET"));
 			QCOMPARE(request.getHeader().size(), 9);
@@ -86,6 +92,32 @@ class test_HttpRequest
 		}
 
 
+		void pipelined()
+		{
+			auto* socket = new MockSocket();
+			socket->mReadBuffer = QByteArray("GET /first HTTP/1.1\r\n"
+											 "Host: Dummy.de\r\n"
+											 "\r\n"
+											 "GET /second HTTP/1.1\r\n"
+											 "Host: Dummy.de\r\n"
+											 "\r\n");
+
+			HttpRequest first(socket);
+			QSignalSpy spyFirst(&first, &HttpRequest::fireMessageComplete);
+			QTRY_COMPARE(spyFirst.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(first.getUrl(), QUrl("/first"));
+			QCOMPARE(first.mPendingData, QByteArray("GET /second HTTP/1.1\r\nHost: Dummy.de\r\n\r\n"));
+			QVERIFY(!first.isReusable());
+
+			HttpRequest second(first.take(), first.mPendingData);
+			QSignalSpy spy(&second, &HttpRequest::fireMessageComplete);
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(second.getUrl(), QUrl("/second"));
+			QCOMPARE(second.getHeader("host"), QByteArray("Dummy.de"));
+			QVERIFY(second.mPendingData.isEmpty());
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_HttpRequest)
@@ -15,6 +15,7 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QTcpSocket>
 #include <QtTest>
 
 using namespace governikus;
@@ -28,6 +29,11 @@ class test_HttpServer
 	private:
 		QNetworkAccessManager mAccessManager;
 
+		static void respondWithPath(const QSharedPointer<HttpRequest>& pRequest)
+		{
+			pRequest->send(HttpResponse(HTTP_STATUS_OK, pRequest->getUrl().path().toUtf8(), "text/plain"));
+		}
+
 	private Q_SLOTS:
 		void initTestCase()
 		{
@@ -164,6 +170,115 @@ class test_HttpServer
 		}
 
 
+		void keepAlive()
+		{
+			HttpServer server;
+			QVERIFY(server.isListening());
+			connect(&server, &HttpServer::fireNewHttpRequest, this, &test_HttpServer::respondWithPath);
+
+			const QString url = QStringLiteral("http://127.0.0.1:%1/").arg(server.getServerPort());
+			for (const auto& path : {QStringLiteral("first"), QStringLiteral("second"), QStringLiteral("third")})
+			{
+				QScopedPointer<QNetworkReply> reply(mAccessManager.get(QNetworkRequest(QUrl(url + path))));
+				QSignalSpy spyClient(reply.data(), &QNetworkReply::finished);
+				QTRY_COMPARE(spyClient.count(), 1); // clazy:exclude=qstring-allocations
+				QCOMPARE(reply->rawHeader("Connection"), QByteArray("keep-alive"));
+				QCOMPARE(reply->rawHeader("Keep-Alive"), QByteArray("timeout=") + QByteArray::number(HttpServer::cIdleTimeout));
+				QCOMPARE(reply->readAll(), QByteArray("/" + path.toUtf8()));
+				QCOMPARE(server.getConnectionCount(), 1);
+			}
+		}
+
+
+		void pipelining()
+		{
+			HttpServer server;
+			QVERIFY(server.isListening());
+			connect(&server, &HttpServer::fireNewHttpRequest, this, &test_HttpServer::respondWithPath);
+
+			QTcpSocket client;
+			QByteArray received;
+			connect(&client, &QTcpSocket::readyRead, this, [&client, &received] {
+					received += client.readAll();
+				});
+			client.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(client.waitForConnected());
+			client.write("GET /first HTTP/1.1\r\nHost: localhost\r\n\r\n"
+						 "GET /second HTTP/1.1\r\nHost: localhost\r\n\r\n"
+						 "GET /third HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n");
+
+			QSignalSpy spyDisconnected(&client, &QTcpSocket::disconnected);
+			QTRY_COMPARE(spyDisconnected.count(), 1); // clazy:exclude=qstring-allocations
+			QCOMPARE(received.count("HTTP/1.0 200"), 3);
+			QCOMPARE(received.count("Connection: keep-alive"), 2);
+			QVERIFY(received.indexOf("/first") < received.indexOf("/second"));
+			QVERIFY(received.indexOf("/second") < received.indexOf("/third"));
+			QTRY_COMPARE(server.getConnectionCount(), 0); // clazy:exclude=qstring-allocations
+		}
+
+
+		void keepAliveDisabled()
+		{
+			HttpServer server;
+			server.setIdleTimeout(0);
+			connect(&server, &HttpServer::fireNewHttpRequest, this, &test_HttpServer::respondWithPath);
+
+			QTcpSocket client;
+			client.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(client.waitForConnected());
+			QSignalSpy spyDisconnected(&client, &QTcpSocket::disconnected);
+			client.write("GET /first HTTP/1.1\r\nHost: localhost\r\n\r\n");
+
+			QTRY_COMPARE(spyDisconnected.count(), 1); // clazy:exclude=qstring-allocations
+			const auto received = client.readAll();
+			QVERIFY(received.startsWith("HTTP/1.0 200"));
+			QVERIFY(!received.contains("Connection: keep-alive"));
+		}
+
+
+		void idleTimeout()
+		{
+			HttpServer server;
+			server.setIdleTimeout(1);
+
+			QTcpSocket client;
+			client.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(client.waitForConnected());
+			QTRY_COMPARE(server.getConnectionCount(), 1); // clazy:exclude=qstring-allocations
+
+			QSignalSpy spyDisconnected(&client, &QTcpSocket::disconnected);
+			QTRY_COMPARE(spyDisconnected.count(), 1); // clazy:exclude=qstring-allocations
+			QTRY_COMPARE(server.getConnectionCount(), 0); // clazy:exclude=qstring-allocations
+		}
+
+
+		void connectionLimit()
+		{
+			HttpServer server;
+			server.setMaxConnections(1);
+			connect(&server, &HttpServer::fireNewHttpRequest, this, &test_HttpServer::respondWithPath);
+
+			QTcpSocket first;
+			first.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(first.waitForConnected());
+			QTRY_COMPARE(server.getConnectionCount(), 1); // clazy:exclude=qstring-allocations
+
+			QTcpSocket second;
+			second.connectToHost(QHostAddress::LocalHost, server.getServerPort());
+			QVERIFY(second.waitForConnected());
+			QSignalSpy spyResponse(&second, &QTcpSocket::readyRead);
+			second.write("GET /second HTTP/1.1\r\nHost: localhost\r\n\r\n");
+			QTest::qWait(100);
+			QCOMPARE(spyResponse.count(), 0);
+			QCOMPARE(server.getConnectionCount(), 1);
+
+			first.disconnectFromHost();
+			QTRY_VERIFY(spyResponse.count() > 0); // clazy:exclude=qstring-allocations
+			QVERIFY(second.readAll().startsWith("HTTP/1.0 200"));
+			QCOMPARE(server.getConnectionCount(), 1);
+		}
+
+
 		void methodWithoutReceiver_data()
 		{
 			QTest::addColumn<QNetworkRequest>("request");
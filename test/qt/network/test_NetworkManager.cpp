@@ -73,6 +73,106 @@ class test_NetworkManager
 		}
 
 
+		void sessionCache()
+		{
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			const auto hits = networkManager->getSessionCacheHitCount();
+			const auto misses = networkManager->getSessionCacheMissCount();
+
+			QNetworkRequest request(QUrl("https://session.dummy"));
+			QScopedPointer<QNetworkReply, QScopedPointerDeleteLater> reply(networkManager->get(request, {}, QByteArray(), 1));
+			QVERIFY(request.sslConfiguration().sessionTicket().isEmpty());
+			QCOMPARE(networkManager->getSessionCacheHitCount(), hits);
+			QCOMPARE(networkManager->getSessionCacheMissCount(), misses + 1);
+
+			QNetworkRequest requestWithSession(QUrl("https://session.dummy"));
+			reply.reset(networkManager->paos(requestWithSession, "paosNamespace", "content", false, QByteArray("session"), 1));
+			QCOMPARE(requestWithSession.sslConfiguration().sessionTicket(), QByteArray("session"));
+			QCOMPARE(networkManager->getSessionCacheHitCount(), hits);
+			QCOMPARE(networkManager->getSessionCacheMissCount(), misses + 1);
+
+			QNetworkRequest requestPsk(QUrl("https://session.dummy"));
+			reply.reset(networkManager->paos(requestPsk, "paosNamespace", "content", true, QByteArray(), 1));
+			QVERIFY(requestPsk.sslConfiguration().sessionTicket().isEmpty());
+			QCOMPARE(networkManager->getSessionCacheHitCount(), hits);
+			QCOMPARE(networkManager->getSessionCacheMissCount(), misses + 1);
+		}
+
+
+		void sessionCacheHit()
+		{
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			const QUrl url(QStringLiteral("https://resume.dummy"));
+			const auto& sessionKey = NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT);
+
+			QNetworkRequest request(url);
+			QScopedPointer<QNetworkReply, QScopedPointerDeleteLater> reply(networkManager->get(request, {}, QByteArray(), 1));
+			QVERIFY(request.sslConfiguration().sessionTicket().isEmpty());
+
+			// Emulate the full handshake of the first request
+			MockNetworkReply handshakeReply;
+			handshakeReply.setProperty("handshake", true);
+			QSslConfiguration config = request.sslConfiguration();
+			config.setSessionTicket(QByteArray("ticket"));
+			handshakeReply.setSslConfiguration(config);
+			networkManager->onSessionReplyFinished(&handshakeReply, sessionKey);
+
+			const auto hits = networkManager->getSessionCacheHitCount();
+			const auto misses = networkManager->getSessionCacheMissCount();
+
+			QNetworkRequest resumedRequest(url);
+			reply.reset(networkManager->get(resumedRequest, {}, QByteArray(), 1));
+			QCOMPARE(resumedRequest.sslConfiguration().sessionTicket(), QByteArray("ticket"));
+			QCOMPARE(networkManager->getSessionCacheHitCount(), hits + 1);
+			QCOMPARE(networkManager->getSessionCacheMissCount(), misses);
+
+			QNetworkRequest otherHostRequest(QUrl(QStringLiteral("https://other.dummy")));
+			reply.reset(networkManager->get(otherHostRequest, {}, QByteArray(), 1));
+			QVERIFY(otherHostRequest.sslConfiguration().sessionTicket().isEmpty());
+			QCOMPARE(networkManager->getSessionCacheHitCount(), hits + 1);
+			QCOMPARE(networkManager->getSessionCacheMissCount(), misses + 1);
+		}
+
+
+		void sessionCacheBounded()
+		{
+			auto* networkManager = Env::getSingleton<NetworkManager>();
+			const int maxSessions = networkManager->mSessionCache.maxCost();
+
+			for (int i = 0; i <= maxSessions; ++i)
+			{
+				MockNetworkReply handshakeReply;
+				handshakeReply.setProperty("handshake", true);
+				QSslConfiguration config;
+				config.setSessionTicket(QByteArray::number(i));
+				handshakeReply.setSslConfiguration(config);
+				const QUrl url(QStringLiteral("https://host%1.dummy").arg(i));
+				networkManager->onSessionReplyFinished(&handshakeReply, NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT));
+			}
+
+			QCOMPARE(networkManager->mSessionCache.size(), maxSessions);
+			QVERIFY(!networkManager->mSessionCache.contains(NetworkManager::getSessionKey(QUrl(QStringLiteral("https://host0.dummy")), SecureStorage::TlsSuite::DEFAULT)));
+			QVERIFY(networkManager->mSessionCache.contains(NetworkManager::getSessionKey(QUrl(QStringLiteral("https://host1.dummy")), SecureStorage::TlsSuite::DEFAULT)));
+		}
+
+
+		void sessionKeyContainsCaCertificates()
+		{
+			const QUrl url(QStringLiteral("https://session.dummy"));
+			auto caCerts = Env::getSingleton<SecureStorage>()->getUpdateCertificates().toList();
+			QVERIFY(caCerts.size() > 1);
+
+			const auto& defaultKey = NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT);
+			const auto& pinnedKey = NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT, caCerts);
+			QVERIFY(defaultKey != pinnedKey);
+			QVERIFY(pinnedKey != NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT, caCerts.mid(1)));
+
+			std::reverse(caCerts.begin(), caCerts.end());
+			QCOMPARE(NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT, caCerts), pinnedKey);
+			QCOMPARE(NetworkManager::getSessionKey(url, SecureStorage::TlsSuite::DEFAULT), defaultKey);
+		}
+
+
 		void serviceUnavailableEnums()
 		{
 			auto reply = QSharedPointer<MockNetworkReply>::create();
@@ -87,6 +87,30 @@ class test_IfdEstablishContextResponse
 		}
 
 
+		void toJsonBatchTransmit()
+		{
+			const IfdEstablishContextResponse ifdEstablishContextResponse(
+				QStringLiteral("IFD Remote Server")
+				);
+			QVERIFY(ifdEstablishContextResponse.isBatchTransmitSupported());
+
+			const QByteArray& byteArray = ifdEstablishContextResponse.toByteArray(IfdVersion::Version::v2, QStringLiteral("TestContext"));
+			QCOMPARE(byteArray,
+					QByteArray("{\n"
+							   "    \"BatchTransmit\": true,\n"
+							   "    \"ContextHandle\": \"TestContext\",\n"
+							   "    \"IFDName\": \"IFD Remote Server\",\n"
+							   "    \"ResultMajor\": \"http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok\",\n"
+							   "    \"ResultMinor\": null,\n"
+							   "    \"msg\": \"IFDEstablishContextResponse\"\n"
+							   "}\n"));
+
+			const IfdEstablishContextResponse parsed(QJsonDocument::fromJson(byteArray).object());
+			QVERIFY(!parsed.isIncomplete());
+			QVERIFY(parsed.isBatchTransmitSupported());
+		}
+
+
 		void fromJson()
 		{
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
@@ -105,6 +129,7 @@ class test_IfdEstablishContextResponse
 			QCOMPARE(ifdEstablishContextResponse.getType(), RemoteCardMessageType::IFDEstablishContextResponse);
 			QCOMPARE(ifdEstablishContextResponse.getContextHandle(), QStringLiteral("TestContext"));
 			QCOMPARE(ifdEstablishContextResponse.getIfdName(), QStringLiteral("IFD Remote Server"));
+			QVERIFY(!ifdEstablishContextResponse.isBatchTransmitSupported());
 			QVERIFY(!ifdEstablishContextResponse.resultHasError());
 			QCOMPARE(ifdEstablishContextResponse.getResultMinor(), ECardApiResult::Minor::null);
 
@@ -172,6 +197,7 @@ class test_IfdEstablishContextResponse
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			const QByteArray message("{\n"
+									 "    \"BatchTransmit\": \"yes\",\n"
 									 "    \"ContextHandle\": \"TestContext\",\n"
 									 "    \"IFDName\": 1,\n"
 									 "    \"ResultMajor\": \"http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok\",\n"
@@ -188,8 +214,11 @@ class test_IfdEstablishContextResponse
 			QVERIFY(!ifdEstablishContextResponse.resultHasError());
 			QCOMPARE(ifdEstablishContextResponse.getResultMinor(), ECardApiResult::Minor::null);
 
-			QCOMPARE(logSpy.count(), 1);
+			QVERIFY(!ifdEstablishContextResponse.isBatchTransmitSupported());
+
+			QCOMPARE(logSpy.count(), 2);
 			QVERIFY(logSpy.at(0).at(0).toString().contains("The value of \"IFDName\" should be of type \"string\""));
+			QVERIFY(logSpy.at(1).at(0).toString().contains("The value of \"BatchTransmit\" should be of type \"boolean\""));
 		}
 
 
@@ -139,7 +139,7 @@ class test_IfdTransmit
 			QTest::addColumn<QByteArray>("json");
 			QTest::addColumn<QByteArray>("apdu");
 			QTest::addColumn<bool>("incomplete");
-			QTest::newRow("CommandAPDUs") << QByteArray(R"("CommandAPDUs": [ { "AcceptableStatusCodes": null, "InputAPDU": "00a402022f00" } ],)") << QByteArray("00a402022f00") << !IfdVersion(IfdVersion::Version::v0).isSupported();
+			QTest::newRow("CommandAPDUs") << QByteArray(R"("CommandAPDUs": [ { "AcceptableStatusCodes": null, "InputAPDU": "00a402022f00" } ],)") << QByteArray("00a402022f00") << false;
 			QTest::newRow("InputAPDU") << QByteArray(R"("InputAPDU": "00a402022f00",)") << QByteArray("00a402022f00") << false;
 			QTest::newRow("Equal - Both") << QByteArray(R"("CommandAPDUs": [ { "AcceptableStatusCodes": null, "InputAPDU": "00a402022f00" } ], "InputAPDU": "00a402022f00",)") << QByteArray("00a402022f00") << false;
 			QTest::newRow("Not Equal - Both") << QByteArray(R"("CommandAPDUs": [ { "AcceptableStatusCodes": null, "InputAPDU": "00a402022f01" } ], "InputAPDU": "00a402022f00",)") << QByteArray("00a402022f00") << false;
@@ -367,18 +367,14 @@ class test_IfdTransmit
 			QCOMPARE(ifdTransmit.getSlotHandle(), QString("SlotHandle"));
 			QCOMPARE(ifdTransmit.getInputApdu(), QByteArray());
 
-			QCOMPARE(logSpy.count(), 1);
+			QCOMPARE(logSpy.count(), 2);
+			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("The value of \"AcceptableStatusCodes\" should be of type \"string array\"")));
 			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("The value of \"InputAPDU\" should be of type \"string\"")));
 		}
 
 
 		void multipleApdus()
 		{
-			if (!IfdVersion(IfdVersion::Version::v0).isSupported())
-			{
-				QSKIP("CommandAPDUs was only supported with IFDInterface_WebSocket_v0");
-			}
-
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			const QByteArray message(R"({
@@ -388,8 +384,12 @@ class test_IfdTransmit
 												"InputAPDU": "00a402022f00"
 											},
 											{
-												"AcceptableStatusCodes": "6300",
+												"AcceptableStatusCodes": ["6300", "9000"],
 												"InputAPDU": "00a402022f01"
+											},
+											{
+												"AcceptableStatusCodes": null,
+												"InputAPDU": "00a402022f02"
 											}
 										],
 										"ContextHandle": "TestContext",
@@ -405,8 +405,57 @@ class test_IfdTransmit
 			QCOMPARE(ifdTransmit.getSlotHandle(), QStringLiteral("SlotHandle"));
 			QCOMPARE(ifdTransmit.getInputApdu(), QByteArray::fromHex("00a402022f00"));
 
-			QCOMPARE(logSpy.count(), 1);
-			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("Only using the first CommandAPDU. Command chaining ist not supported yet")));
+			const auto& inputApduInfos = ifdTransmit.getInputApduInfos();
+			QCOMPARE(inputApduInfos.size(), 3);
+			QCOMPARE(inputApduInfos.at(0).getInputApdu().getBuffer(), QByteArray::fromHex("00a402022f00"));
+			QCOMPARE(inputApduInfos.at(0).getAcceptableStatusCodes(), QByteArrayList({"9000"}));
+			QCOMPARE(inputApduInfos.at(1).getInputApdu().getBuffer(), QByteArray::fromHex("00a402022f01"));
+			QCOMPARE(inputApduInfos.at(1).getAcceptableStatusCodes(), QByteArrayList({"6300", "9000"}));
+			QCOMPARE(inputApduInfos.at(2).getInputApdu().getBuffer(), QByteArray::fromHex("00a402022f02"));
+			QVERIFY(inputApduInfos.at(2).getAcceptableStatusCodes().isEmpty());
+
+			QCOMPARE(logSpy.count(), 0);
+		}
+
+
+		void batchToJson_data()
+		{
+			QTest::addColumn<IfdVersion::Version>("version");
+			QTest::addColumn<bool>("batch");
+
+			QTest::newRow("v2") << IfdVersion::Version::v2 << false;
+			QTest::newRow("v2 batch") << IfdVersion::Version::v2 << true;
+		}
+
+
+		void batchToJson()
+		{
+			QFETCH(IfdVersion::Version, version);
+			QFETCH(bool, batch);
+
+			InputAPDUInfo first(QByteArray::fromHex("00a402022f00"));
+			first.addAcceptableStatusCode(QByteArray("9000"));
+			InputAPDUInfo second(QByteArray::fromHex("00b0000000"));
+			second.addAcceptableStatusCode(QByteArray("6282"));
+			second.addAcceptableStatusCode(QByteArray("9000"));
+			const QVector<InputAPDUInfo> inputApduInfos = batch ? QVector<InputAPDUInfo>({first, second}) : QVector<InputAPDUInfo>({InputAPDUInfo(first.getInputApdu().getBuffer())});
+
+			const IfdTransmit ifdTransmit(QStringLiteral("SlotHandle"), inputApduInfos);
+			const QByteArray& byteArray = ifdTransmit.toByteArray(version, QStringLiteral("TestContext"));
+
+			const QJsonObject obj = QJsonDocument::fromJson(byteArray).object();
+			QCOMPARE(obj.size(), 4);
+			QCOMPARE(obj.contains(QLatin1String("CommandAPDUs")), batch);
+			QCOMPARE(obj.contains(QLatin1String("InputAPDU")), !batch);
+
+			const IfdTransmit parsed(obj);
+			QVERIFY(!parsed.isIncomplete());
+			QCOMPARE(parsed.getInputApduInfos().size(), inputApduInfos.size());
+			for (int i = 0; i < inputApduInfos.size(); ++i)
+			{
+				QCOMPARE(parsed.getInputApduInfos().at(i).getInputApdu().getBuffer(), inputApduInfos.at(i).getInputApdu().getBuffer());
+				QCOMPARE(parsed.getInputApduInfos().at(i).getAcceptableStatusCodes(), inputApduInfos.at(i).getAcceptableStatusCodes());
+			}
 		}
 
 
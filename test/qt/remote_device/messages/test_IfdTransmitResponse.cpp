@@ -144,7 +144,7 @@ class test_IfdTransmitResponse
 		{
 			QTest::addColumn<QByteArray>("json");
 			QTest::addColumn<bool>("incomplete");
-			QTest::newRow("ResponseAPDUs") << QByteArray(R"("ResponseAPDUs": [ "9000" ],)") << !IfdVersion(IfdVersion::Version::v0).isSupported();
+			QTest::newRow("ResponseAPDUs") << QByteArray(R"("ResponseAPDUs": [ "9000" ],)") << false;
 			QTest::newRow("ResponseAPDU") << QByteArray(R"("ResponseAPDU": "9000",)") << false;
 			QTest::newRow("Equal - Both") << QByteArray(R"("ResponseAPDUs": [ "9000" ], "ResponseAPDU": "9000",)") << false;
 			QTest::newRow("Not Equal - Both") << QByteArray(R"("ResponseAPDUs": [ "9001" ], "ResponseAPDU": "9000",)") << false;
@@ -322,11 +322,6 @@ class test_IfdTransmitResponse
 
 		void multipleApdus()
 		{
-			if (!IfdVersion(IfdVersion::Version::v0).isSupported())
-			{
-				QSKIP("ResponseAPDUs was only supported with IFDInterface_WebSocket_v0");
-			}
-
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
 
 			QByteArray message(R"({
@@ -349,11 +344,36 @@ class test_IfdTransmitResponse
 			QCOMPARE(ifdTransmitResponse.getContextHandle(), QStringLiteral("TestContext"));
 			QCOMPARE(ifdTransmitResponse.getSlotHandle(), QString("SlotHandle"));
 			QCOMPARE(ifdTransmitResponse.getResponseApdu(), QByteArray::fromHex("9000"));
+			QCOMPARE(ifdTransmitResponse.getResponseApdus(), QByteArrayList({QByteArray::fromHex("9000"), QByteArray::fromHex("6300")}));
 			QVERIFY(!ifdTransmitResponse.resultHasError());
 			QCOMPARE(ifdTransmitResponse.getResultMinor(), ECardApiResult::Minor::null);
 
-			QCOMPARE(logSpy.count(), 1);
-			QVERIFY(TestFileHelper::containsLog(logSpy, QLatin1String("Only using the first ResponseAPDU. Command chaining ist not supported yet")));
+			QCOMPARE(logSpy.count(), 0);
+		}
+
+
+		void batchToJson()
+		{
+			const QByteArrayList responseApdus({QByteArray::fromHex("9000"), QByteArray::fromHex("6300")});
+			const IfdTransmitResponse ifdTransmitResponse(QStringLiteral("SlotHandle"), responseApdus);
+
+			const QByteArray& byteArray = ifdTransmitResponse.toByteArray(IfdVersion::Version::v2, QStringLiteral("TestContext"));
+			QCOMPARE(byteArray,
+					QByteArray("{\n"
+							   "    \"ContextHandle\": \"TestContext\",\n"
+							   "    \"ResponseAPDUs\": [\n"
+							   "        \"9000\",\n"
+							   "        \"6300\"\n"
+							   "    ],\n"
+							   "    \"ResultMajor\": \"http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok\",\n"
+							   "    \"ResultMinor\": null,\n"
+							   "    \"SlotHandle\": \"SlotHandle\",\n"
+							   "    \"msg\": \"IFDTransmitResponse\"\n"
+							   "}\n"));
+
+			const IfdTransmitResponse parsed(QJsonDocument::fromJson(byteArray).object());
+			QVERIFY(!parsed.isIncomplete());
+			QCOMPARE(parsed.getResponseApdus(), responseApdus);
 		}
 
 
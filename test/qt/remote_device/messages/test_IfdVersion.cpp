@@ -20,6 +20,7 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_Unknown"), IfdVersion::Version::Unknown);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v0"), IfdVersion::Version::v0);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v2"), IfdVersion::Version::v2);
+			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v4"), IfdVersion::Version::v4);
 			QCOMPARE(IfdVersion("IFDInterface_WebSocket_v9001"), IfdVersion::Version::Unknown);
 		}
 
@@ -29,6 +30,7 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion(IfdVersion::Version::Unknown).isValid(), false);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v0).isValid(), true);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v2).isValid(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v4).isValid(), true);
 		}
 
 
@@ -37,12 +39,13 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion(IfdVersion::Version::Unknown).isSupported(), false);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v0).isSupported(), true);
 			QCOMPARE(IfdVersion(IfdVersion::Version::v2).isSupported(), true);
+			QCOMPARE(IfdVersion(IfdVersion::Version::v4).isSupported(), true);
 		}
 
 
 		void supportedVersions()
 		{
-			QVector<IfdVersion::Version> versions({IfdVersion::Version::v2});
+			QVector<IfdVersion::Version> versions({IfdVersion::Version::v2, IfdVersion::Version::v4});
 			if (IfdVersion(IfdVersion::Version::v0).isSupported())
 			{
 				versions.prepend(IfdVersion::Version::v0);
@@ -75,6 +78,10 @@ class test_IfdVersion
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v0, IfdVersion::Version::v2, IfdVersion::Version::Unknown}), IfdVersion::Version::v2);
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::Unknown, IfdVersion::Version::v0}), IfdVersion::Version::v2);
 			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::v0, IfdVersion::Version::Unknown}), IfdVersion::Version::v2);
+
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v4}), IfdVersion::Version::v4);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v2, IfdVersion::Version::v4}), IfdVersion::Version::v4);
+			QCOMPARE(IfdVersion::selectLatestSupported({IfdVersion::Version::v4, IfdVersion::Version::v0, IfdVersion::Version::v2}), IfdVersion::Version::v4);
 		}
 
 
@@ -5,6 +5,15 @@
 #include "messages/RemoteMessage.h"
 
 #include "LogHandler.h"
+#include "messages/IfdConnect.h"
+#include "messages/IfdEstablishContext.h"
+#include "messages/IfdEstablishPaceChannel.h"
+#include "messages/IfdEstablishPaceChannelResponse.h"
+#include "messages/IfdModifyPin.h"
+#include "messages/IfdModifyPinResponse.h"
+#include "messages/IfdStatus.h"
+#include "messages/IfdTransmit.h"
+#include "messages/IfdTransmitResponse.h"
 
 #include <QtTest>
 
@@ -12,6 +21,9 @@
 using namespace governikus;
 
 
+Q_DECLARE_METATYPE(IfdVersion::Version)
+
+
 class test_RemoteMessage
 	: public QObject
 {
@@ -118,6 +130,71 @@ class test_RemoteMessage
 			QVERIFY(logSpy.at(0).at(0).toString().contains(QString("Invalid messageType received: \"")));
 		}
 
+
+		static QVector<QPair<QByteArray, QByteArray> > createFixtures()
+		{
+			// messages of the fromJson tests of the single message types
+			const QByteArray chat("7F4C12060904007F00070301020253050000000F0F");
+			const QByteArray certificateDescription(
+					"308202A4"
+					"060A04007F00070301030103"
+					"A10E0C0C442D547275737420476D6248"
+					"A33A0C38476573616D7476657262616E64206465722064657574736368656E20566572736963686572756E67737769727473636861667420652E562E"
+					"A5820248"
+					"048202444E616D652C20416E7363687269667420756E6420452D4D61696C2D4164726573736520646573204469656E737465616E626965746572733A0D0A476573616D7476657262616E64206465722064657574736368656E20566572736963686572756E67737769727473636861667420652E562E0D0A57696C68656C6D73747261C39F652034332F3433670D0A3130313137204265726C696E0D0A6265726C696E406764762E64650D0A0D0A4765736368C3A46674737A7765636B3A0D0A2D52656769737472696572756E6720756E64204C6F67696E20616D204744562D4D616B6C6572706F7274616C2D0D0A0D0A48696E7765697320617566206469652066C3BC722064656E204469656E737465616E626965746572207A757374C3A46E646967656E205374656C6C656E2C20646965206469652045696E68616C74756E672064657220566F7273636872696674656E207A756D20446174656E73636875747A206B6F6E74726F6C6C696572656E3A0D0A4265726C696E6572204265617566747261677465722066C3BC7220446174656E73636875747A20756E6420496E666F726D6174696F6E7366726569686569740D0A416E20646572205572616E696120342D31300D0A3130373837204265726C696E0D0A3033302F3133382038392D300D0A6D61696C626F7840646174656E73636875747A2D6265726C696E2E64650D0A687474703A2F2F7777772E646174656E73636875747A2D6265726C696E2E64650D0A416E737072656368706172746E65723A2044722E20416C6578616E64657220446978");
+
+			return {
+				{"IFDEstablishContext", R"({"Protocol": "IFDInterface_WebSocket_v2", "UDName": "MAC-MINI", "msg": "IFDEstablishContext"})"},
+				{"IFDConnect", R"({"ContextHandle": "TestContext", "SlotName": "SlotName", "exclusive": true, "msg": "IFDConnect"})"},
+				{"IFDStatus", R"({"CardAvailable": false, "ConnectedReader": false, "ContextHandle": "TestContext", "EFATR": null, "EFDIR": null, "MaxAPDULength": 500, "PINPad": true, "SlotName": "SlotName", "msg": "IFDStatus"})"},
+				{"IFDTransmit", R"({"ContextHandle": "TestContext", "InputAPDU": "00a402022f00", "SlotHandle": "SlotHandle", "msg": "IFDTransmit"})"},
+				{"IFDTransmit batch", R"({"CommandAPDUs": [{"AcceptableStatusCodes": ["9000"], "InputAPDU": "00a402022f00"}, {"AcceptableStatusCodes": null, "InputAPDU": "00b0000000"}], "ContextHandle": "TestContext", "SlotHandle": "SlotHandle", "msg": "IFDTransmit"})"},
+				{"IFDTransmitResponse", R"({"ContextHandle": "TestContext", "ResponseAPDU": "9000", "ResultMajor": "http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok", "ResultMinor": null, "SlotHandle": "SlotHandle", "msg": "IFDTransmitResponse"})"},
+				{"IFDTransmitResponse batch", R"({"ContextHandle": "TestContext", "ResponseAPDUs": ["9000", "6300"], "ResultMajor": "http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok", "ResultMinor": null, "SlotHandle": "SlotHandle", "msg": "IFDTransmitResponse"})"},
+				{"IFDEstablishPACEChannel", QByteArray(R"({"ContextHandle": "TestContext", "InputData": "0315[CHAT]00A802[CERT]", "PreferredPinLength": 6, "SlotHandle": "SlotHandle", "msg": "IFDEstablishPACEChannel"})").replace("[CHAT]", chat).replace("[CERT]", certificateDescription)},
+				{"IFDEstablishPACEChannelResponse", QByteArray(R"({"ContextHandle": "TestContext", "OutputData": "[DATA]", "ResultCode": "00000000", "ResultMajor": "http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok", "ResultMinor": null, "SlotHandle": "SlotHandle", "msg": "IFDEstablishPACEChannelResponse"})").replace("[DATA]", EstablishPaceChannelOutput(CardReturnCode::OK).toOutputData().toHex())},
+				{"IFDModifyPIN", R"({"ContextHandle": "TestContext", "InputData": "abcd1234", "SlotHandle": "SlotHandle", "msg": "IFDModifyPIN"})"},
+				{"IFDModifyPINResponse", R"({"ContextHandle": "TestContext", "OutputData": "abcd1234", "ResultMajor": "http://www.bsi.bund.de/ecard/api/1.1/resultmajor#ok", "ResultMinor": null, "SlotHandle": "SlotHandle", "msg": "IFDModifyPINResponse"})"}
+			};
+		}
+
+
+		static QSharedPointer<const RemoteMessage> createMessage(const RemoteMessageObject& pMessageObject)
+		{
+			switch (RemoteMessage(pMessageObject).getType())
+			{
+				case RemoteCardMessageType::IFDEstablishContext:
+					return QSharedPointer<const RemoteMessage>(new IfdEstablishContext(pMessageObject));
+
+				case RemoteCardMessageType::IFDConnect:
+					return QSharedPointer<const RemoteMessage>(new IfdConnect(pMessageObject));
+
+				case RemoteCardMessageType::IFDStatus:
+					return QSharedPointer<const RemoteMessage>(new IfdStatus(pMessageObject));
+
+				case RemoteCardMessageType::IFDTransmit:
+					return QSharedPointer<const RemoteMessage>(new IfdTransmit(pMessageObject));
+
+				case RemoteCardMessageType::IFDTransmitResponse:
+					return QSharedPointer<const RemoteMessage>(new IfdTransmitResponse(pMessageObject));
+
+				case RemoteCardMessageType::IFDEstablishPACEChannel:
+					return QSharedPointer<const RemoteMessage>(new IfdEstablishPaceChannel(pMessageObject));
+
+				case RemoteCardMessageType::IFDEstablishPACEChannelResponse:
+					return QSharedPointer<const RemoteMessage>(new IfdEstablishPaceChannelResponse(pMessageObject));
+
+				case RemoteCardMessageType::IFDModifyPIN:
+					return QSharedPointer<const RemoteMessage>(new IfdModifyPin(pMessageObject));
+
+				case RemoteCardMessageType::IFDModifyPINResponse:
+					return QSharedPointer<const RemoteMessage>(new IfdModifyPinResponse(pMessageObject));
+
+				default:
+					return QSharedPointer<const RemoteMessage>(new RemoteMessage(pMessageObject));
+			}
+		}
+
 	private Q_SLOTS:
 		void initTestCase()
 		{
@@ -125,6 +202,113 @@ class test_RemoteMessage
 		}
 
 
+		void binaryEncoding_data()
+		{
+			QTest::addColumn<QByteArray>("json");
+
+			const auto& fixtures = createFixtures();
+			for (const auto& [name, json] : fixtures)
+			{
+				QTest::newRow(name.data()) << json;
+			}
+		}
+
+
+		void binaryEncoding()
+		{
+			QFETCH(QByteArray, json);
+
+			const auto& message = createMessage(RemoteMessage::parseByteArray(json));
+			QVERIFY(!message->isIncomplete());
+
+			const QString contextHandle = QStringLiteral("TestContext");
+			const QByteArray& v2 = message->toByteArray(IfdVersion::Version::v2, contextHandle);
+			const QByteArray& v4 = message->toByteArray(IfdVersion::Version::v4, contextHandle);
+			QVERIFY(!RemoteMessage::isBinary(v2));
+			QVERIFY(RemoteMessage::isBinary(v4));
+
+			const auto& fromCbor = createMessage(RemoteMessage::parseByteArray(v4));
+			QVERIFY(!fromCbor->isIncomplete());
+			QCOMPARE(fromCbor->toByteArray(IfdVersion::Version::v2, contextHandle), v2);
+			QCOMPARE(fromCbor->toByteArray(IfdVersion::Version::v4, contextHandle), v4);
+
+			const auto& jsonObject = RemoteMessage::parseByteArray(v2);
+			const auto& cborObject = RemoteMessage::parseByteArray(v4);
+			QVERIFY(!jsonObject.isCbor());
+			QVERIFY(cborObject.isCbor());
+			for (const auto& key : {"InputAPDU", "ResponseAPDU", "InputData", "OutputData", "ResultCode"})
+			{
+				const QLatin1String name(key);
+				QCOMPARE(jsonObject.isString(name), jsonObject.contains(name));
+				QCOMPARE(cborObject.isBinary(name), cborObject.contains(name));
+				QCOMPARE(cborObject.isString(name), false);
+			}
+
+			const QByteArray& compactJson = QJsonDocument(jsonObject.getJsonObject()).toJson(QJsonDocument::Compact);
+			QVERIFY(v4.size() < compactJson.size());
+		}
+
+
+		void invalidCbor()
+		{
+			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
+
+			const auto& obj = RemoteMessage::parseByteArray(QByteArray::fromHex("a2636d7367"));
+			QVERIFY(obj.isEmpty());
+
+			QCOMPARE(logSpy.count(), 2);
+			QVERIFY(logSpy.at(0).at(0).toString().contains(QString("Cbor parsing failed.")));
+			QVERIFY(logSpy.at(1).at(0).toString().contains(QString("Expected object at top level")));
+		}
+
+
+		void benchmarkEncoding_data()
+		{
+			QTest::addColumn<QByteArray>("json");
+			QTest::addColumn<IfdVersion::Version>("version");
+
+			const auto& fixtures = createFixtures();
+			for (const auto& [name, json] : fixtures)
+			{
+				QTest::addRow("%s json", name.data()) << json << IfdVersion::Version::v2;
+				QTest::addRow("%s cbor", name.data()) << json << IfdVersion::Version::v4;
+			}
+		}
+
+
+		void benchmarkEncoding()
+		{
+			QFETCH(QByteArray, json);
+			QFETCH(IfdVersion::Version, version);
+
+			const auto& message = createMessage(RemoteMessage::parseByteArray(json));
+			const QString contextHandle = QStringLiteral("TestContext");
+			QBENCHMARK
+			{
+				QVERIFY(!message->toByteArray(version, contextHandle).isEmpty());
+			}
+		}
+
+
+		void benchmarkDecoding_data()
+		{
+			benchmarkEncoding_data();
+		}
+
+
+		void benchmarkDecoding()
+		{
+			QFETCH(QByteArray, json);
+			QFETCH(IfdVersion::Version, version);
+
+			const QByteArray& data = createMessage(RemoteMessage::parseByteArray(json))->toByteArray(version, QStringLiteral("TestContext"));
+			QBENCHMARK
+			{
+				QVERIFY(!createMessage(RemoteMessage::parseByteArray(data))->isIncomplete());
+			}
+		}
+
+
 		void invalidJson()
 		{
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
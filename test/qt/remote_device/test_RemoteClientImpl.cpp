@@ -6,6 +6,7 @@
 
 #include "DatagramHandler.h"
 #include "Env.h"
+#include "KeyPair.h"
 #include "LogHandler.h"
 #include "messages/Discovery.h"
 #include "messages/IfdEstablishContext.h"
@@ -267,6 +268,84 @@ class test_RemoteClient
 		}
 
 
+		void testReceiveRepeated()
+		{
+			const auto& pem = QString::fromLatin1(KeyPair::generate().getCertificate().toPem());
+			const QByteArray offerJson = Discovery("Sony Xperia Z5 compact", pem, 24728, {IfdVersion::Version::latest}).toByteArray(IfdVersion::Version::latest);
+
+			RemoteClientImpl client;
+			client.startDetection();
+			QVERIFY(!mDatagramHandlerMock.isNull());
+			QSignalSpy spyAppeared(mRemoteDeviceListMock.data(), &RemoteDeviceListMock::fireDeviceAppeared);
+
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(offerJson, QHostAddress("192.168.1.88"));
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(offerJson, QHostAddress("192.168.1.88"));
+			QCOMPARE(spyAppeared.count(), 2);
+			QCOMPARE(client.mDiscoveryCache.size(), 1);
+
+			Q_EMIT mDatagramHandlerMock->fireNewMessage(offerJson, QHostAddress("192.168.1.89"));
+			QCOMPARE(spyAppeared.count(), 3);
+			QCOMPARE(client.mDiscoveryCache.size(), 2);
+
+			const auto& descriptor = client.mDiscoveryCache.value(QByteArray("192.168.1.89\n") + offerJson);
+			QCOMPARE(descriptor.getIfdName(), QStringLiteral("Sony Xperia Z5 compact"));
+			QCOMPARE(descriptor.getUrl(), QUrl(QStringLiteral("wss://192.168.1.89:24728")));
+
+			client.stopDetection();
+			QVERIFY(client.mDiscoveryCache.isEmpty());
+		}
+
+
+		void benchmarkFlood_data()
+		{
+			QTest::addColumn<bool>("cached");
+
+			QTest::newRow("parsed") << false;
+			QTest::newRow("cached") << true;
+		}
+
+
+		void benchmarkFlood()
+		{
+			QFETCH(bool, cached);
+
+			Env::setCreator<RemoteDeviceList*>(std::function<RemoteDeviceList* ()>([] {
+					return new RemoteDeviceListImpl();
+				}));
+
+			const QVector<QHostAddress> addresses({QHostAddress("192.168.1.88"), QHostAddress("fe80::5a38:a519:8ff4:1f1f%enp0s31f6")});
+			QVector<QByteArray> datagrams;
+			for (int i = 0; i < 20; ++i)
+			{
+				const auto& pem = QString::fromLatin1(KeyPair::generate().getCertificate().toPem());
+				datagrams += Discovery(QStringLiteral("Phone %1").arg(i), pem, 24728, {IfdVersion::Version::latest}).toByteArray(IfdVersion::Version::latest);
+			}
+
+			RemoteClientImpl client;
+			client.startDetection();
+			QVERIFY(!mDatagramHandlerMock.isNull());
+
+			// Every iteration receives one announcement per device and address.
+			QBENCHMARK
+			{
+				for (const auto& address : addresses)
+				{
+					for (const auto& datagram : qAsConst(datagrams))
+					{
+						if (!cached)
+						{
+							client.mDiscoveryCache.clear();
+						}
+						Q_EMIT mDatagramHandlerMock->fireNewMessage(datagram, address);
+					}
+				}
+			}
+			QCOMPARE(client.getAnnouncingRemoteDevices().size(), datagrams.size());
+
+			client.stopDetection();
+		}
+
+
 		void testRemoteConnectorThread()
 		{
 			QScopedPointer<RemoteClient> client(new RemoteClientImpl());
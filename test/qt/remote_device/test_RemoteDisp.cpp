@@ -31,7 +31,7 @@ class RemoteDispatcherSpy
 		bool mClosed;
 		GlobalStatus::Code mCloseCode;
 		QVector<RemoteCardMessageType> mReceivedMessageTypes;
-		QVector<QJsonObject> mReceivedMessages;
+		QVector<RemoteMessageObject> mReceivedMessages;
 		QVector<QString> mReceivedSignalSenders;
 
 	public:
@@ -41,12 +41,12 @@ class RemoteDispatcherSpy
 		[[nodiscard]] bool isClosed() const;
 		[[nodiscard]] GlobalStatus::Code getCloseCode() const;
 		[[nodiscard]] const QVector<RemoteCardMessageType>& getReceivedMessageTypes() const;
-		[[nodiscard]] const QVector<QJsonObject>& getReceivedMessages() const;
+		[[nodiscard]] const QVector<RemoteMessageObject>& getReceivedMessages() const;
 		[[nodiscard]] const QVector<QString>& getReceivedSignalSenders() const;
 
 	private Q_SLOTS:
 		void onClosed(GlobalStatus::Code pCloseCode, const QString& pId);
-		void onReceived(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId);
+		void onReceived(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject, const QString& pId);
 };
 
 
@@ -111,7 +111,7 @@ const QVector<RemoteCardMessageType>& RemoteDispatcherSpy::getReceivedMessageTyp
 }
 
 
-const QVector<QJsonObject>& RemoteDispatcherSpy::getReceivedMessages() const
+const QVector<RemoteMessageObject>& RemoteDispatcherSpy::getReceivedMessages() const
 {
 	return mReceivedMessages;
 }
@@ -131,11 +131,11 @@ void RemoteDispatcherSpy::onClosed(GlobalStatus::Code pCloseCode, const QString&
 }
 
 
-void RemoteDispatcherSpy::onReceived(RemoteCardMessageType pMessageType, const QJsonObject& pJsonObject, const QString& pId)
+void RemoteDispatcherSpy::onReceived(RemoteCardMessageType pMessageType, const RemoteMessageObject& pMessageObject, const QString& pId)
 {
 	qDebug() << "RemoteDispatcherSpy::onReceived() -" << pMessageType;
 	mReceivedMessageTypes += pMessageType;
-	mReceivedMessages += pJsonObject;
+	mReceivedMessages += pMessageObject;
 	mReceivedSignalSenders += pId;
 }
 
@@ -229,7 +229,7 @@ class test_RemoteDisp
 			clientDispatcher->send(QSharedPointer<const RemoteMessage>(new IfdDisconnect(QStringLiteral("NFC Reader"))));
 
 			const QVector<RemoteCardMessageType> receivedMessageTypes = spy.getReceivedMessageTypes();
-			const QVector<QJsonObject> receivedMessages = spy.getReceivedMessages();
+			const QVector<RemoteMessageObject> receivedMessages = spy.getReceivedMessages();
 			QCOMPARE(receivedMessageTypes.size(), 3);
 			QCOMPARE(receivedMessages.size(), 3);
 
@@ -83,15 +83,15 @@ class test_ServerMessageHandler
 		}
 
 
-		void ensureContext(QString& pContextHandle)
+		void ensureContext(QString& pContextHandle, IfdVersion::Version pVersion = IfdVersion::Version::v2)
 		{
 			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
 
-			const QByteArray establishContextMsg("{\n"
-												 "    \"msg\": \"IFDEstablishContext\",\n"
-												 "    \"Protocol\": \"IFDInterface_WebSocket_v2\",\n"
-												 "    \"UDName\": \"MAC-MINI\"\n"
-												 "}");
+			const QByteArray establishContextMsg = QByteArray("{\n"
+															  "    \"msg\": \"IFDEstablishContext\",\n"
+															  "    \"Protocol\": \"[PROTOCOL]\",\n"
+															  "    \"UDName\": \"MAC-MINI\"\n"
+															  "}").replace("[PROTOCOL]", IfdVersion(pVersion).toString().toLatin1());
 
 			mDataChannel->onReceived(establishContextMsg);
 
@@ -103,6 +103,7 @@ class test_ServerMessageHandler
 			const IfdEstablishContextResponse establishContextResponse(RemoteMessage::parseByteArray(establishContextResponseVariant.toByteArray()));
 			QVERIFY(!establishContextResponse.isIncomplete());
 			QCOMPARE(establishContextResponse.getType(), RemoteCardMessageType::IFDEstablishContextResponse);
+			QCOMPARE(establishContextResponse.isBatchTransmitSupported(), pVersion >= IfdVersion::Version::v2);
 
 			pContextHandle = establishContextResponse.getContextHandle();
 			QVERIFY(!pContextHandle.isEmpty());
@@ -537,6 +538,110 @@ class test_ServerMessageHandler
 		}
 
 
+		void ifdTransmitBatchStopsAtFirstUnacceptableStatusCode()
+		{
+			ServerMessageHandlerImpl serverMessageHandler(mDataChannel);
+			QString contextHandle;
+			ensureContext(contextHandle);
+
+			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
+
+			MockReader* reader = MockReaderManagerPlugIn::getInstance().addReader("test-reader");
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			reader->setCard(MockCardConfig({
+						{CardReturnCode::OK, QByteArray::fromHex("9000")},
+						{CardReturnCode::OK, QByteArray::fromHex("6300")},
+						{CardReturnCode::OK, QByteArray::fromHex("9000")}
+					}));
+			QTRY_COMPARE(sendSpy.count(), 2); // clazy:exclude=qstring-allocations
+			const CardInfo cardInfo(CardType::EID_CARD, QSharedPointer<const EFCardAccess>(), 3, true);
+			ReaderInfo info = reader->getReaderInfo();
+			info.setCardInfo(cardInfo);
+			reader->setReaderInfo(info);
+			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			sendSpy.clear();
+
+			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::v2, contextHandle);
+			mDataChannel->onReceived(ifdConnectMsg);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+
+			const IfdConnectResponse connectResponse(RemoteMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!connectResponse.resultHasError());
+			sendSpy.clear();
+
+			QVector<InputAPDUInfo> inputApduInfos;
+			for (const auto& apdu : {"00a4020c02011c", "00b0000000", "00a4020c02011d"})
+			{
+				InputAPDUInfo inputApduInfo(QByteArray::fromHex(apdu));
+				inputApduInfo.addAcceptableStatusCode(QByteArray("9000"));
+				inputApduInfos += inputApduInfo;
+			}
+
+			const QByteArray ifdTransmitMsg = IfdTransmit(connectResponse.getSlotHandle(), inputApduInfos).toByteArray(IfdVersion::Version::v2, contextHandle);
+			mDataChannel->onReceived(ifdTransmitMsg);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+
+			const IfdTransmitResponse transmitResponse(RemoteMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!transmitResponse.isIncomplete());
+			QCOMPARE(transmitResponse.getSlotHandle(), connectResponse.getSlotHandle());
+			QVERIFY(!transmitResponse.resultHasError());
+			QCOMPARE(transmitResponse.getResponseApdus(), QByteArrayList({QByteArray::fromHex("9000"), QByteArray::fromHex("6300")}));
+
+			removeReaderAndConsumeMessages(QStringLiteral("test-reader"));
+		}
+
+
+		void ifdTransmitBatchReturnsPartialResponsesOnFailure()
+		{
+			ServerMessageHandlerImpl serverMessageHandler(mDataChannel);
+			QString contextHandle;
+			ensureContext(contextHandle);
+
+			QSignalSpy sendSpy(mDataChannel.data(), &MockDataChannel::fireSend);
+
+			MockReader* reader = MockReaderManagerPlugIn::getInstance().addReader("test-reader");
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+			reader->setCard(MockCardConfig({
+						{CardReturnCode::OK, QByteArray::fromHex("9000")},
+						{CardReturnCode::COMMAND_FAILED, QByteArray()},
+						{CardReturnCode::OK, QByteArray::fromHex("9000")}
+					}));
+			QTRY_COMPARE(sendSpy.count(), 2); // clazy:exclude=qstring-allocations
+			const CardInfo cardInfo(CardType::EID_CARD, QSharedPointer<const EFCardAccess>(), 3, true);
+			ReaderInfo info = reader->getReaderInfo();
+			info.setCardInfo(cardInfo);
+			reader->setReaderInfo(info);
+			QTRY_COMPARE(sendSpy.count(), 3); // clazy:exclude=qstring-allocations
+			sendSpy.clear();
+
+			const QByteArray ifdConnectMsg = IfdConnect(QStringLiteral("test-reader"), true).toByteArray(IfdVersion::Version::v2, contextHandle);
+			mDataChannel->onReceived(ifdConnectMsg);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+
+			const IfdConnectResponse connectResponse(RemoteMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!connectResponse.resultHasError());
+			sendSpy.clear();
+
+			QVector<InputAPDUInfo> inputApduInfos;
+			for (const auto& apdu : {"00a4020c02011c", "00b0000000", "00a4020c02011d"})
+			{
+				inputApduInfos += InputAPDUInfo(QByteArray::fromHex(apdu));
+			}
+
+			const QByteArray ifdTransmitMsg = IfdTransmit(connectResponse.getSlotHandle(), inputApduInfos).toByteArray(IfdVersion::Version::v2, contextHandle);
+			mDataChannel->onReceived(ifdTransmitMsg);
+			QTRY_COMPARE(sendSpy.count(), 1); // clazy:exclude=qstring-allocations
+
+			const IfdTransmitResponse transmitResponse(RemoteMessage::parseByteArray(sendSpy.last().at(0).toByteArray()));
+			QVERIFY(!transmitResponse.isIncomplete());
+			QVERIFY(transmitResponse.resultHasError());
+			QCOMPARE(transmitResponse.getResultMinor(), ECardApiResult::Minor::AL_Unknown_Error);
+			QCOMPARE(transmitResponse.getResponseApdus(), QByteArrayList({QByteArray::fromHex("9000")}));
+
+			removeReaderAndConsumeMessages(QStringLiteral("test-reader"));
+		}
+
+
 		void ifdEstablishPACEChannelWithWrongReaderNameSendsIFDL_InvalidSlotHandle()
 		{
 			QSignalSpy logSpy(Env::getSingleton<LogHandler>()->getEventHandler(), &LogEventHandler::fireLog);
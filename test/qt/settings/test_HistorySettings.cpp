@@ -11,10 +11,9 @@
 
 #include "AppSettings.h"
 #include "Env.h"
+#include "HistoryStore.h"
 #include "VolatileSettings.h"
 
-#include "TestFileHelper.h"
-
 #include <QtCore>
 #include <QtTest>
 
@@ -80,7 +79,7 @@ class test_HistorySettings
 		{
 			SDK_MODE(false);
 			auto& settings = Env::getSingleton<AppSettings>()->getHistorySettings();
-			const auto file = AbstractSettings::mTestDir->path() + QStringLiteral("/dummy/Test_settings_HistorySettings.ini");
+			const auto file = AbstractSettings::getDataFilePath(QStringLiteral("history.dat"));
 
 			HistoryInfo info("pSubjectXYZ", "pSubjectUrlXYZ", "pUsageXYZ", QDateTime(), "pTermOfUsageXYZ", {"pRequestedDataXYZ"});
 			settings.addHistoryInfo(info);
@@ -89,22 +88,71 @@ class test_HistorySettings
 			settings.save();
 			QVERIFY(QFile::exists(file));
 
-			auto content = TestFileHelper::readFile(file);
-			QVERIFY(content.contains("pSubjectXYZ"));
-			QVERIFY(content.contains("pSubjectUrlXYZ"));
-			QVERIFY(content.contains("pUsageXYZ"));
-			QVERIFY(content.contains("pTermOfUsageXYZ"));
-			QVERIFY(content.contains("pRequestedDataXYZ"));
+			HistoryStore store(file);
+			QVERIFY(store.load());
+			QCOMPARE(store.getHistoryInfos(), QVector<HistoryInfo>(3, info));
 
 			settings.deleteSettings();
 			settings.save();
 
-			content = TestFileHelper::readFile(file);
-			QVERIFY(!content.contains("pSubjectXYZ"));
-			QVERIFY(!content.contains("pSubjectUrlXYZ"));
-			QVERIFY(!content.contains("pUsageXYZ"));
-			QVERIFY(!content.contains("pTermOfUsageXYZ"));
-			QVERIFY(!content.contains("pRequestedDataXYZ"));
+			QVERIFY(store.load());
+			QVERIFY(store.getHistoryInfos().isEmpty());
+		}
+
+
+		void testMigrateHistoryInfos()
+		{
+			SDK_MODE(false);
+			auto& settings = Env::getSingleton<AppSettings>()->getHistorySettings();
+			const auto file = AbstractSettings::getDataFilePath(QStringLiteral("history.dat"));
+			QVERIFY(QFile::remove(file));
+
+			const HistoryInfo info("pSubjectOld", "pSubjectUrlOld", "pUsageOld", QDateTime::fromString(QStringLiteral("2017-07-21T09:01:31"), Qt::ISODate), "pTermOfUsageOld", {"pRequestedDataOld"});
+			settings.mStore->beginWriteArray(QStringLiteral("items"));
+			settings.mStore->setArrayIndex(0);
+			settings.mStore->setValue(QStringLiteral("subjectName"), info.getSubjectName());
+			settings.mStore->setValue(QStringLiteral("subjectUrl"), info.getSubjectUrl());
+			settings.mStore->setValue(QStringLiteral("usage"), info.getPurpose());
+			settings.mStore->setValue(QStringLiteral("dateTime"), info.getDateTime().toString(Qt::ISODate));
+			settings.mStore->setValue(QStringLiteral("termOfUsage"), info.getTermOfUsage());
+			settings.mStore->setValue(QStringLiteral("requestedData"), info.getRequestedData());
+			settings.mStore->endArray();
+
+			QVERIFY(!settings.mHistoryStore.load());
+			settings.migrateHistoryInfos();
+			QCOMPARE(settings.getHistoryInfos(), QVector<HistoryInfo>({info}));
+			QVERIFY(!settings.mStore->contains(QStringLiteral("items/size")));
+
+			HistoryStore store(file);
+			QVERIFY(store.load());
+			QCOMPARE(store.getHistoryInfos(), QVector<HistoryInfo>({info}));
+		}
+
+
+		void testMigrateUnreadableStore()
+		{
+			SDK_MODE(false);
+			auto& settings = Env::getSingleton<AppSettings>()->getHistorySettings();
+			const auto file = AbstractSettings::getDataFilePath(QStringLiteral("history.dat"));
+			QFile::remove(file + QStringLiteral(".unreadable"));
+			{
+				QFile corrupt(file);
+				QVERIFY(corrupt.open(QIODevice::WriteOnly | QIODevice::Truncate));
+				corrupt.write("corrupt");
+			}
+
+			QTest::ignoreMessage(QtCriticalMsg, QStringLiteral("Unknown history store: \"%1\"").arg(file).toUtf8().constData());
+			QVERIFY(!settings.mHistoryStore.load());
+			settings.migrateHistoryInfos();
+			QVERIFY(QFile::exists(file + QStringLiteral(".unreadable")));
+
+			const HistoryInfo info("pSubject", "pSubjectUrl", "pUsage", QDateTime::fromString(QStringLiteral("2022-07-21T09:01:31"), Qt::ISODate), "pTermOfUsage", {"pRequestedData"});
+			settings.addHistoryInfo(info);
+
+			HistoryStore store(file);
+			QVERIFY(store.load());
+			QCOMPARE(store.getHistoryInfos(), QVector<HistoryInfo>({info}));
+			QVERIFY(QFile::remove(file + QStringLiteral(".unreadable")));
 		}
 
 
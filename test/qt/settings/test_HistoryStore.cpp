@@ -0,0 +1,205 @@
+/*!
+ * \brief Unit tests for \ref HistoryStore
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "HistoryStore.h"
+
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_HistoryStore
+	: public QObject
+{
+	Q_OBJECT
+
+	private:
+		QTemporaryDir mDir;
+
+		static HistoryInfo createInfo(int pIndex)
+		{
+			return HistoryInfo(QStringLiteral("Subject %1").arg(pIndex),
+					QStringLiteral("https://www.example.com/%1").arg(pIndex),
+					QStringLiteral("Purpose %1").arg(pIndex),
+					QDateTime::fromSecsSinceEpoch(1600000000 + pIndex, Qt::UTC),
+					QStringLiteral("Term of usage %1").arg(pIndex),
+					{QStringLiteral("GivenNames"), QStringLiteral("FamilyName")});
+		}
+
+
+		QString getFileName() const
+		{
+			return mDir.filePath(QStringLiteral("history.dat"));
+		}
+
+	private Q_SLOTS:
+		void init()
+		{
+			QFile::remove(getFileName());
+		}
+
+
+		void missingFile()
+		{
+			HistoryStore store(getFileName());
+			QVERIFY(!store.exists());
+			QVERIFY(!store.load());
+			QVERIFY(store.getHistoryInfos().isEmpty());
+		}
+
+
+		void unknownFile()
+		{
+			QFile file(getFileName());
+			QVERIFY(file.open(QIODevice::WriteOnly));
+			file.write("[history]\nitems\\size=0\n");
+			file.close();
+
+			HistoryStore store(getFileName());
+			QTest::ignoreMessage(QtCriticalMsg, QStringLiteral("Unknown history store: \"%1\"").arg(getFileName()).toUtf8().constData());
+			QVERIFY(!store.load());
+			QVERIFY(!store.exists());
+
+			QFile backup(getFileName() + QStringLiteral(".unreadable"));
+			QVERIFY(backup.open(QIODevice::ReadOnly));
+			QCOMPARE(backup.readAll(), QByteArray("[history]\nitems\\size=0\n"));
+			backup.close();
+			QVERIFY(backup.remove());
+
+			QVERIFY(store.append(createInfo(1)));
+			HistoryStore loaded(getFileName());
+			QVERIFY(loaded.load());
+			QCOMPARE(loaded.getHistoryInfos(), QVector<HistoryInfo>({createInfo(1)}));
+		}
+
+
+		void appendAndLoad()
+		{
+			HistoryStore store(getFileName());
+			QVERIFY(store.append(createInfo(1)));
+			QVERIFY(store.append(createInfo(2)));
+			QVERIFY(store.append(createInfo(3)));
+			QCOMPARE(store.getHistoryInfos(), QVector<HistoryInfo>({createInfo(3), createInfo(2), createInfo(1)}));
+
+			HistoryStore loaded(getFileName());
+			QVERIFY(loaded.load());
+			QCOMPARE(loaded.getHistoryInfos(), store.getHistoryInfos());
+		}
+
+
+		void appendOnlyWritesRecord()
+		{
+			HistoryStore store(getFileName());
+			QVERIFY(store.append(createInfo(1)));
+			const auto size = QFileInfo(getFileName()).size();
+
+			QVERIFY(store.append(createInfo(2)));
+			QCOMPARE(QFileInfo(getFileName()).size(), size + HistoryStore::encode(createInfo(2)).size());
+		}
+
+
+		void write()
+		{
+			HistoryStore store(getFileName());
+			for (int i = 0; i < 5; ++i)
+			{
+				QVERIFY(store.append(createInfo(i)));
+			}
+
+			const QVector<HistoryInfo> remaining({createInfo(3), createInfo(1)});
+			QVERIFY(store.write(remaining));
+			QCOMPARE(store.getHistoryInfos(), remaining);
+
+			HistoryStore loaded(getFileName());
+			QVERIFY(loaded.load());
+			QCOMPARE(loaded.getHistoryInfos(), remaining);
+
+			QVERIFY(store.write(QVector<HistoryInfo>()));
+			QVERIFY(loaded.load());
+			QVERIFY(loaded.getHistoryInfos().isEmpty());
+		}
+
+
+		void incompleteRecord_data()
+		{
+			QTest::addColumn<int>("missingBytes");
+
+			QTest::newRow("record") << 1;
+			QTest::newRow("length") << HistoryStore::encode(createInfo(2)).size() - 2;
+		}
+
+
+		void incompleteRecord()
+		{
+			QFETCH(int, missingBytes);
+
+			HistoryStore store(getFileName());
+			QVERIFY(store.append(createInfo(1)));
+			const auto validSize = QFileInfo(getFileName()).size();
+			QVERIFY(store.append(createInfo(2)));
+			QVERIFY(QFile::resize(getFileName(), QFileInfo(getFileName()).size() - missingBytes));
+
+			HistoryStore loaded(getFileName());
+			QTest::ignoreMessage(QtWarningMsg, QStringLiteral("Drop incomplete history record at %1").arg(validSize).toUtf8().constData());
+			QVERIFY(loaded.load());
+			QCOMPARE(loaded.getHistoryInfos(), QVector<HistoryInfo>({createInfo(1)}));
+			QCOMPARE(QFileInfo(getFileName()).size(), validSize);
+
+			QVERIFY(loaded.append(createInfo(3)));
+			QVERIFY(store.load());
+			QCOMPARE(store.getHistoryInfos(), QVector<HistoryInfo>({createInfo(3), createInfo(1)}));
+		}
+
+
+		void benchmark_data()
+		{
+			QTest::addColumn<int>("count");
+
+			QTest::newRow("100") << 100;
+			QTest::newRow("10000") << 10000;
+		}
+
+
+		void benchmark()
+		{
+			QFETCH(int, count);
+
+			QVector<HistoryInfo> historyInfos;
+			historyInfos.reserve(count);
+			for (int i = 0; i < count; ++i)
+			{
+				historyInfos += createInfo(i);
+			}
+
+			HistoryStore store(getFileName());
+			QVERIFY(store.write(historyInfos));
+
+			QBENCHMARK
+			{
+				HistoryStore loaded(getFileName());
+				QVERIFY(loaded.load());
+				QCOMPARE(loaded.getHistoryInfos().size(), count);
+			}
+		}
+
+
+		void benchmarkAppend()
+		{
+			HistoryStore store(getFileName());
+			QVERIFY(store.write(QVector<HistoryInfo>(10000, createInfo(0))));
+
+			int i = 0;
+			QBENCHMARK
+			{
+				QVERIFY(store.append(createInfo(++i)));
+			}
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_HistoryStore)
+#include "test_HistoryStore.moc"
@@ -318,6 +318,86 @@ class test_RemoteServiceSettings
 		}
 
 
+		void testTrustStoreWriteBehind()
+		{
+			const auto cert = KeyPair::generate().getCertificate();
+			const auto key = QStringLiteral("trustedRemoteInfo");
+
+			RemoteServiceSettings settings;
+			settings.addTrustedCertificate(cert);
+			QVERIFY(!settings.mStore->contains(key));
+			QCOMPARE(settings.getTrustedCertificates(), QList<QSslCertificate>({cert}));
+
+			QCoreApplication::processEvents();
+			QVERIFY(settings.mStore->contains(key));
+
+			settings.removeTrustedCertificate(cert);
+			settings.save();
+			const RemoteServiceSettings reloaded;
+			QVERIFY(reloaded.getTrustedCertificates().isEmpty());
+			QVERIFY(reloaded.getRemoteInfos().isEmpty());
+		}
+
+
+		void testTrustStoreReload()
+		{
+			const auto cert = KeyPair::generate().getCertificate();
+			const auto fingerprint = RemoteServiceSettings::generateFingerprint(cert);
+
+			{
+				RemoteServiceSettings settings;
+				settings.addTrustedCertificate(cert);
+				auto info = settings.getRemoteInfo(fingerprint);
+				info.setNameUnescaped(QStringLiteral("Desk 1"));
+				QVERIFY(settings.updateRemoteInfo(info));
+			}
+
+			RemoteServiceSettings settings;
+			QCOMPARE(settings.getTrustedCertificates(), QList<QSslCertificate>({cert}));
+			QCOMPARE(settings.getRemoteInfo(cert).getFingerprint(), fingerprint);
+			QCOMPARE(settings.getRemoteInfo(cert).getNameEscaped(), QStringLiteral("Desk 1"));
+		}
+
+
+		void benchmarkRemoteInfo_data()
+		{
+			QTest::addColumn<int>("count");
+
+			QTest::newRow("10") << 10;
+			QTest::newRow("300") << 300;
+		}
+
+
+		void benchmarkRemoteInfo()
+		{
+			QFETCH(int, count);
+
+			QVector<RemoteServiceSettings::RemoteInfo> infos;
+			QStringList fingerprints;
+			for (int i = 0; i < count; ++i)
+			{
+				fingerprints << QString::fromLatin1(QCryptographicHash::hash(QByteArray::number(i), QCryptographicHash::Sha256).toHex());
+				infos << RemoteServiceSettings::RemoteInfo(fingerprints.last(), QDateTime::currentDateTime());
+			}
+
+			RemoteServiceSettings settings;
+			settings.setRemoteInfos(infos);
+
+			QBENCHMARK
+			{
+				// One discovery datagram of every paired device
+				for (const auto& fingerprint : qAsConst(fingerprints))
+				{
+					auto info = settings.getRemoteInfo(fingerprint);
+					QCOMPARE(info.getFingerprint(), fingerprint);
+					info.setLastConnected(QDateTime::currentDateTime());
+					QVERIFY(settings.updateRemoteInfo(info));
+				}
+				QVERIFY(settings.getTrustedCertificates().isEmpty());
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_RemoteServiceSettings)
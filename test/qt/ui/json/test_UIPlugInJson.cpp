@@ -6,10 +6,18 @@
 
 #include "UIPlugInJson.h"
 
+#include "context/AuthContext.h"
+#include "controller/AuthController.h"
+#include "controller/WorkflowSessionManager.h"
 #include "LogHandler.h"
+#include "MockActivationContext.h"
+#include "MockReaderManagerPlugIn.h"
+#include "ReaderManager.h"
 
 #include <QtTest>
 
+Q_IMPORT_PLUGIN(MockReaderManagerPlugIn)
+
 using namespace governikus;
 
 class test_UIPlugInJson
@@ -31,9 +39,26 @@ class test_UIPlugInJson
 		}
 
 	private Q_SLOTS:
+		void initTestCase()
+		{
+			qRegisterMetaType<QSharedPointer<WorkflowContext> >("QSharedPointer<WorkflowContext>");
+
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			readerManager->init();
+			readerManager->isScanRunning(); // just to wait until initialization finished
+		}
+
+
+		void cleanupTestCase()
+		{
+			Env::getSingleton<ReaderManager>()->shutdown();
+		}
+
+
 		void cleanup()
 		{
 			Env::getSingleton<LogHandler>()->reset();
+			MockReaderManagerPlugIn::getInstance().removeAllReader();
 		}
 
 
@@ -73,6 +98,129 @@ class test_UIPlugInJson
 		}
 
 
+		void logPaged()
+		{
+			const auto logHandler = Env::getSingleton<LogHandler>();
+			logHandler->init();
+			logHandler->resetBacklog();
+			for (int i = 0; i < 3; ++i)
+			{
+				qDebug() << "Paged entry" << i;
+			}
+
+			QByteArray result;
+			UIPlugInJson api;
+			connect(&api, &UIPlugInJson::fireMessage, this, [&](const QByteArray& pMsg){result = pMsg;});
+			api.setEnabled();
+
+			api.doMessageProcessing(R"({"cmd": "GET_LOG", "offset": 0, "count": 2})");
+			auto json = getJsonObject(result);
+			QCOMPARE(json["msg"].toString(), QLatin1String("LOG"));
+			QCOMPARE(json["offset"].toInt(), 0);
+			QCOMPARE(json["count"].toInt(), 2);
+			QVERIFY(json["total"].toInt() >= 3);
+			QVERIFY(json["more"].toBool());
+			auto data = json["data"].toString();
+			QCOMPARE(data.count(QLatin1Char('\n')), 2);
+			QVERIFY(data.contains(QLatin1String("Paged entry 0")));
+			QVERIFY(data.contains(QLatin1String("Paged entry 1")));
+			QVERIFY(!data.contains(QLatin1String("Paged entry 2")));
+
+			result.clear();
+			api.doMessageProcessing(R"({"cmd": "GET_LOG", "offset": 2})");
+			json = getJsonObject(result);
+			QCOMPARE(json["offset"].toInt(), 2);
+			QCOMPARE(json["count"].toInt(), json["total"].toInt() - 2);
+			QVERIFY(!json["more"].toBool());
+			data = json["data"].toString();
+			QVERIFY(data.contains(QLatin1String("Paged entry 2")));
+			QVERIFY(!data.contains(QLatin1String("Paged entry 1")));
+
+			result.clear();
+			api.doMessageProcessing(R"({"cmd": "GET_LOG", "offset": 1000000, "count": 5})");
+			json = getJsonObject(result);
+			QCOMPARE(json["count"].toInt(), 0);
+			QVERIFY(!json["more"].toBool());
+			QCOMPARE(json["data"].toString(), QString());
+
+			result.clear();
+			api.doMessageProcessing(R"({"cmd": "GET_LOG", "count": 0})");
+			json = getJsonObject(result);
+			QCOMPARE(json["error"].toString(), QLatin1String("Invalid count"));
+			QVERIFY(!json.contains(QLatin1String("data")));
+
+			result.clear();
+			api.doMessageProcessing(R"({"cmd": "GET_LOG", "offset": "first"})");
+			json = getJsonObject(result);
+			QCOMPARE(json["error"].toString(), QLatin1String("Invalid offset"));
+		}
+
+
+		void sessions()
+		{
+			const int sessionCount = 2;
+			for (int i = 0; i < sessionCount; ++i)
+			{
+				const QString name = QStringLiteral("MockReader %1").arg(i);
+				MockReaderManagerPlugIn::getInstance().addReader(name)->setCard(MockCardConfig());
+				QTRY_VERIFY(Env::getSingleton<ReaderManager>()->getReaderInfo(name).hasEidCard()); // clazy:exclude=qstring-allocations
+			}
+
+			QVector<QJsonObject> messages;
+			UIPlugInJson api;
+			connect(&api, &UIPlugInJson::fireMessage, this, [&](const QByteArray& pMsg){messages += getJsonObject(pMsg);});
+			api.setEnabled();
+
+			WorkflowSessionManager manager(sessionCount);
+			connect(&manager, &WorkflowSessionManager::fireSessionStarted, &api, &UIPlugIn::onSessionStarted);
+			connect(&manager, &WorkflowSessionManager::fireSessionFinished, &api, &UIPlugIn::onSessionFinished);
+			QSignalSpy spyAllFinished(&manager, &WorkflowSessionManager::fireAllSessionsFinished);
+
+			// Only the dispatcher of each session drives its AuthController through the states.
+			QVector<QSharedPointer<AuthContext> > contexts;
+			for (int i = 0; i < sessionCount; ++i)
+			{
+				contexts += QSharedPointer<AuthContext>::create(QSharedPointer<MockActivationContext>::create(true, false, true, true));
+				QVERIFY(manager.start<AuthController>(contexts.last()));
+			}
+			QTRY_COMPARE(spyAllFinished.count(), 1); // clazy:exclude=qstring-allocations
+
+			for (int i = 0; i < sessionCount; ++i)
+			{
+				QVERIFY(contexts.at(i)->isWorkflowFinished());
+
+				const auto& id = QString::number(i + 1);
+				QVector<QJsonObject> sessionMessages;
+				std::copy_if(messages.constBegin(), messages.constEnd(), std::back_inserter(sessionMessages), [&id](const QJsonObject& pObj){
+						return pObj[QLatin1String("session")].toString() == id;
+					});
+				QCOMPARE(sessionMessages.size(), 2);
+				QCOMPARE(sessionMessages.first()[QLatin1String("msg")].toString(), QLatin1String("AUTH"));
+				QVERIFY(!sessionMessages.first().contains(QLatin1String("result")));
+				QCOMPARE(sessionMessages.last()[QLatin1String("msg")].toString(), QLatin1String("AUTH"));
+				QVERIFY(sessionMessages.last().contains(QLatin1String("result")));
+			}
+
+			messages.clear();
+			api.doMessageProcessing(R"({"cmd": "CANCEL", "session": "1"})");
+			QCOMPARE(messages.size(), 1);
+			QCOMPARE(messages.first()[QLatin1String("msg")].toString(), QLatin1String("INVALID"));
+			QCOMPARE(messages.first()[QLatin1String("error")].toString(), QLatin1String("Unknown session"));
+
+			messages.clear();
+			api.doMessageProcessing(R"({"cmd": "CANCEL", "session": 1})");
+			QCOMPARE(messages.size(), 1);
+			QCOMPARE(messages.first()[QLatin1String("msg")].toString(), QLatin1String("INVALID"));
+			QCOMPARE(messages.first()[QLatin1String("error")].toString(), QLatin1String("Session must be a string"));
+
+			messages.clear();
+			api.doMessageProcessing(R"({"cmd": "GET_READER", "name": "\"session\""})");
+			QCOMPARE(messages.size(), 1);
+			QCOMPARE(messages.first()[QLatin1String("msg")].toString(), QLatin1String("READER"));
+			QVERIFY(!messages.first().contains(QLatin1String("session")));
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_UIPlugInJson)
@@ -9,6 +9,7 @@
 #include "AppSettings.h"
 #include "Env.h"
 #include "ProviderConfiguration.h"
+#include "VolatileSettings.h"
 
 #include <QDebug>
 #include <QtTest>
@@ -225,6 +226,120 @@ class test_HistoryModel
 		}
 
 
+		void test_SearchFilter_data()
+		{
+			QTest::addColumn<QString>("filter");
+			QTest::addColumn<int>("count");
+
+			QTest::newRow("empty") << QString() << 3;
+			QTest::newRow("subject") << QStringLiteral("subject b") << 1;
+			QTest::newRow("case") << QStringLiteral("SUBJECT") << 3;
+			QTest::newRow("purpose") << QStringLiteral("purpose c") << 1;
+			QTest::newRow("date") << QStringLiteral("24.12.2021") << 1;
+			QTest::newRow("acrossFields") << QStringLiteral("A Purpose") << 0;
+			QTest::newRow("unknown") << QStringLiteral("unknown") << 0;
+		}
+
+
+		void test_SearchFilter()
+		{
+			QFETCH(QString, filter);
+			QFETCH(int, count);
+
+			const QDateTime dateTime(QDate(2021, 12, 24), QTime(12, 0));
+			Env::getSingleton<AppSettings>()->getHistorySettings().setHistoryInfos({
+						HistoryInfo("Subject A", "https://a.de", "Purpose A", dateTime, "TermOfUsage", {}),
+						HistoryInfo("Subject B", "https://b.de", "Purpose B", dateTime.addDays(1), "TermOfUsage", {}),
+						HistoryInfo("Subject C", "https://c.de", "Purpose C", dateTime.addDays(2), "TermOfUsage", {})
+					});
+
+			auto* searchFilter = mModel->getHistoryModelSearchFilter();
+			searchFilter->setFilterString(filter);
+			QCOMPARE(searchFilter->rowCount(), count);
+		}
+
+
+		void test_SearchFilterUpdate()
+		{
+			SDK_MODE(false);
+			auto& settings = Env::getSingleton<AppSettings>()->getHistorySettings();
+			settings.setHistoryInfos({HistoryInfo("Subject A", "https://a.de", "Purpose A", QDateTime::currentDateTime(), "TermOfUsage", {})});
+
+			auto* searchFilter = mModel->getHistoryModelSearchFilter();
+			searchFilter->setFilterString(QStringLiteral("subject b"));
+			QCOMPARE(searchFilter->rowCount(), 0);
+
+			settings.addHistoryInfo(HistoryInfo("Subject B", "https://b.de", "Purpose B", QDateTime::currentDateTime(), "TermOfUsage", {}));
+			QCOMPARE(searchFilter->rowCount(), 1);
+
+			settings.setHistoryInfos({});
+			QCOMPARE(searchFilter->rowCount(), 0);
+		}
+
+
+		void test_SearchFilterSourceModelChanged()
+		{
+			auto& settings = Env::getSingleton<AppSettings>()->getHistorySettings();
+			settings.setHistoryInfos({HistoryInfo("Subject A", "https://a.de", "Purpose A", QDateTime::currentDateTime(), "TermOfUsage", {})});
+
+			auto* searchFilter = mModel->getHistoryModelSearchFilter();
+			searchFilter->setSourceModel(nullptr);
+			searchFilter->setSourceModel(mModel.data());
+			QCOMPARE(searchFilter->mSourceConnections.size(), 4);
+
+			searchFilter->setFilterString(QStringLiteral("subject b"));
+			QCOMPARE(searchFilter->rowCount(), 0);
+
+			settings.addHistoryInfo(HistoryInfo("Subject B", "https://b.de", "Purpose B", QDateTime::currentDateTime(), "TermOfUsage", {}));
+			QCOMPARE(searchFilter->rowCount(), 1);
+
+			searchFilter->setSourceModel(mModel.data());
+			QCOMPARE(searchFilter->mSourceConnections.size(), 4);
+			QCOMPARE(searchFilter->rowCount(), 1);
+		}
+
+
+		void test_SearchFilterLanguageChanged()
+		{
+			Env::getSingleton<AppSettings>()->getHistorySettings().setHistoryInfos({
+						HistoryInfo("Subject A", "https://a.de", "Purpose A", QDateTime::currentDateTime(), "TermOfUsage", {})
+					});
+
+			auto* searchFilter = mModel->getHistoryModelSearchFilter();
+			searchFilter->setFilterString(QStringLiteral("subject a"));
+			QCOMPARE(searchFilter->rowCount(), 1);
+			QCOMPARE(searchFilter->mSearchIndex.size(), 1);
+
+			searchFilter->mSearchIndex[0] = QStringLiteral("stale");
+			Q_EMIT Env::getSingleton<AppSettings>()->getGeneralSettings().fireLanguageChanged();
+			QCOMPARE(searchFilter->rowCount(), 1);
+			QCOMPARE(searchFilter->mSearchIndex.size(), 1);
+			QVERIFY(searchFilter->mSearchIndex.at(0) != QLatin1String("stale"));
+		}
+
+
+		void benchmarkSearchFilter()
+		{
+			QVector<HistoryInfo> infos;
+			for (int i = 0; i < 1000; ++i)
+			{
+				infos += HistoryInfo(QStringLiteral("Subject %1").arg(i), "https://www.autentapp.de/bla1", QStringLiteral("Purpose %1").arg(i), QDateTime::currentDateTime(), "TermOfUsage", {"GivenNames", "FamilyName"});
+			}
+			Env::getSingleton<AppSettings>()->getHistorySettings().setHistoryInfos(infos);
+
+			auto* searchFilter = mModel->getHistoryModelSearchFilter();
+			const QStringList filters({QStringLiteral("s"), QStringLiteral("su"), QStringLiteral("sub"), QStringLiteral("subject 99")});
+			QBENCHMARK
+			{
+				for (const auto& filter : filters)
+				{
+					searchFilter->setFilterString(filter);
+				}
+			}
+			QCOMPARE(searchFilter->rowCount(), 11);
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_HistoryModel)
@@ -148,6 +148,81 @@ class test_LogModel
 		}
 
 
+		void test_FetchMoreCurrentLogFile()
+		{
+			const auto logHandler = Env::getSingleton<LogHandler>();
+			logHandler->setUseHandler(false);
+			logHandler->resetBacklog();
+
+			const int lines = LogModel::FETCH_SIZE + 100;
+			for (int i = 0; i < lines; ++i)
+			{
+				qDebug() << "entry" << i;
+			}
+
+			resetModel(new LogModel());
+			QCOMPARE(mModel->rowCount(), LogModel::FETCH_SIZE);
+			QVERIFY(mModel->canFetchMore(QModelIndex()));
+			QVERIFY(mModel->mLogEntries.first().endsWith(QLatin1String("entry 0")));
+
+			// Messages are not appended until all previous lines are fetched
+			QSignalSpy spyNewLogMsg(mModel, &LogModel::fireNewLogMsg);
+			qDebug() << "entry" << lines;
+			QCOMPARE(spyNewLogMsg.count(), 0);
+			QCOMPARE(mModel->rowCount(), LogModel::FETCH_SIZE);
+
+			mModel->fetchMore(QModelIndex());
+			QCOMPARE(mModel->rowCount(), lines + 1);
+			QVERIFY(!mModel->canFetchMore(QModelIndex()));
+			QVERIFY(mModel->mLogEntries.last().endsWith(QStringLiteral("entry %1").arg(lines)));
+
+			qDebug() << "entry" << lines + 1;
+			QCOMPARE(spyNewLogMsg.count(), 1);
+			QCOMPARE(mModel->rowCount(), lines + 2);
+			QVERIFY(!mModel->canFetchMore(QModelIndex()));
+
+			logHandler->setUseHandler(true);
+		}
+
+
+		void test_FetchMoreOtherLogFile()
+		{
+			const int lines = 2 * LogModel::FETCH_SIZE + 1;
+			QString fileName;
+			{
+				QTemporaryFile oldLogfile(LogHandler::getLogFileTemplate());
+				oldLogfile.setAutoRemove(false);
+				QVERIFY(oldLogfile.open());
+				for (int i = 0; i < lines; ++i)
+				{
+					oldLogfile.write(QByteArrayLiteral("old entry ") + QByteArray::number(i) + '\n');
+				}
+				fileName = oldLogfile.fileName();
+			}
+
+			resetModel(new LogModel());
+			const int index = mModel->mLogFiles.indexOf(QFileInfo(fileName).absoluteFilePath());
+			QVERIFY(index > 0);
+			mModel->setLogFile(index);
+			QVERIFY(mModel->mOtherLogFile);
+			QCOMPARE(mModel->mOtherLogFile->getLineCount(), lines);
+
+			QCOMPARE(mModel->rowCount(), LogModel::FETCH_SIZE);
+			QVERIFY(mModel->canFetchMore(QModelIndex()));
+			mModel->fetchMore(QModelIndex());
+			QCOMPARE(mModel->rowCount(), 2 * LogModel::FETCH_SIZE);
+			mModel->fetchMore(QModelIndex());
+			QCOMPARE(mModel->rowCount(), lines);
+			QVERIFY(!mModel->canFetchMore(QModelIndex()));
+			QCOMPARE(mModel->mLogEntries.first(), QStringLiteral("old entry 0"));
+			QCOMPARE(mModel->mLogEntries.last(), QStringLiteral("old entry %1").arg(lines - 1));
+
+			mModel->removeCurrentLogFile();
+			QVERIFY(!mModel->mOtherLogFile);
+			QVERIFY(!QFile::exists(fileName));
+		}
+
+
 		void test_RemoveOldLogfile()
 		{
 			{
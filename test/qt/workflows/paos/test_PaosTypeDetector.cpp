@@ -0,0 +1,118 @@
+/*!
+ * \brief Unit tests for \ref PaosTypeDetector
+ *
+ * \copyright Copyright (c) 2022 Governikus GmbH & Co. KG, Germany
+ */
+
+#include "paos/PaosTypeDetector.h"
+
+#include "paos/PaosHandler.h"
+#include "TestFileHelper.h"
+
+#include <QtTest>
+
+using namespace governikus;
+
+
+class test_PaosTypeDetector
+	: public QObject
+{
+	Q_OBJECT
+
+	private Q_SLOTS:
+		void detect_data()
+		{
+			QTest::addColumn<QString>("fileName");
+			QTest::addColumn<int>("chunkSize");
+			QTest::addColumn<PaosType>("type");
+
+			const QVector<int> chunkSizes({1, 64, 1024 * 1024});
+			for (int chunkSize : chunkSizes)
+			{
+				QTest::newRow(qPrintable(QStringLiteral("DIDAuthenticateEAC1 %1").arg(chunkSize))) << ":/paos/DIDAuthenticateEAC1.xml" << chunkSize << PaosType::DID_AUTHENTICATE_EAC1;
+				QTest::newRow(qPrintable(QStringLiteral("DIDAuthenticateEAC1_2 %1").arg(chunkSize))) << ":/paos/DIDAuthenticateEAC1_2.xml" << chunkSize << PaosType::DID_AUTHENTICATE_EAC1;
+				QTest::newRow(qPrintable(QStringLiteral("DIDAuthenticateEAC2 %1").arg(chunkSize))) << ":/paos/DIDAuthenticateEAC2.xml" << chunkSize << PaosType::DID_AUTHENTICATE_EAC2;
+				QTest::newRow(qPrintable(QStringLiteral("DIDAuthenticateEACAdditionalInput %1").arg(chunkSize))) << ":/paos/DIDAuthenticateEACAdditionalInput.xml" << chunkSize << PaosType::DID_AUTHENTICATE_EAC_ADDITIONAL_INPUT_TYPE;
+				QTest::newRow(qPrintable(QStringLiteral("DIDList %1").arg(chunkSize))) << ":/paos/DIDList.xml" << chunkSize << PaosType::DID_LIST;
+				QTest::newRow(qPrintable(QStringLiteral("Disconnect %1").arg(chunkSize))) << ":/paos/Disconnect.xml" << chunkSize << PaosType::DISCONNECT;
+				QTest::newRow(qPrintable(QStringLiteral("InitializeFramework %1").arg(chunkSize))) << ":/paos/InitializeFramework.xml" << chunkSize << PaosType::INITIALIZE_FRAMEWORK;
+				QTest::newRow(qPrintable(QStringLiteral("StartPAOSResponse %1").arg(chunkSize))) << ":/paos/StartPAOSResponse1.xml" << chunkSize << PaosType::STARTPAOS_RESPONSE;
+				QTest::newRow(qPrintable(QStringLiteral("Transmit %1").arg(chunkSize))) << ":/paos/Transmit.xml" << chunkSize << PaosType::TRANSMIT;
+			}
+		}
+
+
+		void detect()
+		{
+			QFETCH(QString, fileName);
+			QFETCH(int, chunkSize);
+			QFETCH(PaosType, type);
+
+			const QByteArray& data = TestFileHelper::readFile(fileName);
+			PaosTypeDetector detector;
+			int position = 0;
+			while (!detector.isFinished() && position < data.size())
+			{
+				detector.addData(data.mid(position, chunkSize));
+				position += chunkSize;
+			}
+
+			QVERIFY(detector.isFinished());
+			QCOMPARE(detector.getDetectedPaosType(), type);
+			QCOMPARE(PaosHandler(data, detector.getDetectedPaosType()).getDetectedPaosType(), type);
+		}
+
+
+		void detectBeforeEnd()
+		{
+			const QByteArray& data = TestFileHelper::readFile(":/paos/DIDAuthenticateEAC1.xml");
+			const int bodyPosition = data.indexOf("AuthenticationProtocolData");
+			QVERIFY(bodyPosition > 0);
+
+			PaosTypeDetector detector;
+			detector.addData(data.left(bodyPosition));
+			QVERIFY(!detector.isFinished());
+			QCOMPARE(detector.getDetectedPaosType(), PaosType::UNKNOWN);
+
+			detector.addData(data.mid(bodyPosition, data.size() / 2 - bodyPosition));
+			QVERIFY(detector.isFinished());
+			QCOMPARE(detector.getDetectedPaosType(), PaosType::DID_AUTHENTICATE_EAC1);
+
+			detector.clear();
+			QVERIFY(!detector.isFinished());
+			QCOMPARE(detector.getDetectedPaosType(), PaosType::UNKNOWN);
+		}
+
+
+		void unknown_data()
+		{
+			QTest::addColumn<QByteArray>("data");
+			QTest::addColumn<bool>("invalid");
+
+			QTest::newRow("noEnvelope") << QByteArray("<?xml version=\"1.0\"?><root><Body><Transmit/></Body></root>") << false;
+			QTest::newRow("unknownElement") << QByteArray("<Envelope><Header/><Body><Unknown><Transmit/></Unknown></Body><Trailing/></Envelope>") << false;
+			QTest::newRow("unknownProtocol") << QByteArray("<Envelope><Body><DIDAuthenticate><AuthenticationProtocolData type=\"Unknown\"/></DIDAuthenticate></Body></Envelope>") << false;
+			QTest::newRow("invalid") << QByteArray("<Envelope><Body></Envelope>") << true;
+		}
+
+
+		void unknown()
+		{
+			QFETCH(QByteArray, data);
+			QFETCH(bool, invalid);
+
+			PaosTypeDetector detector;
+			if (invalid)
+			{
+				QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Cannot detect type of PAOS message: .*"));
+			}
+			detector.addData(data);
+			QVERIFY(detector.isFinished());
+			QCOMPARE(detector.getDetectedPaosType(), PaosType::UNKNOWN);
+		}
+
+
+};
+
+QTEST_GUILESS_MAIN(test_PaosTypeDetector)
+#include "test_PaosTypeDetector.moc"
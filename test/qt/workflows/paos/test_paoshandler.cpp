@@ -8,6 +8,7 @@
 #include <QtTest>
 
 #include "paos/PaosHandler.h"
+#include "paos/retrieve/Transmit.h"
 #include "TestFileHelper.h"
 
 
@@ -93,6 +94,73 @@ class test_paoshandler
 		}
 
 
+		void parseHeader()
+		{
+			const QByteArray data = TestFileHelper::readFile(":/paos/DIDAuthenticateEAC1_2.xml");
+			PaosHandler handler(data);
+			QCOMPARE(handler.getDetectedPaosType(), PaosType::DID_AUTHENTICATE_EAC1);
+			QVERIFY(handler.getPaosMessage());
+			QCOMPARE(handler.getPaosMessage()->getMessageId(), QStringLiteral("urn:uuid47A9D64C907D464EB599E8AF97D312A5"));
+		}
+
+
+		void parseTransmitWithManyApdus()
+		{
+			QByteArray apdus;
+			for (int i = 0; i < 500; ++i)
+			{
+				apdus += "<InputAPDU>00A4040C</InputAPDU></InputAPDUInfo><InputAPDUInfo>";
+			}
+			apdus += "<InputAPDU>00B0000000</InputAPDU>";
+
+			QByteArray data = TestFileHelper::readFile(":/paos/Transmit_template.xml");
+			data.replace("<!-- SLOTHANDLE -->", "<SlotHandle>4549445F</SlotHandle>");
+			data.replace("<!-- INPUTAPDU -->", apdus);
+
+			PaosHandler handler(data);
+			QCOMPARE(handler.getDetectedPaosType(), PaosType::TRANSMIT);
+			const auto transmit = handler.getPaosMessage().staticCast<Transmit>();
+			QCOMPARE(transmit->getInputApduInfos().size(), 501);
+			QCOMPARE(transmit->getInputApduInfos().last().getInputApdu().getBuffer(), QByteArray::fromHex("00B0000000"));
+		}
+
+
+		void parseDuplicateMessage()
+		{
+			QByteArray data = TestFileHelper::readFile(":/paos/Disconnect.xml");
+			data.replace("</soap:Body>", "<Disconnect/></soap:Body>");
+
+			PaosHandler handler(data);
+			QCOMPARE(handler.getDetectedPaosType(), PaosType::UNKNOWN);
+			QVERIFY(handler.getPaosMessage().isNull());
+		}
+
+
+		void benchmarkParse_data()
+		{
+			QTest::addColumn<QString>("file");
+
+			QTest::newRow("Transmit") << QStringLiteral(":/paos/Transmit.xml");
+			QTest::newRow("DIDAuthenticateEAC1") << QStringLiteral(":/paos/DIDAuthenticateEAC1.xml");
+			QTest::newRow("DIDAuthenticateEAC2") << QStringLiteral(":/paos/DIDAuthenticateEAC2.xml");
+			QTest::newRow("InitializeFramework") << QStringLiteral(":/paos/InitializeFramework.xml");
+			QTest::newRow("StartPAOSResponse") << QStringLiteral(":/paos/StartPAOSResponse1.xml");
+		}
+
+
+		void benchmarkParse()
+		{
+			QFETCH(QString, file);
+			const QByteArray data = TestFileHelper::readFile(file);
+
+			QBENCHMARK
+			{
+				PaosHandler handler(data);
+				QVERIFY(handler.getPaosMessage());
+			}
+		}
+
+
 };
 
 QTEST_GUILESS_MAIN(test_paoshandler)
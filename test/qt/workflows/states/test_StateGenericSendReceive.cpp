@@ -246,6 +246,58 @@ class test_StateGenericSendReceive
 		}
 
 
+		void sendInitializeFrameworkResponse_receiveDIDAuthenticateEAC1Chunked()
+		{
+			const QByteArray& data = TestFileHelper::readFile(":/paos/DIDAuthenticateEAC1.xml");
+			auto* reply = new MockNetworkReply(data);
+			mNetworkManager->setNextReply(reply);
+			QSharedPointer<InitializeFrameworkResponse> initializeFrameworkResponse(new InitializeFrameworkResponse());
+			mAuthContext->setInitializeFrameworkResponse(initializeFrameworkResponse);
+
+			QSignalSpy spy(mState.data(), &StateSendInitializeFrameworkResponse::fireReceivedExtractCvcsFromEac1InputType);
+			QSignalSpy spyMock(mNetworkManager.data(), &MockNetworkManager::fireReply);
+			QSignalSpy spyReadyRead(reply, &QNetworkReply::readyRead);
+
+			mAuthContext->setStateApproved();
+			QTRY_COMPARE(spyMock.count(), 1); // clazy:exclude=qstring-allocations
+			reply->fireReadyReadChunked(64);
+			QVERIFY(spyReadyRead.count() >= 2);
+			QCOMPARE(mState->mTypeDetector.getDetectedPaosType(), PaosType::DID_AUTHENTICATE_EAC1);
+			QCOMPARE(mState->mReceivedData, data);
+			QCOMPARE(spy.count(), 0);
+
+			mNetworkManager->fireFinished();
+			QCOMPARE(spy.count(), 1);
+		}
+
+
+		void sendInitializeFrameworkResponse_unexpectedChunked()
+		{
+			const QByteArray& data = TestFileHelper::readFile(":/paos/Transmit.xml");
+			auto* reply = new MockNetworkReply(data);
+			mNetworkManager->setNextReply(reply);
+			QSharedPointer<InitializeFrameworkResponse> initializeFrameworkResponse(new InitializeFrameworkResponse());
+			mAuthContext->setInitializeFrameworkResponse(initializeFrameworkResponse);
+
+			QSignalSpy spy(mState.data(), &StateGenericSendReceive::fireAbort);
+			QSignalSpy spyMock(mNetworkManager.data(), &MockNetworkManager::fireReply);
+			QSignalSpy spyReadyRead(reply, &QNetworkReply::readyRead);
+
+			mAuthContext->setStateApproved();
+			QTRY_COMPARE(spyMock.count(), 1); // clazy:exclude=qstring-allocations
+			reply->fireReadyReadChunked(64);
+			QVERIFY(spyReadyRead.count() >= 2);
+
+			// The message is dropped before it is received completely.
+			QCOMPARE(spy.count(), 1);
+			QVERIFY(mState->mReceivedData.size() < data.size());
+			QCOMPARE(mAuthContext->getStatus().getStatusCode(), GlobalStatus::Code::Workflow_Unexpected_Message_From_EidServer);
+
+			mNetworkManager->fireFinished();
+			QCOMPARE(spy.count(), 1);
+		}
+
+
 		void mappingToTrustedChannelError()
 		{
 			const QVector<GlobalStatus::Code> states = QVector<GlobalStatus::Code>()
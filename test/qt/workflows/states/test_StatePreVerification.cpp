@@ -7,6 +7,7 @@
 #include "states/StatePreVerification.h"
 
 #include "AppSettings.h"
+#include "asn1/CVCertificateChainBuilder.h"
 
 #include "TestAuthContext.h"
 
@@ -26,6 +27,30 @@ class test_StatePreVerification
 	QScopedPointer<StatePreVerification> mState;
 	QSharedPointer<AuthContext> mAuthContext;
 
+	bool isChainRegistered()
+	{
+		for (const auto& trustPoint : qAsConst(mState->mTrustedCvcas))
+		{
+			const auto& chain = mAuthContext->getChainStartingWith(trustPoint);
+			if (!chain.isValid())
+			{
+				continue;
+			}
+
+			// without the CVCAs in the pool the chain is only found if it was registered as verified
+			QVector<QSharedPointer<const CVCertificate> > pool;
+			for (const auto& cvc : chain)
+			{
+				if (cvc->getBody().getCHAT().getAccessRole() != AccessRole::CVCA)
+				{
+					pool += cvc;
+				}
+			}
+			return CVCertificateChainBuilder(pool, chain.isProductive()).getChainStartingWith(chain.first(), mState->mTrustedCvcas).isValid();
+		}
+		return false;
+	}
+
 	Q_SIGNALS:
 		void fireStateStart(QEvent* pEvent);
 
@@ -33,6 +58,7 @@ class test_StatePreVerification
 		void init()
 		{
 			AbstractSettings::mTestDir.clear();
+			CVCertificateChainBuilder::clearVerifiedChains();
 			mAuthContext.reset(new TestAuthContext(nullptr, ":/paos/DIDAuthenticateEAC1.xml"));
 
 			mAuthContext->initCvcChainBuilder();
@@ -91,6 +117,24 @@ class test_StatePreVerification
 			mAuthContext->setStateApproved();
 
 			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(!isChainRegistered());
+		}
+
+
+		void testExpiredDeveloperMode()
+		{
+			auto& generalSettings = Env::getSingleton<AppSettings>()->getGeneralSettings();
+			generalSettings.setDeveloperMode(true);
+			const auto resetDeveloperMode = qScopeGuard([&generalSettings] {
+					generalSettings.setDeveloperMode(false);
+				});
+			const_cast<QDateTime*>(&mState->mValidationDateTime)->setDate(QDate(2020, 06, 22));
+
+			QSignalSpy spy(mState.data(), &StatePreVerification::fireContinue);
+			mAuthContext->setStateApproved();
+
+			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(!isChainRegistered());
 		}
 
 
@@ -138,11 +182,13 @@ class test_StatePreVerification
 		void testValid()
 		{
 			const_cast<QDateTime*>(&mState->mValidationDateTime)->setDate(QDate(2020, 05, 25));
+			QVERIFY(!isChainRegistered());
 
 			QSignalSpy spy(mState.data(), &StatePreVerification::fireContinue);
 			mAuthContext->setStateApproved();
 
 			QTRY_COMPARE(spy.count(), 1); // clazy:exclude=qstring-allocations
+			QVERIFY(isChainRegistered());
 		}
 
 
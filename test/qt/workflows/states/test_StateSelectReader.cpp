@@ -7,11 +7,14 @@
 #include "states/StateSelectReader.h"
 
 #include "Env.h"
+#include "MockReaderManagerPlugIn.h"
 #include "ReaderManager.h"
 #include "states/StateBuilder.h"
 
 #include <QtTest>
 
+Q_IMPORT_PLUGIN(MockReaderManagerPlugIn)
+
 using namespace governikus;
 
 
@@ -62,6 +65,19 @@ class test_StateSelectReader
 		}
 
 
+		void test_StartScanForBoundReader()
+		{
+			const auto readerManager = Env::getSingleton<ReaderManager>();
+			readerManager->stopScan(ReaderManagerPlugInType::UNKNOWN);
+			QTRY_VERIFY(!readerManager->isScanRunning(ReaderManagerPlugInType::UNKNOWN)); // clazy:exclude=qstring-allocations
+
+			mContext->setBoundReaderName(QStringLiteral("MockReader"));
+			mContext->setReaderPlugInTypes({ReaderManagerPlugInType::UNKNOWN});
+			mContext->setStateApproved();
+			QTRY_VERIFY(readerManager->isScanRunning(ReaderManagerPlugInType::UNKNOWN)); // clazy:exclude=qstring-allocations
+		}
+
+
 		void test_fireReaderPlugInTypesChanged()
 		{
 			QSignalSpy spyRetry(mState.data(), &StateSelectReader::fireRetry);